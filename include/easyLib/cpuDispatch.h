@@ -0,0 +1,216 @@
+/**
+ * @file cpuDispatch.h
+ * @author Harith Manoj
+ * @brief Runtime CPU feature detection and instruction set tier selection for accelerated kernels.
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (C) Harith Manoj
+ *
+ *
+ *                      APACHE LICENSE 2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef INCLUDE_EASYLIB_CPUDISPATCH_H_INCLUDED
+
+/// @brief include\easyLib\cpuDispatch.h Header Guard
+#define INCLUDE_EASYLIB_CPUDISPATCH_H_INCLUDED
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <optional>
+#include <string_view>
+
+#if defined(_MSC_VER) && !defined(__clang__) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#endif
+
+namespace easyLib
+{
+    /**
+     * @brief Instruction set tiers of accelerated kernels, each tier includes the ones below.
+     *
+     * Kernels are compiled for every tier the compiler can target and the highest tier not above `cpuTier()` is run,
+     * so one generic binary uses the fastest path of each host.
+     */
+    enum class CpuTier : std::uint8_t
+    {
+        /// @brief Portable scalar reference code only.
+        SCALAR,
+
+        /// @brief SSE2 (x86-64 baseline).
+        SSE2,
+
+        /// @brief SSE4.2 and POPCNT.
+        SSE4_2,
+
+        /// @brief AVX2, BMI1, BMI2 and the SSE4.2 tier.
+        AVX2,
+
+        /// @brief AVX-512 Foundation and Byte-Word and the AVX2 tier.
+        AVX512
+    };
+
+    /// @brief Environment variable that lowers the tier, one of `scalar`, `sse2`, `sse4.2`, `avx2`, `avx512`.
+    constexpr std::string_view CPU_TIER_ENVIRONMENT = "EASY_LIB_CPU_TIER";
+
+    /**
+     * @brief Parse tier name (as in `CPU_TIER_ENVIRONMENT`).
+     *
+     * @param[in] name tier name, lowercase.
+     * @return std::optional<CpuTier> tier, empty if name is not recognised.
+     */
+    [[nodiscard]] inline constexpr std::optional<CpuTier> parseCpuTier(std::string_view name) noexcept
+    {
+        if(name == "scalar")
+            return CpuTier::SCALAR;
+        if(name == "sse2")
+            return CpuTier::SSE2;
+        if((name == "sse4.2") || (name == "sse4_2"))
+            return CpuTier::SSE4_2;
+        if(name == "avx2")
+            return CpuTier::AVX2;
+        if((name == "avx512") || (name == "avx512bw"))
+            return CpuTier::AVX512;
+        return std::nullopt;
+    }
+
+    /// @brief Name of `tier`, parsable by `parseCpuTier`.
+    [[nodiscard]] inline constexpr std::string_view cpuTierName(CpuTier tier) noexcept
+    {
+        switch(tier)
+        {
+        case CpuTier::SSE2: return "sse2";
+        case CpuTier::SSE4_2: return "sse4.2";
+        case CpuTier::AVX2: return "avx2";
+        case CpuTier::AVX512: return "avx512";
+        default: return "scalar";
+        }
+    }
+
+    /**
+     * @brief Highest tier supported by the processor and operating system (CPUID and XCR0).
+     *
+     * @return CpuTier detected tier, `SCALAR` on non x86 targets.
+     */
+    [[nodiscard]] inline CpuTier detectCpuTier() noexcept
+    {
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+        __builtin_cpu_init();
+
+        if(!__builtin_cpu_supports("sse2"))
+            return CpuTier::SCALAR;
+        if(!__builtin_cpu_supports("sse4.2") || !__builtin_cpu_supports("popcnt"))
+            return CpuTier::SSE2;
+        if(!__builtin_cpu_supports("avx2") || !__builtin_cpu_supports("bmi") || !__builtin_cpu_supports("bmi2"))
+            return CpuTier::SSE4_2;
+        if(!__builtin_cpu_supports("avx512f") || !__builtin_cpu_supports("avx512bw"))
+            return CpuTier::AVX2;
+        return CpuTier::AVX512;
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+        int registers[4];
+        __cpuid(registers, 0);
+        int leafCount = registers[0];
+
+        __cpuid(registers, 1);
+        auto ecx1 = static_cast<unsigned int>(registers[2]), edx1 = static_cast<unsigned int>(registers[3]);
+
+        if(!(edx1 & (1u << 26)))
+            return CpuTier::SCALAR;
+        if(!(ecx1 & (1u << 20)) || !(ecx1 & (1u << 23)))
+            return CpuTier::SSE2;
+
+        // AVX state must be enabled by the operating system (OSXSAVE and XCR0 bits 1, 2).
+        if(!(ecx1 & (1u << 27)) || (leafCount < 7))
+            return CpuTier::SSE4_2;
+
+        auto xcr0 = _xgetbv(0);
+        if((xcr0 & 0x6) != 0x6)
+            return CpuTier::SSE4_2;
+
+        __cpuidex(registers, 7, 0);
+        auto ebx7 = static_cast<unsigned int>(registers[1]);
+
+        if(!(ebx7 & (1u << 5)) || !(ebx7 & (1u << 3)) || !(ebx7 & (1u << 8)))
+            return CpuTier::SSE4_2;
+        if(!(ebx7 & (1u << 16)) || !(ebx7 & (1u << 30)) || ((xcr0 & 0xe0) != 0xe0))
+            return CpuTier::AVX2;
+        return CpuTier::AVX512;
+#else
+        return CpuTier::SCALAR;
+#endif
+    }
+
+    namespace impl_detail_
+    {
+        /// @brief Detected tier lowered by `CPU_TIER_ENVIRONMENT`, evaluated once.
+        [[nodiscard]] inline CpuTier startupCpuTier_() noexcept
+        {
+            CpuTier detected = detectCpuTier();
+
+            // std::getenv is not thread safe against setenv, it is only read once here.
+            const char* value = std::getenv(CPU_TIER_ENVIRONMENT.data());
+            if(value == nullptr)
+                return detected;
+
+            auto requested = parseCpuTier(value);
+            if(requested.has_value() && (*requested < detected))
+                return *requested;
+            return detected;
+        }
+
+        /// @brief Active tier, initialised on first use.
+        [[nodiscard]] inline std::atomic<CpuTier>& activeCpuTier_() noexcept
+        {
+            static std::atomic<CpuTier> tier{startupCpuTier_()};
+            return tier;
+        }
+    }
+
+    /**
+     * @brief Tier used by accelerated kernels: detected tier, lowered by `CPU_TIER_ENVIRONMENT` or `overrideCpuTier`.
+     *
+     * @return CpuTier active tier.
+     */
+    [[nodiscard]] inline CpuTier cpuTier() noexcept
+    {
+        return impl_detail_::activeCpuTier_().load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Change the active tier (eg: test every kernel path in one process), clamped to the detected tier.
+     *
+     * Kernels already running keep their path, later calls use the new tier.
+     *
+     * @param[in] tier requested tier.
+     * @return CpuTier tier now active.
+     */
+    inline CpuTier overrideCpuTier(CpuTier tier) noexcept
+    {
+        CpuTier detected = detectCpuTier();
+        CpuTier active = (tier < detected) ? tier : detected;
+        impl_detail_::activeCpuTier_().store(active, std::memory_order_relaxed);
+        return active;
+    }
+
+    /// @brief Whether kernels of `tier` may run.
+    [[nodiscard]] inline bool isCpuTierActive(CpuTier tier) noexcept
+    {
+        return cpuTier() >= tier;
+    }
+}
+
+#endif // INCLUDE_EASYLIB_CPUDISPATCH_H_INCLUDED
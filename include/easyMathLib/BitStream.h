@@ -0,0 +1,391 @@
+/**
+ * @file BitStream.h
+ * @author Harith Manoj
+ * @brief Sequential bit field reader / writer over byte buffers.
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (C) Harith Manoj
+ *
+ *
+ *                      APACHE LICENSE 2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef INCLUDE_EASYMATHLIB_BITSTREAM_H_INCLUDED
+
+/// @brief include\easyMathLib\BitStream.h Header Guard
+#define INCLUDE_EASYMATHLIB_BITSTREAM_H_INCLUDED
+
+#include <span>
+#include <cstdint>
+#include <type_traits>
+
+#include <easyMathLib/easyMath.h>
+#include <easyMathLib/simdSupport.h>
+#include <easyMathLib/bitPacking.h>
+
+namespace easyMath
+{
+    namespace impl_detail_
+    {
+        /**
+         * @brief Lower `size` bits of `value`, uses BMI2 `bzhi` when evaluated at runtime.
+         *
+         * @param[in] value source value.
+         * @param[in] size number of bits to keep, `size < 64`.
+         * @return std::uint64_t masked value.
+         */
+        [[nodiscard]] inline constexpr std::uint64_t lowBits_(std::uint64_t value, std::size_t size) noexcept
+        {
+#if defined(EASY_MATH_HAS_BMI2) && (defined(__x86_64__) || defined(_M_X64))
+            if(!std::is_constant_evaluated())
+                return _bzhi_u64(value, static_cast<unsigned int>(size));
+#endif
+            return value & nBitMask<std::uint64_t>(size);
+        }
+    }
+
+    /**
+     * @brief Zero copy sequential reader of bit fields from a byte buffer.
+     *
+     * Fields are read least significant bit first from little endian bytes, the same layout written by
+     * `BitWriter` and `pack`. A 64 bit buffer is refilled with a single unaligned load so `peek` of up to
+     * `MAX_PEEK_BITS` bits never touches memory. Reading past the end yields zero bits and sets a sticky
+     * overrun flag.
+     */
+    class BitReader
+    {
+    public:
+
+        /// @brief Largest field guaranteed to be available to `peek` after one refill.
+        static constexpr std::size_t MAX_PEEK_BITS = 56;
+
+    private:
+
+        /// @brief Source bytes.
+        const std::uint8_t* data_;
+
+        /// @brief Number of source bytes.
+        std::size_t size_;
+
+        /// @brief Next byte to be loaded into the buffer.
+        std::size_t bytePos_;
+
+        /// @brief Buffered bits, next bit at bit 0.
+        std::uint64_t buffer_;
+
+        /// @brief Number of valid bits in buffer.
+        std::size_t bitCount_;
+
+        /// @brief Set if a read went past the end of data.
+        bool isOverrun_;
+
+        /// @brief Top up buffer to at least `MAX_PEEK_BITS` bits (fewer only at end of data).
+        inline constexpr void refill_() noexcept
+        {
+            if(bytePos_ + 8 <= size_)
+            {
+                // bits above bitCount_ end up holding the following data or zero, both stay valid.
+                buffer_ |= impl_detail_::loadLittle64_(data_ + bytePos_) << bitCount_;
+
+                std::size_t advance = (63 - bitCount_) / 8;
+                bytePos_ += advance;
+                bitCount_ += advance * 8;
+            }
+            else
+            {
+                for(; (bitCount_ <= 56) && (bytePos_ < size_); ++bytePos_, bitCount_ += 8)
+                    buffer_ |= static_cast<std::uint64_t>(data_[bytePos_]) << bitCount_;
+            }
+        }
+
+    public:
+
+        /**
+         * @brief Read from `data`.
+         *
+         * @param[in] data source bytes, must outlive the reader.
+         */
+        inline constexpr explicit BitReader(std::span<const std::uint8_t> data) noexcept :
+            data_(data.data()), size_(data.size()), bytePos_(0), buffer_(0), bitCount_(0), isOverrun_(false) {}
+
+        /**
+         * @brief Next `size` bits without consuming them.
+         *
+         * @param[in] size field width, `size <= MAX_PEEK_BITS`.
+         * @return std::uint64_t field value (missing bits past end of data read as zero).
+         */
+        [[nodiscard]] inline constexpr std::uint64_t peek(std::size_t size) noexcept
+        {
+            if(bitCount_ < size)
+                refill_();
+
+            return impl_detail_::lowBits_(buffer_, size);
+        }
+
+        /**
+         * @brief Drop `size` bits previously made available by `peek`.
+         *
+         * @param[in] size number of bits, `size <= MAX_PEEK_BITS`.
+         */
+        inline constexpr void consume(std::size_t size) noexcept
+        {
+            if(size > bitCount_)
+            {
+                isOverrun_ = true;
+                size = bitCount_;
+            }
+
+            buffer_ >>= size;
+            bitCount_ -= size;
+        }
+
+        /**
+         * @brief Read and consume a field of up to 64 bits.
+         *
+         * @param[in] size field width, `size <= 64`.
+         * @return std::uint64_t field value.
+         */
+        [[nodiscard]] inline constexpr std::uint64_t read(std::size_t size) noexcept
+        {
+            if(size <= MAX_PEEK_BITS)
+            {
+                auto value = peek(size);
+                consume(size);
+                return value;
+            }
+
+            auto low = read(32);
+            return low | (read(size - 32) << 32);
+        }
+
+        /**
+         * @brief Next `Bits` bits without consuming them (width fixed at compile time).
+         *
+         * @tparam Bits field width, `Bits <= MAX_PEEK_BITS`.
+         * @return SizeCapableUint<Bits> field value.
+         */
+        template<std::size_t Bits>
+            requires ((Bits > 0) && (Bits <= MAX_PEEK_BITS))
+        [[nodiscard]] inline constexpr SizeCapableUint<Bits> peek() noexcept
+        {
+            return static_cast<SizeCapableUint<Bits>>(peek(Bits));
+        }
+
+        /**
+         * @brief Read and consume a `Bits` bit field (width fixed at compile time).
+         *
+         * @tparam Bits field width, `Bits <= 64`.
+         * @return SizeCapableUint<Bits> field value.
+         */
+        template<std::size_t Bits>
+            requires ((Bits > 0) && (Bits <= 64))
+        [[nodiscard]] inline constexpr SizeCapableUint<Bits> read() noexcept
+        {
+            return static_cast<SizeCapableUint<Bits>>(read(Bits));
+        }
+
+        /// @brief Read and consume a single bit.
+        [[nodiscard]] inline constexpr bool readBit() noexcept { return read(1) != 0; }
+
+        /**
+         * @brief Skip any number of bits, whole bytes are skipped without being loaded.
+         *
+         * @param[in] size number of bits to skip.
+         */
+        inline constexpr void skip(std::size_t size) noexcept
+        {
+            if(size <= bitCount_)
+            {
+                consume(size);
+                return;
+            }
+
+            size -= bitCount_;
+            buffer_ = 0;
+            bitCount_ = 0;
+
+            if(size / 8 > size_ - bytePos_)
+            {
+                isOverrun_ = true;
+                bytePos_ = size_;
+                return;
+            }
+
+            bytePos_ += size / 8;
+
+            if(size % 8 != 0)
+            {
+                refill_();
+                consume(size % 8);
+            }
+        }
+
+        /// @brief Skip to the next byte boundary.
+        inline constexpr void alignToByte() noexcept { consume(bitCount_ % 8); }
+
+        /// @brief Number of bits consumed so far.
+        [[nodiscard]] inline constexpr std::size_t bitPosition() const noexcept { return bytePos_ * 8 - bitCount_; }
+
+        /// @brief Number of bits left to read.
+        [[nodiscard]] inline constexpr std::size_t bitsRemaining() const noexcept { return size_ * 8 - bitPosition(); }
+
+        /// @brief Check if any read went past the end of data.
+        [[nodiscard]] inline constexpr bool hasOverrun() const noexcept { return isOverrun_; }
+    };
+
+    /**
+     * @brief Zero copy sequential writer of bit fields into a caller provided byte buffer.
+     *
+     * Layout matches `BitReader`. Bits are accumulated in a 64 bit buffer and written out with single
+     * unaligned stores, call `flush` before reading the buffer. Writes past the end of the buffer are dropped
+     * and set a sticky overrun flag.
+     */
+    class BitWriter
+    {
+        /// @brief Destination bytes.
+        std::uint8_t* data_;
+
+        /// @brief Number of destination bytes.
+        std::size_t size_;
+
+        /// @brief Destination byte of buffer bit 0.
+        std::size_t bytePos_;
+
+        /// @brief Pending bits, first pending bit at bit 0.
+        std::uint64_t buffer_;
+
+        /// @brief Number of pending bits (below 8 after each write).
+        std::size_t bitCount_;
+
+        /// @brief Set if a write went past the end of the buffer.
+        bool isOverrun_;
+
+        /// @brief Write out whole pending bytes (the fast path may also store zero bytes ahead of the position).
+        inline constexpr void drain_() noexcept
+        {
+            std::size_t bytes = bitCount_ / 8;
+
+            if(bytePos_ + 8 <= size_)
+                impl_detail_::storeLittle64_(data_ + bytePos_, buffer_);
+            else
+            {
+                for(std::size_t i = 0; i < bytes; ++i)
+                {
+                    if(bytePos_ + i < size_)
+                        data_[bytePos_ + i] = static_cast<std::uint8_t>(buffer_ >> (8 * i));
+                    else
+                        isOverrun_ = true;
+                }
+            }
+
+            bytePos_ += bytes;
+            bitCount_ %= 8;
+            buffer_ >>= 8 * bytes;
+        }
+
+        /**
+         * @brief Append up to 56 bits.
+         *
+         * @param[in] value field value, bits above `size` are ignored.
+         * @param[in] size field width.
+         */
+        inline constexpr void put_(std::uint64_t value, std::size_t size) noexcept
+        {
+            buffer_ |= impl_detail_::lowBits_(value, size) << bitCount_;
+            bitCount_ += size;
+            drain_();
+        }
+
+    public:
+
+        /**
+         * @brief Write into `data`.
+         *
+         * @param[out] data destination bytes, must outlive the writer.
+         */
+        inline constexpr explicit BitWriter(std::span<std::uint8_t> data) noexcept :
+            data_(data.data()), size_(data.size()), bytePos_(0), buffer_(0), bitCount_(0), isOverrun_(false) {}
+
+        /**
+         * @brief Append a field of up to 64 bits.
+         *
+         * @param[in] value field value, bits above `size` are ignored.
+         * @param[in] size field width, `size <= 64`.
+         */
+        inline constexpr void write(std::uint64_t value, std::size_t size) noexcept
+        {
+            if(size > 56)
+            {
+                put_(value, 32);
+                put_(value >> 32, size - 32);
+            }
+            else
+                put_(value, size);
+        }
+
+        /**
+         * @brief Append a `Bits` bit field (width fixed at compile time).
+         *
+         * @tparam Bits field width, `Bits <= 64`.
+         * @param[in] value field value, bits above `Bits` are ignored.
+         */
+        template<std::size_t Bits>
+            requires ((Bits > 0) && (Bits <= 64))
+        inline constexpr void write(std::uint64_t value) noexcept
+        {
+            write(value, Bits);
+        }
+
+        /// @brief Append a single bit.
+        inline constexpr void writeBit(bool bit) noexcept { put_(bit ? 1 : 0, 1); }
+
+        /// @brief Pad with zero bits to the next byte boundary.
+        inline constexpr void alignToByte() noexcept
+        {
+            if(bitCount_ != 0)
+                put_(0, 8 - bitCount_);
+        }
+
+        /**
+         * @brief Write out pending bits (last partial byte is zero padded), writing may continue afterwards.
+         *
+         * @return std::size_t number of bytes holding written bits.
+         */
+        inline constexpr std::size_t flush() noexcept
+        {
+            if(bitCount_ != 0)
+            {
+                if(bytePos_ < size_)
+                    data_[bytePos_] = static_cast<std::uint8_t>(buffer_);
+                else
+                    isOverrun_ = true;
+            }
+
+            return byteSize();
+        }
+
+        /// @brief Number of bits written so far.
+        [[nodiscard]] inline constexpr std::size_t bitPosition() const noexcept { return bytePos_ * 8 + bitCount_; }
+
+        /// @brief Number of bytes holding written bits.
+        [[nodiscard]] inline constexpr std::size_t byteSize() const noexcept { return divideRoundUp<std::size_t>(bitPosition(), 8); }
+
+        /// @brief Check if any write went past the end of the buffer.
+        [[nodiscard]] inline constexpr bool hasOverrun() const noexcept { return isOverrun_; }
+    };
+}
+
+#endif // INCLUDE_EASYMATHLIB_BITSTREAM_H_INCLUDED
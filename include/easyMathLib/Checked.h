@@ -0,0 +1,613 @@
+/**
+ * @file Checked.h
+ * @author Harith Manoj
+ * @brief Overflow tracking integer wrapper, checked and saturating span arithmetic.
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (C) Harith Manoj
+ *
+ *
+ *                      APACHE LICENSE 2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef INCLUDE_EASYMATHLIB_CHECKED_H_INCLUDED
+
+/// @brief include\easyMathLib\Checked.h Header Guard
+#define INCLUDE_EASYMATHLIB_CHECKED_H_INCLUDED
+
+#include <span>
+#include <limits>
+#include <compare>
+#include <cstdint>
+#include <utility>
+#include <concepts>
+#include <type_traits>
+
+#include <easyMathLib/easyMath.h>
+#include <easyMathLib/simdSupport.h>
+
+namespace easyMath
+{
+    /**
+     * @brief Builtin integer (not `bool`) usable with `Checked` and the checked / saturating kernels.
+     *
+     * @tparam Integer type to check.
+     */
+    template<class Integer>
+    concept CheckableInteger = std::integral<Integer> && !std::same_as<Integer, bool>;
+
+    namespace impl_detail_
+    {
+        /// @brief Arithmetic operation of checked / saturating kernels.
+        enum class CheckedOperation_
+        {
+            ADD,
+            SUBTRACT,
+            MULTIPLY
+        };
+
+        /**
+         * @brief Wrapping operation reporting overflow without branching (compiler overflow builtins when available).
+         *
+         * @tparam Operation operation.
+         * @tparam Integer builtin integer.
+         * @param[in] lhs left hand side.
+         * @param[in] rhs right hand side.
+         * @param[out] result result modulo 2^bitSize.
+         * @return true if the exact result is not representable.
+         */
+        template<CheckedOperation_ Operation, CheckableInteger Integer>
+        [[nodiscard]] inline constexpr bool overflowingOperation_(Integer lhs, Integer rhs, Integer& result) noexcept
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            if constexpr (Operation == CheckedOperation_::ADD)
+                return __builtin_add_overflow(lhs, rhs, &result);
+            else if constexpr (Operation == CheckedOperation_::SUBTRACT)
+                return __builtin_sub_overflow(lhs, rhs, &result);
+            else
+                return __builtin_mul_overflow(lhs, rhs, &result);
+#else
+            using UInt = std::make_unsigned_t<Integer>;
+
+            auto left = static_cast<UInt>(lhs), right = static_cast<UInt>(rhs);
+
+            if constexpr (Operation == CheckedOperation_::ADD)
+            {
+                auto sum = static_cast<UInt>(left + right);
+                result = static_cast<Integer>(sum);
+
+                if constexpr (std::is_signed_v<Integer>)
+                    return static_cast<Integer>((left ^ sum) & (right ^ sum)) < 0;
+                else
+                    return sum < left;
+            }
+            else if constexpr (Operation == CheckedOperation_::SUBTRACT)
+            {
+                auto difference = static_cast<UInt>(left - right);
+                result = static_cast<Integer>(difference);
+
+                if constexpr (std::is_signed_v<Integer>)
+                    return static_cast<Integer>((left ^ right) & (left ^ difference)) < 0;
+                else
+                    return left < right;
+            }
+            else if constexpr (sizeof(Integer) <= 4)
+            {
+                using Wide = std::conditional_t<std::is_signed_v<Integer>, std::int64_t, std::uint64_t>;
+
+                auto product = static_cast<Wide>(lhs) * static_cast<Wide>(rhs);
+                result = static_cast<Integer>(product);
+                return (product < static_cast<Wide>(NumericTraits<Integer>::lowest())) | (product > static_cast<Wide>(NumericTraits<Integer>::max()));
+            }
+            else
+            {
+                bool isNegative = (lhs < 0) != (rhs < 0);
+                auto magnitude = [](Integer value) { return (value < 0) ? static_cast<std::uint64_t>(0 - static_cast<UInt>(value)) : static_cast<std::uint64_t>(value); };
+
+                std::uint64_t high = 0;
+                auto low = multiplyFull64_(magnitude(lhs), magnitude(rhs), high);
+                result = static_cast<Integer>(isNegative ? static_cast<UInt>(0 - low) : static_cast<UInt>(low));
+
+                if constexpr (std::is_signed_v<Integer>)
+                    return (high != 0) | (low > static_cast<std::uint64_t>(NumericTraits<Integer>::max()) + (isNegative ? 1u : 0u));
+                else
+                    return high != 0;
+            }
+#endif
+        }
+
+        /**
+         * @brief Bound an overflowing operation saturates to (direction taken from the operand signs).
+         *
+         * @tparam Operation operation.
+         * @tparam Integer builtin integer.
+         * @param[in] lhs left hand side.
+         * @param[in] rhs right hand side.
+         * @return Integer `max()` or `lowest()`.
+         */
+        template<CheckedOperation_ Operation, CheckableInteger Integer>
+        [[nodiscard]] inline constexpr Integer saturationBound_(Integer lhs, Integer rhs) noexcept
+        {
+            constexpr Integer max = NumericTraits<Integer>::max(), lowest = NumericTraits<Integer>::lowest();
+
+            if constexpr (!std::is_signed_v<Integer>)
+                return (Operation == CheckedOperation_::SUBTRACT) ? lowest : max;
+            else if constexpr (Operation == CheckedOperation_::ADD)
+                return (rhs < 0) ? lowest : max;
+            else if constexpr (Operation == CheckedOperation_::SUBTRACT)
+                return (rhs < 0) ? max : lowest;
+            else
+                return ((lhs < 0) != (rhs < 0)) ? lowest : max;
+        }
+
+#if defined(EASY_MATH_DISPATCH_AVX2)
+
+        /// @brief Lane wise add of 8 (`isWide`) or 4 byte lanes.
+        template<bool isWide>
+        [[nodiscard]] EASY_MATH_TARGET_AVX2 inline __m256i avx2LaneAdd_(__m256i lhs, __m256i rhs) noexcept
+        {
+            return isWide ? _mm256_add_epi64(lhs, rhs) : _mm256_add_epi32(lhs, rhs);
+        }
+
+        /// @brief Lane wise subtract of 8 (`isWide`) or 4 byte lanes.
+        template<bool isWide>
+        [[nodiscard]] EASY_MATH_TARGET_AVX2 inline __m256i avx2LaneSubtract_(__m256i lhs, __m256i rhs) noexcept
+        {
+            return isWide ? _mm256_sub_epi64(lhs, rhs) : _mm256_sub_epi32(lhs, rhs);
+        }
+
+        /// @brief All ones in lanes whose sign bit is set.
+        template<bool isWide>
+        [[nodiscard]] EASY_MATH_TARGET_AVX2 inline __m256i avx2LaneSignMask_(__m256i value) noexcept
+        {
+            return isWide ? _mm256_cmpgt_epi64(_mm256_setzero_si256(), value) : _mm256_srai_epi32(value, 31);
+        }
+
+        /// @brief All ones in lanes where `lhs > rhs` as unsigned, `signBit` holds the lane sign bit.
+        template<bool isWide>
+        [[nodiscard]] EASY_MATH_TARGET_AVX2 inline __m256i avx2LaneUnsignedGreater_(__m256i lhs, __m256i rhs, __m256i signBit) noexcept
+        {
+            lhs = _mm256_xor_si256(lhs, signBit);
+            rhs = _mm256_xor_si256(rhs, signBit);
+            return isWide ? _mm256_cmpgt_epi64(lhs, rhs) : _mm256_cmpgt_epi32(lhs, rhs);
+        }
+
+        /**
+         * @brief AVX2 checked / saturating add or subtract of 32 or 64 bit lanes.
+         *
+         * @tparam Operation `ADD` or `SUBTRACT`.
+         * @tparam isSaturating clamp overflowing lanes instead of wrapping.
+         * @tparam Integer 4 or 8 byte builtin integer.
+         * @param[in] lhs left hand side.
+         * @param[in] rhs right hand side.
+         * @param[out] result destination.
+         * @param[in] count number of elements, processed in whole vectors.
+         * @param[inout] overflow set if any lane overflowed.
+         * @return std::size_t number of elements processed.
+         */
+        template<CheckedOperation_ Operation, bool isSaturating, CheckableInteger Integer>
+        EASY_MATH_TARGET_AVX2 inline std::size_t avx2CheckedKernel_(const Integer* lhs, const Integer* rhs, Integer* result, std::size_t count, bool& overflow) noexcept
+        {
+            constexpr std::size_t laneCount = 32 / sizeof(Integer);
+            constexpr bool isWide = sizeof(Integer) == 8;
+
+            auto signBit = isWide ? _mm256_set1_epi64x(std::numeric_limits<std::int64_t>::min()) : _mm256_set1_epi32(std::numeric_limits<std::int32_t>::min());
+
+            auto anyOverflow = _mm256_setzero_si256();
+            std::size_t i = 0;
+
+            for(; i + laneCount <= count; i += laneCount)
+            {
+                auto a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lhs + i));
+                auto b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rhs + i));
+
+                auto r = (Operation == CheckedOperation_::ADD) ? avx2LaneAdd_<isWide>(a, b) : avx2LaneSubtract_<isWide>(a, b);
+                __m256i lanesOverflow;
+
+                if constexpr (std::is_signed_v<Integer>)
+                {
+                    lanesOverflow = (Operation == CheckedOperation_::ADD)
+                        ? avx2LaneSignMask_<isWide>(_mm256_and_si256(_mm256_xor_si256(a, r), _mm256_xor_si256(b, r)))
+                        : avx2LaneSignMask_<isWide>(_mm256_and_si256(_mm256_xor_si256(a, b), _mm256_xor_si256(a, r)));
+
+                    if constexpr (isSaturating)
+                    {
+                        // overflow always leaves the range on the side of lhs.
+                        auto bound = _mm256_xor_si256(avx2LaneSignMask_<isWide>(a), _mm256_xor_si256(signBit, _mm256_set1_epi32(-1)));
+                        r = _mm256_blendv_epi8(r, bound, lanesOverflow);
+                    }
+                }
+                else
+                {
+                    lanesOverflow = (Operation == CheckedOperation_::ADD) ? avx2LaneUnsignedGreater_<isWide>(a, r, signBit) : avx2LaneUnsignedGreater_<isWide>(b, a, signBit);
+
+                    if constexpr (isSaturating)
+                        r = (Operation == CheckedOperation_::ADD) ? _mm256_or_si256(r, lanesOverflow) : _mm256_andnot_si256(lanesOverflow, r);
+                }
+
+                anyOverflow = _mm256_or_si256(anyOverflow, lanesOverflow);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(result + i), r);
+            }
+
+            overflow = overflow || !_mm256_testz_si256(anyOverflow, anyOverflow);
+            return i;
+        }
+
+#endif
+
+        /**
+         * @brief Element wise checked / saturating operation.
+         *
+         * @tparam Operation operation.
+         * @tparam isSaturating clamp overflowing elements instead of wrapping.
+         * @tparam Integer builtin integer.
+         * @param[in] lhs left hand side.
+         * @param[in] rhs right hand side, requires `rhs.size() >= lhs.size()`.
+         * @param[out] result destination, requires `result.size() >= lhs.size()`, may alias `lhs` or `rhs`.
+         * @return true if any element overflowed.
+         */
+        template<CheckedOperation_ Operation, bool isSaturating, CheckableInteger Integer>
+        [[nodiscard]] inline constexpr bool checkedSpanKernel_(std::span<const Integer> lhs, std::span<const Integer> rhs, std::span<Integer> result) noexcept
+        {
+            bool overflow = false;
+
+#if defined(EASY_MATH_DISPATCH_AVX2)
+            if constexpr ((Operation != CheckedOperation_::MULTIPLY) && (sizeof(Integer) >= 4))
+            {
+                if(!std::is_constant_evaluated() && useAvx2_())
+                {
+                    std::size_t done = avx2CheckedKernel_<Operation, isSaturating, Integer>(lhs.data(), rhs.data(), result.data(), lhs.size(), overflow);
+                    lhs = lhs.subspan(done);
+                    rhs = rhs.subspan(done);
+                    result = result.subspan(done);
+                }
+            }
+#endif
+
+            for(std::size_t i = 0; i < lhs.size(); ++i)
+            {
+                Integer value;
+                bool elementOverflow = overflowingOperation_<Operation>(lhs[i], rhs[i], value);
+
+                if constexpr (isSaturating)
+                    value = elementOverflow ? saturationBound_<Operation>(lhs[i], rhs[i]) : value;
+
+                result[i] = value;
+                overflow |= elementOverflow;
+            }
+
+            return overflow;
+        }
+    }
+
+    /**
+     * @brief Builtin integer carrying a sticky overflow flag.
+     *
+     * Every operation wraps like the unsigned builtin types and ORs its overflow into the flag without
+     * branching, so a loop of operations needs a single `hasOverflowed` check at the end. Flags propagate
+     * through binary operators. Conversion from out of range integers or floating point values also sets the
+     * flag. Comparisons look at the value only.
+     *
+     * Satisfies `NumericType`, `NumericTraits` is specialised through `std::numeric_limits`.
+     *
+     * @tparam Integer underlying builtin integer.
+     */
+    template<CheckableInteger Integer>
+    class Checked
+    {
+        /// @brief Value modulo 2^bitSize.
+        Integer value_ = 0;
+
+        /// @brief Set once any operation leading to this value overflowed.
+        bool hasOverflowed_ = false;
+
+        /**
+         * @brief Apply operation in place.
+         *
+         * @tparam Operation operation.
+         * @param[in] rhs right hand side.
+         * @return Checked& `*this`.
+         */
+        template<impl_detail_::CheckedOperation_ Operation>
+        inline constexpr Checked& apply_(const Checked& rhs) noexcept
+        {
+            bool overflow = impl_detail_::overflowingOperation_<Operation>(value_, rhs.value_, value_);
+            hasOverflowed_ = hasOverflowed_ | rhs.hasOverflowed_ | overflow;
+            return *this;
+        }
+
+    public:
+
+        /// @brief Underlying integer type.
+        using ValueType = Integer;
+
+        /// @brief Zero, no overflow.
+        inline constexpr Checked() noexcept = default;
+
+        /**
+         * @brief Construct from builtin integer, sets overflow if `value` is out of range.
+         *
+         * @param[in] value value to convert.
+         */
+        template<std::integral Other>
+        inline constexpr Checked(Other value) noexcept :
+            value_(static_cast<Integer>(value)), hasOverflowed_(!std::in_range<Integer>(value)) {}
+
+        /**
+         * @brief Construct from floating point value (truncated), sets overflow and holds 0 if out of range or NaN.
+         *
+         * @param[in] value value to convert.
+         */
+        template<std::floating_point Float>
+        inline constexpr Checked(Float value) noexcept
+        {
+            // 2^bits (exact in floating point), upper bound excluded.
+            constexpr Float limit = static_cast<Float>(NumericTraits<Integer>::max() / 2 + 1) * 2;
+            constexpr Float lowest = static_cast<Float>(NumericTraits<Integer>::lowest());
+
+            // lowest - 1 rounds back to lowest when Float cannot hold it (eg: int64 in double), lowest is then
+            // the last value that truncates in range.
+            constexpr bool isLowerBoundExact = (lowest - 1) != lowest;
+            bool isAboveLowest = isLowerBoundExact ? (value > lowest - 1) : (value >= lowest);
+
+            if(isAboveLowest && (value < limit))
+                value_ = static_cast<Integer>(value);
+            else
+                hasOverflowed_ = true;
+        }
+
+        /**
+         * @brief Construct with explicit flag.
+         *
+         * @param[in] value value.
+         * @param[in] hasOverflowed initial overflow flag.
+         */
+        inline constexpr Checked(Integer value, bool hasOverflowed) noexcept : value_(value), hasOverflowed_(hasOverflowed) {}
+
+        /// @brief Convert value to builtin integer (truncates).
+        template<std::integral Other>
+        inline constexpr operator Other() const noexcept { return static_cast<Other>(value_); }
+
+        /// @brief Convert value to floating point.
+        template<std::floating_point Float>
+        inline constexpr operator Float() const noexcept { return static_cast<Float>(value_); }
+
+        /// @brief Current value (wrapped if overflowed).
+        [[nodiscard]] inline constexpr Integer value() const noexcept { return value_; }
+
+        /// @brief Check if any operation leading to this value overflowed.
+        [[nodiscard]] inline constexpr bool hasOverflowed() const noexcept { return hasOverflowed_; }
+
+        /// @brief Clear overflow flag.
+        inline constexpr void clearOverflow() noexcept { hasOverflowed_ = false; }
+
+        inline constexpr Checked& operator += (const Checked& rhs) noexcept { return apply_<impl_detail_::CheckedOperation_::ADD>(rhs); }
+
+        inline constexpr Checked& operator -= (const Checked& rhs) noexcept { return apply_<impl_detail_::CheckedOperation_::SUBTRACT>(rhs); }
+
+        inline constexpr Checked& operator *= (const Checked& rhs) noexcept { return apply_<impl_detail_::CheckedOperation_::MULTIPLY>(rhs); }
+
+        /// @brief Divide, division by zero and `lowest() / -1` set overflow and keep the value.
+        inline constexpr Checked& operator /= (const Checked& rhs) noexcept
+        {
+            bool isInvalid = rhs.value_ == 0;
+            if constexpr (std::is_signed_v<Integer>)
+                isInvalid = isInvalid | ((value_ == NumericTraits<Integer>::lowest()) & (rhs.value_ == -1));
+
+            value_ = isInvalid ? value_ : static_cast<Integer>(value_ / (isInvalid ? Integer(1) : rhs.value_));
+            hasOverflowed_ = hasOverflowed_ | rhs.hasOverflowed_ | isInvalid;
+            return *this;
+        }
+
+        inline constexpr Checked& operator ++ () noexcept { return *this += Checked(Integer(1), false); }
+
+        inline constexpr Checked& operator -- () noexcept { return *this -= Checked(Integer(1), false); }
+
+        inline constexpr Checked operator ++ (int) noexcept
+        {
+            auto ret = *this;
+            ++(*this);
+            return ret;
+        }
+
+        inline constexpr Checked operator -- (int) noexcept
+        {
+            auto ret = *this;
+            --(*this);
+            return ret;
+        }
+
+        [[nodiscard]] inline constexpr Checked operator - () const noexcept { return Checked(Integer(0), hasOverflowed_) -= *this; }
+
+        [[nodiscard]] inline constexpr Checked operator + () const noexcept { return *this; }
+
+        [[nodiscard]] friend inline constexpr Checked operator + (Checked lhs, const Checked& rhs) noexcept { return lhs += rhs; }
+        [[nodiscard]] friend inline constexpr Checked operator - (Checked lhs, const Checked& rhs) noexcept { return lhs -= rhs; }
+        [[nodiscard]] friend inline constexpr Checked operator * (Checked lhs, const Checked& rhs) noexcept { return lhs *= rhs; }
+        [[nodiscard]] friend inline constexpr Checked operator / (Checked lhs, const Checked& rhs) noexcept { return lhs /= rhs; }
+
+        /*
+         * Mixed operand overloads, exact matches so that builtin operators
+         * (reachable through the implicit conversions) are not ambiguous.
+         */
+
+        template<std::integral Other>
+        [[nodiscard]] friend inline constexpr Checked operator + (Checked lhs, Other rhs) noexcept { return lhs += Checked(rhs); }
+        template<std::integral Other>
+        [[nodiscard]] friend inline constexpr Checked operator + (Other lhs, const Checked& rhs) noexcept { return Checked(lhs) += rhs; }
+        template<std::integral Other>
+        [[nodiscard]] friend inline constexpr Checked operator - (Checked lhs, Other rhs) noexcept { return lhs -= Checked(rhs); }
+        template<std::integral Other>
+        [[nodiscard]] friend inline constexpr Checked operator - (Other lhs, const Checked& rhs) noexcept { return Checked(lhs) -= rhs; }
+        template<std::integral Other>
+        [[nodiscard]] friend inline constexpr Checked operator * (Checked lhs, Other rhs) noexcept { return lhs *= Checked(rhs); }
+        template<std::integral Other>
+        [[nodiscard]] friend inline constexpr Checked operator * (Other lhs, const Checked& rhs) noexcept { return Checked(lhs) *= rhs; }
+        template<std::integral Other>
+        [[nodiscard]] friend inline constexpr Checked operator / (Checked lhs, Other rhs) noexcept { return lhs /= Checked(rhs); }
+        template<std::integral Other>
+        [[nodiscard]] friend inline constexpr Checked operator / (Other lhs, const Checked& rhs) noexcept { return Checked(lhs) /= rhs; }
+
+        [[nodiscard]] friend inline constexpr bool operator == (const Checked& lhs, const Checked& rhs) noexcept { return lhs.value_ == rhs.value_; }
+
+        [[nodiscard]] friend inline constexpr auto operator <=> (const Checked& lhs, const Checked& rhs) noexcept { return lhs.value_ <=> rhs.value_; }
+
+        template<std::integral Other>
+        [[nodiscard]] friend inline constexpr bool operator == (const Checked& lhs, Other rhs) noexcept { return std::cmp_equal(lhs.value_, rhs); }
+
+        template<std::integral Other>
+        [[nodiscard]] friend inline constexpr std::strong_ordering operator <=> (const Checked& lhs, Other rhs) noexcept
+        {
+            if(std::cmp_less(lhs.value_, rhs))
+                return std::strong_ordering::less;
+            else if(std::cmp_equal(lhs.value_, rhs))
+                return std::strong_ordering::equal;
+            else
+                return std::strong_ordering::greater;
+        }
+    };
+
+    /**
+     * @brief Element wise `result[i] = lhs[i] + rhs[i]` wrapping on overflow.
+     *
+     * @tparam Integer builtin integer.
+     * @param[in] lhs left hand side.
+     * @param[in] rhs right hand side, requires `rhs.size() >= lhs.size()`.
+     * @param[out] result destination, requires `result.size() >= lhs.size()`, may alias `lhs` or `rhs`.
+     * @return true if any element overflowed.
+     */
+    template<CheckableInteger Integer>
+    [[nodiscard]] inline constexpr bool checkedAdd(
+        std::type_identity_t<std::span<const Integer>> lhs,
+        std::type_identity_t<std::span<const Integer>> rhs,
+        std::span<Integer> result
+    ) noexcept
+    {
+        return impl_detail_::checkedSpanKernel_<impl_detail_::CheckedOperation_::ADD, false, Integer>(lhs, rhs, result);
+    }
+
+    /**
+     * @brief Element wise `result[i] = lhs[i] - rhs[i]` wrapping on overflow.
+     *
+     * @tparam Integer builtin integer.
+     * @param[in] lhs left hand side.
+     * @param[in] rhs right hand side, requires `rhs.size() >= lhs.size()`.
+     * @param[out] result destination, requires `result.size() >= lhs.size()`, may alias `lhs` or `rhs`.
+     * @return true if any element overflowed.
+     */
+    template<CheckableInteger Integer>
+    [[nodiscard]] inline constexpr bool checkedSubtract(
+        std::type_identity_t<std::span<const Integer>> lhs,
+        std::type_identity_t<std::span<const Integer>> rhs,
+        std::span<Integer> result
+    ) noexcept
+    {
+        return impl_detail_::checkedSpanKernel_<impl_detail_::CheckedOperation_::SUBTRACT, false, Integer>(lhs, rhs, result);
+    }
+
+    /**
+     * @brief Element wise `result[i] = lhs[i] * rhs[i]` wrapping on overflow.
+     *
+     * @tparam Integer builtin integer.
+     * @param[in] lhs left hand side.
+     * @param[in] rhs right hand side, requires `rhs.size() >= lhs.size()`.
+     * @param[out] result destination, requires `result.size() >= lhs.size()`, may alias `lhs` or `rhs`.
+     * @return true if any element overflowed.
+     */
+    template<CheckableInteger Integer>
+    [[nodiscard]] inline constexpr bool checkedMultiply(
+        std::type_identity_t<std::span<const Integer>> lhs,
+        std::type_identity_t<std::span<const Integer>> rhs,
+        std::span<Integer> result
+    ) noexcept
+    {
+        return impl_detail_::checkedSpanKernel_<impl_detail_::CheckedOperation_::MULTIPLY, false, Integer>(lhs, rhs, result);
+    }
+
+    /**
+     * @brief Element wise `result[i] = lhs[i] + rhs[i]` clamped to the range of `Integer`.
+     *
+     * @tparam Integer builtin integer.
+     * @param[in] lhs left hand side.
+     * @param[in] rhs right hand side, requires `rhs.size() >= lhs.size()`.
+     * @param[out] result destination, requires `result.size() >= lhs.size()`, may alias `lhs` or `rhs`.
+     * @return true if any element saturated.
+     */
+    template<CheckableInteger Integer>
+    [[nodiscard]] inline constexpr bool saturatingAdd(
+        std::type_identity_t<std::span<const Integer>> lhs,
+        std::type_identity_t<std::span<const Integer>> rhs,
+        std::span<Integer> result
+    ) noexcept
+    {
+        return impl_detail_::checkedSpanKernel_<impl_detail_::CheckedOperation_::ADD, true, Integer>(lhs, rhs, result);
+    }
+
+    /**
+     * @brief Element wise `result[i] = lhs[i] - rhs[i]` clamped to the range of `Integer`.
+     *
+     * @tparam Integer builtin integer.
+     * @param[in] lhs left hand side.
+     * @param[in] rhs right hand side, requires `rhs.size() >= lhs.size()`.
+     * @param[out] result destination, requires `result.size() >= lhs.size()`, may alias `lhs` or `rhs`.
+     * @return true if any element saturated.
+     */
+    template<CheckableInteger Integer>
+    [[nodiscard]] inline constexpr bool saturatingSubtract(
+        std::type_identity_t<std::span<const Integer>> lhs,
+        std::type_identity_t<std::span<const Integer>> rhs,
+        std::span<Integer> result
+    ) noexcept
+    {
+        return impl_detail_::checkedSpanKernel_<impl_detail_::CheckedOperation_::SUBTRACT, true, Integer>(lhs, rhs, result);
+    }
+
+    /**
+     * @brief Element wise `result[i] = lhs[i] * rhs[i]` clamped to the range of `Integer`.
+     *
+     * @tparam Integer builtin integer.
+     * @param[in] lhs left hand side.
+     * @param[in] rhs right hand side, requires `rhs.size() >= lhs.size()`.
+     * @param[out] result destination, requires `result.size() >= lhs.size()`, may alias `lhs` or `rhs`.
+     * @return true if any element saturated.
+     */
+    template<CheckableInteger Integer>
+    [[nodiscard]] inline constexpr bool saturatingMultiply(
+        std::type_identity_t<std::span<const Integer>> lhs,
+        std::type_identity_t<std::span<const Integer>> rhs,
+        std::span<Integer> result
+    ) noexcept
+    {
+        return impl_detail_::checkedSpanKernel_<impl_detail_::CheckedOperation_::MULTIPLY, true, Integer>(lhs, rhs, result);
+    }
+}
+
+/// @brief `std::numeric_limits` for `easyMath::Checked`, enables `NumericTraits`.
+template<class Integer>
+struct std::numeric_limits<easyMath::Checked<Integer>> : public std::numeric_limits<Integer>
+{
+    static constexpr easyMath::Checked<Integer> min() noexcept { return std::numeric_limits<Integer>::min(); }
+    static constexpr easyMath::Checked<Integer> lowest() noexcept { return std::numeric_limits<Integer>::lowest(); }
+    static constexpr easyMath::Checked<Integer> max() noexcept { return std::numeric_limits<Integer>::max(); }
+    static constexpr easyMath::Checked<Integer> epsilon() noexcept { return {}; }
+    static constexpr easyMath::Checked<Integer> round_error() noexcept { return {}; }
+    static constexpr easyMath::Checked<Integer> infinity() noexcept { return {}; }
+    static constexpr easyMath::Checked<Integer> quiet_NaN() noexcept { return {}; }
+    static constexpr easyMath::Checked<Integer> signaling_NaN() noexcept { return {}; }
+    static constexpr easyMath::Checked<Integer> denorm_min() noexcept { return {}; }
+};
+
+#endif // INCLUDE_EASYMATHLIB_CHECKED_H_INCLUDED
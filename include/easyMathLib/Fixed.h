@@ -0,0 +1,700 @@
+/**
+ * @file Fixed.h
+ * @author Harith Manoj
+ * @brief Signed binary fixed point number with selectable rounding and vectorised span kernels.
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (C) Harith Manoj
+ *
+ *
+ *                      APACHE LICENSE 2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef INCLUDE_EASYMATHLIB_FIXED_H_INCLUDED
+
+/// @brief include\easyMathLib\Fixed.h Header Guard
+#define INCLUDE_EASYMATHLIB_FIXED_H_INCLUDED
+
+#include <span>
+#include <limits>
+#include <compare>
+#include <cstdint>
+#include <utility>
+#include <concepts>
+#include <type_traits>
+
+#include <easyMathLib/easyMath.h>
+#include <easyMathLib/simdSupport.h>
+#include <easyMathLib/Checked.h>
+
+namespace easyMath
+{
+    /// @brief Rounding of results that fall between two representable fixed point values.
+    enum class FixedRounding
+    {
+        /// @brief Toward zero.
+        TRUNCATE,
+
+        /// @brief Toward negative infinity.
+        FLOOR,
+
+        /// @brief To nearest, ties away from zero.
+        NEAREST,
+
+        /// @brief To nearest, ties to even (banker's rounding).
+        NEAREST_EVEN
+    };
+
+    namespace impl_detail_
+    {
+        /**
+         * @brief Whether a truncated magnitude quotient is incremented (rounded away from zero).
+         *
+         * @tparam Rounding rounding mode.
+         * @param[in] isNegative exact result is negative.
+         * @param[in] isOdd truncated magnitude is odd.
+         * @param[in] remainderVsHalf remainder compared to half the divisor.
+         * @param[in] hasRemainder remainder is not zero.
+         * @return true if rounded away from zero.
+         */
+        template<FixedRounding Rounding>
+        [[nodiscard]] inline constexpr bool roundsAwayFromZero_(bool isNegative, bool isOdd, std::strong_ordering remainderVsHalf, bool hasRemainder) noexcept
+        {
+            if constexpr (Rounding == FixedRounding::TRUNCATE)
+                return false;
+            else if constexpr (Rounding == FixedRounding::FLOOR)
+                return isNegative & hasRemainder;
+            else if constexpr (Rounding == FixedRounding::NEAREST)
+                return hasRemainder & (remainderVsHalf >= 0);
+            else
+                return hasRemainder & ((remainderVsHalf > 0) | ((remainderVsHalf == 0) & isOdd));
+        }
+
+        /// @brief Magnitude of signed value as unsigned 64 bit value.
+        template<std::signed_integral SInt>
+        [[nodiscard]] inline constexpr std::uint64_t magnitude_(SInt value) noexcept
+        {
+            auto wide = static_cast<std::uint64_t>(static_cast<std::int64_t>(value));
+            return (value < 0) ? 0 - wide : wide;
+        }
+    }
+
+    /**
+     * @brief Signed binary fixed point number, `raw() / 2^FracBits` stored in `SizeCapableInt<IntBits + FracBits>`.
+     *
+     * Representable values are multiples of `2^-FracBits` in `[-2^(IntBits - 1), 2^(IntBits - 1))` (`IntBits`
+     * includes the sign bit). Add and subtract wrap like builtin integers; multiply and divide use a double
+     * width intermediate (64 bit, or 64 x 64 -> 128 bit `multiplyFull64` / `divideFull64`), round the exact
+     * result by `Rounding` and wrap. Division by zero is undefined as for builtin types.
+     *
+     * Provides the `bitSize`, `willAddOverflow` and `willSubtractUnderflow` hooks used by `NumericTraits` and
+     * satisfies `NumericType`, usable in `constexpr` contexts.
+     *
+     * @tparam IntBits integer bits including sign, at least 1.
+     * @tparam FracBits fraction bits.
+     * @tparam Rounding rounding of multiply, divide and conversion from floating point.
+     */
+    template<std::size_t IntBits, std::size_t FracBits, FixedRounding Rounding = FixedRounding::NEAREST_EVEN>
+        requires ((IntBits >= 1) && (IntBits + FracBits <= 64))
+    class Fixed
+    {
+    public:
+
+        /// @brief Storage type of raw value.
+        using RawType = SizeCapableInt<IntBits + FracBits>;
+
+        /// @brief Integer bits including sign.
+        static constexpr std::size_t INT_BITS = IntBits;
+
+        /// @brief Fraction bits.
+        static constexpr std::size_t FRAC_BITS = FracBits;
+
+        /// @brief Rounding mode.
+        static constexpr FixedRounding ROUNDING = Rounding;
+
+    private:
+
+        /// @brief Total bits.
+        static constexpr std::size_t BITS_ = IntBits + FracBits;
+
+        /// @brief Unsigned storage type.
+        using URaw_ = std::make_unsigned_t<RawType>;
+
+        /// @brief Raw value of 1.
+        static constexpr std::uint64_t ONE_ = std::uint64_t{1} << FracBits;
+
+        /// @brief Value, `raw_ / 2^FracBits`, sign extended from `BITS_` bits.
+        RawType raw_ = 0;
+
+        /**
+         * @brief Wrap to `BITS_` bits, sign extending into the unused storage bits.
+         *
+         * @param[in] value two's complement value (only the low `BITS_` bits are used).
+         * @return RawType wrapped raw value.
+         */
+        [[nodiscard]] static inline constexpr RawType wrap_(std::uint64_t value) noexcept
+        {
+            constexpr std::size_t UNUSED_BITS = easyMath::bitSize<RawType>() - BITS_;
+
+            auto raw = static_cast<RawType>(static_cast<URaw_>(value));
+            if constexpr (UNUSED_BITS != 0)
+                raw = static_cast<RawType>(static_cast<RawType>(static_cast<URaw_>(static_cast<URaw_>(raw) << UNUSED_BITS)) >> UNUSED_BITS);
+            return raw;
+        }
+
+        /**
+         * @brief Apply sign to rounded magnitude and wrap.
+         *
+         * @param[in] magnitude rounded magnitude.
+         * @param[in] isNegative result is negative.
+         * @return RawType wrapped raw value.
+         */
+        [[nodiscard]] static inline constexpr RawType signedResult_(std::uint64_t magnitude, bool isNegative) noexcept
+        {
+            return wrap_(isNegative ? 0 - magnitude : magnitude);
+        }
+
+    public:
+
+        /// @brief Zero.
+        inline constexpr Fixed() noexcept = default;
+
+        /**
+         * @brief Construct from builtin integer, wraps if out of range.
+         *
+         * @param[in] value value to convert.
+         */
+        template<std::integral Other>
+        inline constexpr Fixed(Other value) noexcept :
+            raw_(wrap_(static_cast<std::uint64_t>(static_cast<std::int64_t>(value)) << FracBits)) {}
+
+        /**
+         * @brief Construct from floating point value rounded by `Rounding`, saturates if out of range, 0 for NaN.
+         *
+         * @param[in] value value to convert.
+         */
+        template<std::floating_point Float>
+        inline constexpr Fixed(Float value) noexcept
+        {
+            constexpr Float scale = static_cast<Float>(ONE_);
+
+            // +-2^(BITS_ - 1), exact in floating point.
+            constexpr Float limit = static_cast<Float>(std::uint64_t{1} << (BITS_ - 1));
+
+            Float scaled = value * scale;
+
+            if(!(scaled == scaled))
+                raw_ = 0;
+            else if(scaled >= limit)
+                raw_ = max().raw_;
+            else if(scaled < -limit)
+                raw_ = lowest().raw_;
+            else
+            {
+                auto truncated = static_cast<std::int64_t>(scaled);
+                Float fraction = scaled - static_cast<Float>(truncated);
+                Float absFraction = (fraction < 0) ? -fraction : fraction;
+
+                auto fractionVsHalf = (absFraction < Float(0.5)) ? std::strong_ordering::less
+                    : ((absFraction > Float(0.5)) ? std::strong_ordering::greater : std::strong_ordering::equal);
+
+                bool isAway = impl_detail_::roundsAwayFromZero_<Rounding>(scaled < 0, (truncated & 1) != 0, fractionVsHalf, fraction != 0);
+
+                truncated += isAway ? ((scaled < 0) ? -1 : 1) : 0;
+
+                // rounding up to 2^(BITS_ - 1) saturates.
+                raw_ = (truncated > static_cast<std::int64_t>(max().raw_)) ? max().raw_ : static_cast<RawType>(truncated);
+            }
+        }
+
+        /**
+         * @brief Fixed point value with given raw representation.
+         *
+         * @param[in] raw raw value (`value * 2^FracBits`), wrapped to `IntBits + FracBits` bits.
+         * @return Fixed value.
+         */
+        [[nodiscard]] static inline constexpr Fixed fromRaw(RawType raw) noexcept
+        {
+            Fixed ret;
+            ret.raw_ = wrap_(static_cast<std::uint64_t>(static_cast<std::int64_t>(raw)));
+            return ret;
+        }
+
+        /// @brief Largest value.
+        [[nodiscard]] static inline constexpr Fixed max() noexcept { return fromRaw(static_cast<RawType>(nBitMask<std::uint64_t>(BITS_ - 1))); }
+
+        /// @brief Lowest (most negative) value.
+        [[nodiscard]] static inline constexpr Fixed lowest() noexcept { return fromRaw(static_cast<RawType>(-static_cast<std::int64_t>(nBitMask<std::uint64_t>(BITS_ - 1)) - 1)); }
+
+        /// @brief Smallest positive value, `2^-FracBits`.
+        [[nodiscard]] static inline constexpr Fixed epsilon() noexcept { return fromRaw(1); }
+
+        /// @brief Number of bits in representation (`NumericTraits` hook).
+        [[nodiscard]] static inline constexpr std::size_t bitSize() noexcept { return BITS_; }
+
+        /**
+         * @brief Check if `lhs + rhs > max` (`NumericTraits` hook), exact.
+         *
+         * @param[in] lhs left hand side.
+         * @param[in] rhs right hand side.
+         * @param[in] max maximum allowed value.
+         * @return true if addition overflows.
+         */
+        [[nodiscard]] static inline constexpr bool willAddOverflow(const Fixed& lhs, const Fixed& rhs, const Fixed& max) noexcept
+        {
+            // storage has a spare bit unless BITS_ is 8, 16, 32 or 64; the builtin flag covers those.
+            RawType sum;
+            if(impl_detail_::overflowingOperation_<impl_detail_::CheckedOperation_::ADD>(lhs.raw_, rhs.raw_, sum))
+                return rhs.raw_ > 0;
+            return sum > max.raw_;
+        }
+
+        /**
+         * @brief Check if `lhs - rhs < lowest` (`NumericTraits` hook), exact.
+         *
+         * @param[in] lhs left hand side.
+         * @param[in] rhs right hand side.
+         * @param[in] lowest lowest allowed value.
+         * @return true if subtraction underflows.
+         */
+        [[nodiscard]] static inline constexpr bool willSubtractUnderflow(const Fixed& lhs, const Fixed& rhs, const Fixed& lowest) noexcept
+        {
+            RawType difference;
+            if(impl_detail_::overflowingOperation_<impl_detail_::CheckedOperation_::SUBTRACT>(lhs.raw_, rhs.raw_, difference))
+                return rhs.raw_ > 0;
+            return difference < lowest.raw_;
+        }
+
+        /// @brief Raw value, `value * 2^FracBits`.
+        [[nodiscard]] inline constexpr RawType raw() const noexcept { return raw_; }
+
+        /// @brief Convert to builtin integer, truncates toward zero.
+        template<std::integral Other>
+        inline constexpr operator Other() const noexcept
+        {
+            if constexpr (FracBits == 0)
+                return static_cast<Other>(raw_);
+            else
+            {
+                // floor, then correct negative values with a fraction.
+                auto floor = static_cast<std::int64_t>(raw_) >> FracBits;
+                bool hasFraction = (static_cast<std::uint64_t>(static_cast<std::int64_t>(raw_)) & nBitMask<std::uint64_t>(FracBits)) != 0;
+                return static_cast<Other>(floor + ((raw_ < 0) & hasFraction));
+            }
+        }
+
+        /// @brief Convert to floating point.
+        template<std::floating_point Float>
+        inline constexpr operator Float() const noexcept { return static_cast<Float>(raw_) / static_cast<Float>(ONE_); }
+
+        inline constexpr Fixed& operator += (const Fixed& rhs) noexcept
+        {
+            raw_ = wrap_(static_cast<std::uint64_t>(static_cast<std::int64_t>(raw_)) + static_cast<std::uint64_t>(static_cast<std::int64_t>(rhs.raw_)));
+            return *this;
+        }
+
+        inline constexpr Fixed& operator -= (const Fixed& rhs) noexcept
+        {
+            raw_ = wrap_(static_cast<std::uint64_t>(static_cast<std::int64_t>(raw_)) - static_cast<std::uint64_t>(static_cast<std::int64_t>(rhs.raw_)));
+            return *this;
+        }
+
+        /// @brief Multiply, exact double width product rounded by `Rounding`.
+        inline constexpr Fixed& operator *= (const Fixed& rhs) noexcept
+        {
+            bool isNegative = (raw_ < 0) != (rhs.raw_ < 0);
+            auto lhsMagnitude = impl_detail_::magnitude_(raw_), rhsMagnitude = impl_detail_::magnitude_(rhs.raw_);
+
+            std::uint64_t quotient, remainder;
+
+            if constexpr (BITS_ <= 32)
+            {
+                auto product = lhsMagnitude * rhsMagnitude;
+                quotient = product >> FracBits;
+                remainder = product & nBitMask<std::uint64_t>(FracBits);
+            }
+            else
+            {
+                std::uint64_t high;
+                auto low = impl_detail_::multiplyFull64_(lhsMagnitude, rhsMagnitude, high);
+
+                if constexpr (FracBits == 0)
+                    quotient = low;
+                else
+                    quotient = (low >> FracBits) | (high << (64 - FracBits));
+
+                remainder = low & nBitMask<std::uint64_t>(FracBits);
+            }
+
+            constexpr std::uint64_t half = (FracBits == 0) ? 0 : ONE_ / 2;
+
+            quotient += impl_detail_::roundsAwayFromZero_<Rounding>(isNegative, quotient & 1, remainder <=> half, remainder != 0);
+            raw_ = signedResult_(quotient, isNegative);
+            return *this;
+        }
+
+        /// @brief Divide, exact quotient rounded by `Rounding`, requires `rhs != 0`.
+        inline constexpr Fixed& operator /= (const Fixed& rhs) noexcept
+        {
+            bool isNegative = (raw_ < 0) != (rhs.raw_ < 0);
+            auto lhsMagnitude = impl_detail_::magnitude_(raw_), divisor = impl_detail_::magnitude_(rhs.raw_);
+
+            std::uint64_t quotient, remainder;
+
+            if constexpr (BITS_ <= 32)
+            {
+                auto dividend = lhsMagnitude << FracBits;
+                quotient = dividend / divisor;
+                remainder = dividend % divisor;
+            }
+            else if constexpr (FracBits == 0)
+            {
+                quotient = lhsMagnitude / divisor;
+                remainder = lhsMagnitude % divisor;
+            }
+            else
+                quotient = impl_detail_::divideFull64_(lhsMagnitude >> (64 - FracBits), lhsMagnitude << FracBits, divisor, remainder);
+
+            // remainder < divisor <= 2^63, doubling cannot overflow.
+            quotient += impl_detail_::roundsAwayFromZero_<Rounding>(isNegative, quotient & 1, (remainder * 2) <=> divisor, remainder != 0);
+            raw_ = signedResult_(quotient, isNegative);
+            return *this;
+        }
+
+        inline constexpr Fixed& operator ++ () noexcept { return *this += Fixed(1); }
+
+        inline constexpr Fixed& operator -- () noexcept { return *this -= Fixed(1); }
+
+        inline constexpr Fixed operator ++ (int) noexcept
+        {
+            auto ret = *this;
+            ++(*this);
+            return ret;
+        }
+
+        inline constexpr Fixed operator -- (int) noexcept
+        {
+            auto ret = *this;
+            --(*this);
+            return ret;
+        }
+
+        [[nodiscard]] inline constexpr Fixed operator - () const noexcept { return Fixed() -= *this; }
+
+        [[nodiscard]] inline constexpr Fixed operator + () const noexcept { return *this; }
+
+        [[nodiscard]] friend inline constexpr Fixed operator + (Fixed lhs, const Fixed& rhs) noexcept { return lhs += rhs; }
+        [[nodiscard]] friend inline constexpr Fixed operator - (Fixed lhs, const Fixed& rhs) noexcept { return lhs -= rhs; }
+        [[nodiscard]] friend inline constexpr Fixed operator * (Fixed lhs, const Fixed& rhs) noexcept { return lhs *= rhs; }
+        [[nodiscard]] friend inline constexpr Fixed operator / (Fixed lhs, const Fixed& rhs) noexcept { return lhs /= rhs; }
+
+        /*
+         * Mixed operand overloads, exact matches so that builtin operators
+         * (reachable through the implicit conversions) are not ambiguous.
+         */
+
+        template<class Other> requires std::integral<Other> || std::floating_point<Other>
+        [[nodiscard]] friend inline constexpr Fixed operator + (Fixed lhs, Other rhs) noexcept { return lhs += Fixed(rhs); }
+        template<class Other> requires std::integral<Other> || std::floating_point<Other>
+        [[nodiscard]] friend inline constexpr Fixed operator + (Other lhs, const Fixed& rhs) noexcept { return Fixed(lhs) += rhs; }
+        template<class Other> requires std::integral<Other> || std::floating_point<Other>
+        [[nodiscard]] friend inline constexpr Fixed operator - (Fixed lhs, Other rhs) noexcept { return lhs -= Fixed(rhs); }
+        template<class Other> requires std::integral<Other> || std::floating_point<Other>
+        [[nodiscard]] friend inline constexpr Fixed operator - (Other lhs, const Fixed& rhs) noexcept { return Fixed(lhs) -= rhs; }
+        template<class Other> requires std::integral<Other> || std::floating_point<Other>
+        [[nodiscard]] friend inline constexpr Fixed operator * (Fixed lhs, Other rhs) noexcept { return lhs *= Fixed(rhs); }
+        template<class Other> requires std::integral<Other> || std::floating_point<Other>
+        [[nodiscard]] friend inline constexpr Fixed operator * (Other lhs, const Fixed& rhs) noexcept { return Fixed(lhs) *= rhs; }
+        template<class Other> requires std::integral<Other> || std::floating_point<Other>
+        [[nodiscard]] friend inline constexpr Fixed operator / (Fixed lhs, Other rhs) noexcept { return lhs /= Fixed(rhs); }
+        template<class Other> requires std::integral<Other> || std::floating_point<Other>
+        [[nodiscard]] friend inline constexpr Fixed operator / (Other lhs, const Fixed& rhs) noexcept { return Fixed(lhs) /= rhs; }
+
+        [[nodiscard]] friend inline constexpr bool operator == (const Fixed& lhs, const Fixed& rhs) noexcept { return lhs.raw_ == rhs.raw_; }
+
+        [[nodiscard]] friend inline constexpr std::strong_ordering operator <=> (const Fixed& lhs, const Fixed& rhs) noexcept { return lhs.raw_ <=> rhs.raw_; }
+
+        template<std::integral Other>
+        [[nodiscard]] friend inline constexpr bool operator == (const Fixed& lhs, Other rhs) noexcept { return (lhs <=> rhs) == 0; }
+
+        /// @brief Exact comparison with builtin integer (integer part first, then fraction).
+        template<std::integral Other>
+        [[nodiscard]] friend inline constexpr std::strong_ordering operator <=> (const Fixed& lhs, Other rhs) noexcept
+        {
+            auto floor = static_cast<std::int64_t>(lhs.raw_) >> FracBits;
+
+            if(std::cmp_less(floor, rhs))
+                return std::strong_ordering::less;
+            else if(std::cmp_greater(floor, rhs))
+                return std::strong_ordering::greater;
+            else if constexpr (FracBits != 0)
+                return ((static_cast<std::uint64_t>(static_cast<std::int64_t>(lhs.raw_)) & nBitMask<std::uint64_t>(FracBits)) != 0)
+                    ? std::strong_ordering::greater : std::strong_ordering::equal;
+            else
+                return std::strong_ordering::equal;
+        }
+
+        template<std::floating_point Float>
+        [[nodiscard]] friend inline constexpr bool operator == (const Fixed& lhs, Float rhs) noexcept { return static_cast<long double>(lhs) == rhs; }
+
+        /// @brief Comparison with floating point through `long double`.
+        template<std::floating_point Float>
+        [[nodiscard]] friend inline constexpr std::partial_ordering operator <=> (const Fixed& lhs, Float rhs) noexcept
+        {
+            return static_cast<long double>(lhs) <=> static_cast<long double>(rhs);
+        }
+    };
+
+    namespace impl_detail_
+    {
+        /// @brief Check if type is a `Fixed` specialisation.
+        template<class Type>
+        constexpr bool isFixed_ = false;
+
+        template<std::size_t IntBits, std::size_t FracBits, FixedRounding Rounding>
+        constexpr bool isFixed_<Fixed<IntBits, FracBits, Rounding>> = true;
+
+#if defined(EASY_MATH_DISPATCH_AVX2)
+
+        /**
+         * @brief AVX2 fixed point multiply of 16 or 32 bit raw values (exact 32 / 64 bit lane products).
+         *
+         * Rounds the two's complement product `p` as `floor(p / 2^FracBits)` plus a correction from the sign
+         * and the remainder, equivalent to the magnitude rounding of `operator *=`.
+         *
+         * @tparam FixedType `Fixed` with 16 or 32 bit storage.
+         * @param[inout] lhs left hand side, the processed prefix is removed.
+         * @param[inout] rhs right hand side, the processed prefix is removed.
+         * @param[inout] result destination, the processed prefix is removed.
+         */
+        template<class FixedType>
+        EASY_MATH_TARGET_AVX2 inline void avx2FixedMultiply_(
+            std::span<const FixedType>& lhs, std::span<const FixedType>& rhs, std::span<FixedType>& result
+        ) noexcept
+        {
+            using RawType = typename FixedType::RawType;
+
+            constexpr std::size_t FRAC_BITS = FixedType::FRAC_BITS;
+            constexpr std::size_t UNUSED_BITS = 32 - FixedType::bitSize();
+            constexpr FixedRounding ROUNDING = FixedType::ROUNDING;
+
+            // 32 bit lanes: 16 bit raw values are widened, their products are exact in 32 bits.
+            constexpr std::size_t LANES = 8;
+
+            auto mask = _mm256_set1_epi32(static_cast<int>(nBitMask<std::uint32_t>(FRAC_BITS)));
+            auto half = _mm256_set1_epi32((FRAC_BITS == 0) ? 0 : static_cast<int>(std::uint32_t{1} << (FRAC_BITS - 1)));
+            auto one = _mm256_set1_epi32(1);
+
+            std::size_t i = 0;
+            for(; i + LANES <= lhs.size(); i += LANES)
+            {
+                __m256i quotient, remainder, isNegative;
+
+                if constexpr (sizeof(RawType) == 2)
+                {
+                    auto a = _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs.data() + i)));
+                    auto b = _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs.data() + i)));
+                    auto product = _mm256_mullo_epi32(a, b);
+
+                    quotient = _mm256_srai_epi32(product, FRAC_BITS);
+                    remainder = _mm256_and_si256(product, mask);
+                    isNegative = _mm256_srai_epi32(product, 31);
+                }
+                else
+                {
+                    auto a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lhs.data() + i));
+                    auto b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rhs.data() + i));
+
+                    // 64 bit products of even and odd lanes.
+                    auto even = _mm256_mul_epi32(a, b);
+                    auto odd = _mm256_mul_epi32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32));
+
+                    // low 32 bits of `p >> FRAC_BITS` need only logical shifts.
+                    quotient = _mm256_blend_epi32(_mm256_srli_epi64(even, FRAC_BITS), _mm256_slli_epi64(_mm256_srli_epi64(odd, FRAC_BITS), 32), 0xaa);
+                    remainder = _mm256_and_si256(_mm256_blend_epi32(even, _mm256_slli_epi64(odd, 32), 0xaa), mask);
+                    isNegative = _mm256_blend_epi32(_mm256_srli_epi64(_mm256_srai_epi32(even, 31), 32), _mm256_srai_epi32(odd, 31), 0xaa);
+                }
+
+                if constexpr (FRAC_BITS != 0)
+                {
+                    auto hasRemainder = _mm256_xor_si256(_mm256_cmpeq_epi32(remainder, _mm256_setzero_si256()), _mm256_set1_epi32(-1));
+                    auto isAboveHalf = _mm256_cmpgt_epi32(remainder, half);
+                    auto isHalf = _mm256_cmpeq_epi32(remainder, half);
+
+                    __m256i increment = _mm256_setzero_si256();
+
+                    if constexpr (ROUNDING == FixedRounding::TRUNCATE)
+                        increment = _mm256_and_si256(isNegative, hasRemainder);
+                    else if constexpr (ROUNDING == FixedRounding::NEAREST)
+                        increment = _mm256_or_si256(isAboveHalf, _mm256_andnot_si256(isNegative, isHalf));
+                    else if constexpr (ROUNDING == FixedRounding::NEAREST_EVEN)
+                        increment = _mm256_or_si256(isAboveHalf, _mm256_and_si256(isHalf, _mm256_cmpeq_epi32(_mm256_and_si256(quotient, one), one)));
+
+                    quotient = _mm256_sub_epi32(quotient, increment);
+                }
+
+                if constexpr (UNUSED_BITS != 0)
+                    quotient = _mm256_srai_epi32(_mm256_slli_epi32(quotient, UNUSED_BITS), UNUSED_BITS);
+
+                if constexpr (sizeof(RawType) == 2)
+                {
+                    auto packed = _mm256_permute4x64_epi64(_mm256_packs_epi32(quotient, quotient), 0x08);
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(result.data() + i), _mm256_castsi256_si128(packed));
+                }
+                else
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(result.data() + i), quotient);
+            }
+
+            lhs = lhs.subspan(i);
+            rhs = rhs.subspan(i, lhs.size());
+            result = result.subspan(i, lhs.size());
+        }
+
+#endif
+    }
+
+    /**
+     * @brief Element wise `result[i] = lhs[i] + rhs[i]` (wrapping), vectorises as a plain integer add.
+     *
+     * @tparam FixedType `Fixed` specialisation.
+     * @param[in] lhs left hand side.
+     * @param[in] rhs right hand side, requires `rhs.size() >= lhs.size()`.
+     * @param[out] result destination, requires `result.size() >= lhs.size()`, may alias `lhs` or `rhs`.
+     */
+    template<class FixedType>
+        requires impl_detail_::isFixed_<FixedType>
+    inline constexpr void fixedAdd(
+        std::type_identity_t<std::span<const FixedType>> lhs, std::type_identity_t<std::span<const FixedType>> rhs,
+        std::type_identity_t<std::span<FixedType>> result
+    ) noexcept
+    {
+        for(std::size_t i = 0; i < lhs.size(); ++i)
+            result[i] = lhs[i] + rhs[i];
+    }
+
+    /**
+     * @brief Element wise `result[i] = lhs[i] - rhs[i]` (wrapping), vectorises as a plain integer subtract.
+     *
+     * @tparam FixedType `Fixed` specialisation.
+     * @param[in] lhs left hand side.
+     * @param[in] rhs right hand side, requires `rhs.size() >= lhs.size()`.
+     * @param[out] result destination, requires `result.size() >= lhs.size()`, may alias `lhs` or `rhs`.
+     */
+    template<class FixedType>
+        requires impl_detail_::isFixed_<FixedType>
+    inline constexpr void fixedSubtract(
+        std::type_identity_t<std::span<const FixedType>> lhs, std::type_identity_t<std::span<const FixedType>> rhs,
+        std::type_identity_t<std::span<FixedType>> result
+    ) noexcept
+    {
+        for(std::size_t i = 0; i < lhs.size(); ++i)
+            result[i] = lhs[i] - rhs[i];
+    }
+
+    /**
+     * @brief Element wise `result[i] = lhs[i] * rhs[i]`, identical to `operator *`. 16 and 32 bit storage
+     * multiplies 8 values per AVX2 step.
+     *
+     * @tparam FixedType `Fixed` specialisation.
+     * @param[in] lhs left hand side.
+     * @param[in] rhs right hand side, requires `rhs.size() >= lhs.size()`.
+     * @param[out] result destination, requires `result.size() >= lhs.size()`, may alias `lhs` or `rhs`.
+     */
+    template<class FixedType>
+        requires impl_detail_::isFixed_<FixedType>
+    inline constexpr void fixedMultiply(
+        std::type_identity_t<std::span<const FixedType>> lhs, std::type_identity_t<std::span<const FixedType>> rhs,
+        std::type_identity_t<std::span<FixedType>> result
+    ) noexcept
+    {
+#if defined(EASY_MATH_DISPATCH_AVX2)
+        if constexpr ((sizeof(FixedType) == 2) || (sizeof(FixedType) == 4))
+            if(!std::is_constant_evaluated() && impl_detail_::useAvx2_())
+                impl_detail_::avx2FixedMultiply_<FixedType>(lhs, rhs, result);
+#endif
+
+        for(std::size_t i = 0; i < lhs.size(); ++i)
+            result[i] = lhs[i] * rhs[i];
+    }
+
+    /**
+     * @brief Element wise `result[i] = lhs[i] / rhs[i]`, identical to `operator /`.
+     *
+     * @tparam FixedType `Fixed` specialisation.
+     * @param[in] lhs left hand side.
+     * @param[in] rhs right hand side, requires `rhs.size() >= lhs.size()` and no zero values.
+     * @param[out] result destination, requires `result.size() >= lhs.size()`, may alias `lhs` or `rhs`.
+     */
+    template<class FixedType>
+        requires impl_detail_::isFixed_<FixedType>
+    inline constexpr void fixedDivide(
+        std::type_identity_t<std::span<const FixedType>> lhs, std::type_identity_t<std::span<const FixedType>> rhs,
+        std::type_identity_t<std::span<FixedType>> result
+    ) noexcept
+    {
+        for(std::size_t i = 0; i < lhs.size(); ++i)
+            result[i] = lhs[i] / rhs[i];
+    }
+}
+
+/// @brief `std::numeric_limits` for `easyMath::Fixed`, enables `NumericTraits`.
+template<std::size_t IntBits, std::size_t FracBits, easyMath::FixedRounding Rounding>
+struct std::numeric_limits<easyMath::Fixed<IntBits, FracBits, Rounding>>
+{
+    using FixedType_ = easyMath::Fixed<IntBits, FracBits, Rounding>;
+
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_signed = true;
+    static constexpr bool is_integer = false;
+    static constexpr bool is_exact = true;
+    static constexpr bool has_infinity = false;
+    static constexpr bool has_quiet_NaN = false;
+    static constexpr bool has_signaling_NaN = false;
+    static constexpr std::float_denorm_style has_denorm = std::denorm_absent;
+    static constexpr bool has_denorm_loss = false;
+    static constexpr std::float_round_style round_style =
+        (Rounding == easyMath::FixedRounding::TRUNCATE) ? std::round_toward_zero
+        : (Rounding == easyMath::FixedRounding::FLOOR) ? std::round_toward_neg_infinity : std::round_to_nearest;
+    static constexpr bool is_iec559 = false;
+    static constexpr bool is_bounded = true;
+    static constexpr bool is_modulo = true;
+    static constexpr int digits = static_cast<int>(IntBits + FracBits - 1);
+    static constexpr int digits10 = static_cast<int>((IntBits + FracBits - 1) * 30103 / 100000);
+    static constexpr int max_digits10 = 0;
+    static constexpr int radix = 2;
+    static constexpr int min_exponent = 0;
+    static constexpr int min_exponent10 = 0;
+    static constexpr int max_exponent = 0;
+    static constexpr int max_exponent10 = 0;
+    static constexpr bool traps = false;
+    static constexpr bool tinyness_before = false;
+
+    static constexpr FixedType_ min() noexcept { return FixedType_::lowest(); }
+    static constexpr FixedType_ lowest() noexcept { return FixedType_::lowest(); }
+    static constexpr FixedType_ max() noexcept { return FixedType_::max(); }
+    static constexpr FixedType_ epsilon() noexcept { return FixedType_::epsilon(); }
+    static constexpr FixedType_ round_error() noexcept
+    {
+        // 0.5, integer only types round exactly.
+        return (FracBits == 0) ? FixedType_() : FixedType_::fromRaw(static_cast<typename FixedType_::RawType>(std::int64_t{1} << (FracBits - (FracBits != 0))));
+    }
+    static constexpr FixedType_ infinity() noexcept { return {}; }
+    static constexpr FixedType_ quiet_NaN() noexcept { return {}; }
+    static constexpr FixedType_ signaling_NaN() noexcept { return {}; }
+    static constexpr FixedType_ denorm_min() noexcept { return {}; }
+};
+
+#endif // INCLUDE_EASYMATHLIB_FIXED_H_INCLUDED
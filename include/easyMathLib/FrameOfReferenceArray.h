@@ -0,0 +1,313 @@
+/**
+ * @file FrameOfReferenceArray.h
+ * @author Harith Manoj
+ * @brief Block wise delta / frame of reference compressed integer sequence.
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (C) Harith Manoj
+ *
+ *
+ *                      APACHE LICENSE 2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef INCLUDE_EASYMATHLIB_FRAMEOFREFERENCEARRAY_H_INCLUDED
+
+/// @brief include\easyMathLib\FrameOfReferenceArray.h Header Guard
+#define INCLUDE_EASYMATHLIB_FRAMEOFREFERENCEARRAY_H_INCLUDED
+
+#include <span>
+#include <bit>
+#include <array>
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <concepts>
+#include <algorithm>
+#include <type_traits>
+
+#include <easyMathLib/easyMath.h>
+#include <easyMathLib/simdSupport.h>
+#include <easyMathLib/bitPacking.h>
+#include <easyMathLib/parallelReduce.h>
+
+namespace easyMath
+{
+    namespace impl_detail_
+    {
+        /**
+         * @brief Pointer to `unpack<Bits, UInt>` for a width chosen at runtime.
+         *
+         * @tparam UInt unsigned value type.
+         */
+        template<class UInt>
+        using UnpackKernel_ = std::size_t (*)(std::span<const std::uint8_t>, std::span<UInt>) noexcept;
+
+        /**
+         * @brief Pointer to `pack<Bits, UInt>` for a width chosen at runtime.
+         *
+         * @tparam UInt unsigned value type.
+         */
+        template<class UInt>
+        using PackKernel_ = std::size_t (*)(std::span<const UInt>, std::span<std::uint8_t>) noexcept;
+
+        /**
+         * @brief `unpack` kernels indexed by width - 1.
+         *
+         * @tparam UInt unsigned value type.
+         * @tparam Bits widths - 1.
+         * @return std::array<UnpackKernel_<UInt>, sizeof...(Bits)> kernel table.
+         */
+        template<class UInt, std::size_t... Bits>
+        [[nodiscard]] inline constexpr std::array<UnpackKernel_<UInt>, sizeof...(Bits)> makeUnpackKernels_(std::index_sequence<Bits...>) noexcept
+        {
+            return {&unpack<Bits + 1, UInt>...};
+        }
+
+        /**
+         * @brief `pack` kernels indexed by width - 1.
+         *
+         * @tparam UInt unsigned value type.
+         * @tparam Bits widths - 1.
+         * @return std::array<PackKernel_<UInt>, sizeof...(Bits)> kernel table.
+         */
+        template<class UInt, std::size_t... Bits>
+        [[nodiscard]] inline constexpr std::array<PackKernel_<UInt>, sizeof...(Bits)> makePackKernels_(std::index_sequence<Bits...>) noexcept
+        {
+            return {&pack<Bits + 1, UInt>...};
+        }
+    }
+
+    /**
+     * @brief Immutable compressed sequence of unsigned integers, suited to mostly increasing columns
+     * (timestamps, sorted IDs).
+     *
+     * Values are split into blocks of `BLOCK_SIZE`. Each block stores a reference, a bit width and packed
+     * residuals, either of the values above the block minimum (frame of reference) or of the successive
+     * differences above the smallest (signed) difference (delta), whichever is narrower. Differences wrap, so
+     * a block with occasional steps back still delta codes.
+     * Any block decodes independently: one `unpack` of the chosen width followed by a vectorised prefix
+     * sum for delta blocks.
+     *
+     * @tparam UInt unsigned value type.
+     */
+    template<std::unsigned_integral UInt>
+        requires (!std::same_as<UInt, bool>)
+    class FrameOfReferenceArray
+    {
+    public:
+
+        /// @brief Values per block.
+        static constexpr std::size_t BLOCK_SIZE = 128;
+
+    private:
+
+        /// @brief Zero bytes after the last block so every block decodes on the unpack fast path.
+        static constexpr std::size_t PADDING_BYTES_ = 80;
+
+        /// @brief Per block header, offset, width and mode share one word (24 bytes for 64 bit values).
+        struct Block_
+        {
+            /// @brief First value (delta) or minimum value (frame of reference).
+            UInt reference;
+
+            /// @brief Smallest difference as a signed value, stored wrapped (delta), zero otherwise.
+            UInt minDelta;
+
+            /// @brief Offset of packed residuals in `bytes_`.
+            std::uint64_t byteOffset : 56;
+
+            /// @brief Residual width in bits, 0 if all residuals are zero.
+            std::uint64_t width : 7;
+
+            /// @brief Residuals are differences rather than values.
+            std::uint64_t isDelta : 1;
+        };
+
+        /// @brief `unpack` kernels indexed by width - 1.
+        static constexpr auto UNPACK_KERNELS_ = impl_detail_::makeUnpackKernels_<UInt>(std::make_index_sequence<bitSize<UInt>()>{});
+
+        /// @brief `pack` kernels indexed by width - 1.
+        static constexpr auto PACK_KERNELS_ = impl_detail_::makePackKernels_<UInt>(std::make_index_sequence<bitSize<UInt>()>{});
+
+        /// @brief Block headers.
+        std::vector<Block_> blocks_;
+
+        /// @brief Packed residuals of all blocks followed by `PADDING_BYTES_` zero bytes.
+        std::vector<std::uint8_t> bytes_;
+
+        /// @brief Number of values.
+        std::size_t size_ = 0;
+
+        /**
+         * @brief Append one block.
+         *
+         * @param[in] values block values, 1 to `BLOCK_SIZE` values.
+         */
+        inline constexpr void encodeBlock_(std::span<const UInt> values)
+        {
+            auto [minIt, maxIt] = std::minmax_element(values.begin(), values.end());
+
+            Block_ block{*minIt, 0, bytes_.size(), static_cast<std::uint8_t>(std::bit_width(static_cast<UInt>(*maxIt - *minIt))), false};
+
+            std::array<UInt, BLOCK_SIZE> residuals{};
+            std::size_t residualCount = values.size();
+
+            if(values.size() > 1)
+            {
+                // differences wrap, ordered as signed so a few steps back only widen the span slightly.
+                using Signed = std::make_signed_t<UInt>;
+
+                auto minDelta = NumericTraits<Signed>::max(), maxDelta = NumericTraits<Signed>::lowest();
+                for(std::size_t i = 1; i < values.size(); ++i)
+                {
+                    auto delta = static_cast<Signed>(static_cast<UInt>(values[i] - values[i - 1]));
+                    minDelta = std::min(minDelta, delta);
+                    maxDelta = std::max(maxDelta, delta);
+                }
+
+                auto width = static_cast<std::uint8_t>(std::bit_width(static_cast<UInt>(static_cast<UInt>(maxDelta) - static_cast<UInt>(minDelta))));
+
+                if(width < block.width)
+                {
+                    block = {values[0], static_cast<UInt>(minDelta), bytes_.size(), width, true};
+                    residualCount = values.size() - 1;
+
+                    for(std::size_t i = 1; i < values.size(); ++i)
+                        residuals[i - 1] = static_cast<UInt>(values[i] - values[i - 1] - block.minDelta);
+                }
+            }
+
+            if(!block.isDelta)
+                for(std::size_t i = 0; i < values.size(); ++i)
+                    residuals[i] = static_cast<UInt>(values[i] - block.reference);
+
+            if(block.width != 0)
+            {
+                bytes_.resize(bytes_.size() + divideRoundUp<std::size_t>(residualCount * block.width, 8));
+                PACK_KERNELS_[block.width - 1](std::span<const UInt>(residuals.data(), residualCount), std::span(bytes_).subspan(block.byteOffset));
+            }
+
+            blocks_.push_back(block);
+        }
+
+    public:
+
+        /// @brief Empty sequence.
+        inline constexpr FrameOfReferenceArray() = default;
+
+        /**
+         * @brief Compress `values`.
+         *
+         * @param[in] values values to compress.
+         */
+        inline constexpr explicit FrameOfReferenceArray(std::span<const UInt> values) : size_(values.size())
+        {
+            blocks_.reserve(divideRoundUp(values.size(), BLOCK_SIZE));
+
+            for(std::size_t i = 0; i < values.size(); i += BLOCK_SIZE)
+                encodeBlock_(values.subspan(i, std::min(BLOCK_SIZE, values.size() - i)));
+
+            bytes_.resize(bytes_.size() + PADDING_BYTES_);
+            bytes_.shrink_to_fit();
+        }
+
+        /// @brief Number of values.
+        [[nodiscard]] inline constexpr std::size_t size() const noexcept { return size_; }
+
+        /// @brief Number of blocks.
+        [[nodiscard]] inline constexpr std::size_t blockCount() const noexcept { return blocks_.size(); }
+
+        /// @brief Residual width in bits of a block, requires `block < blockCount()`.
+        [[nodiscard]] inline constexpr std::size_t blockWidth(std::size_t block) const noexcept { return blocks_[block].width; }
+
+        /// @brief Bytes used by headers and packed residuals.
+        [[nodiscard]] inline constexpr std::size_t byteSize() const noexcept { return blocks_.size() * sizeof(Block_) + bytes_.size(); }
+
+        /**
+         * @brief Decode a single block.
+         *
+         * @param[in] block block index, requires `block < blockCount()`.
+         * @param[out] values destination, requires room for `BLOCK_SIZE` values (fewer for the last block).
+         * @return std::size_t number of values decoded, `BLOCK_SIZE` except for the last block.
+         */
+        inline constexpr std::size_t decodeBlock(std::size_t block, std::span<UInt> values) const noexcept
+        {
+            const auto& header = blocks_[block];
+            std::size_t count = std::min(BLOCK_SIZE, size_ - block * BLOCK_SIZE);
+
+            auto residuals = header.isDelta ? values.subspan(1, count - 1) : values.first(count);
+
+            if(header.width != 0)
+                UNPACK_KERNELS_[header.width - 1](std::span(bytes_).subspan(header.byteOffset), residuals);
+            else
+                std::fill(residuals.begin(), residuals.end(), UInt(0));
+
+            if(header.isDelta)
+            {
+                values[0] = header.reference;
+                static_cast<void>(impl_detail_::prefixSum_<false, UInt>(residuals, residuals, header.reference, header.minDelta));
+            }
+            else
+            {
+                for(auto& value : residuals)
+                    value = static_cast<UInt>(value + header.reference);
+            }
+
+            return count;
+        }
+
+        /**
+         * @brief Decode all values.
+         *
+         * @param[out] values destination, requires `values.size() >= size()`.
+         */
+        inline constexpr void decode(std::span<UInt> values) const noexcept
+        {
+            for(std::size_t block = 0; block < blocks_.size(); ++block)
+                decodeBlock(block, values.subspan(block * BLOCK_SIZE));
+        }
+
+        /**
+         * @brief Decode all values into a new vector.
+         *
+         * @return std::vector<UInt> decoded values.
+         */
+        [[nodiscard]] inline constexpr std::vector<UInt> decode() const
+        {
+            std::vector<UInt> values(size_);
+            decode(values);
+            return values;
+        }
+
+        /**
+         * @brief Value at index (decodes the containing block).
+         *
+         * @param[in] index position, requires `index < size()`.
+         * @return UInt value.
+         */
+        [[nodiscard]] inline constexpr UInt get(std::size_t index) const noexcept
+        {
+            std::array<UInt, BLOCK_SIZE> values{};
+            decodeBlock(index / BLOCK_SIZE, values);
+            return values[index % BLOCK_SIZE];
+        }
+
+        /// @brief Value at index, requires `index < size()`.
+        [[nodiscard]] inline constexpr UInt operator[](std::size_t index) const noexcept { return get(index); }
+    };
+}
+
+#endif // INCLUDE_EASYMATHLIB_FRAMEOFREFERENCEARRAY_H_INCLUDED
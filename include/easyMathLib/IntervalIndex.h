@@ -0,0 +1,369 @@
+/**
+ * @file IntervalIndex.h
+ * @author Harith Manoj
+ * @brief Immutable cache friendly lookup of the interval holding a value and span bucketization.
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (C) Harith Manoj
+ *
+ *
+ *                      APACHE LICENSE 2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef INCLUDE_EASYMATHLIB_INTERVALINDEX_H_INCLUDED
+
+/// @brief include\easyMathLib\IntervalIndex.h Header Guard
+#define INCLUDE_EASYMATHLIB_INTERVALINDEX_H_INCLUDED
+
+#include <span>
+#include <bit>
+#include <vector>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <concepts>
+#include <algorithm>
+#include <type_traits>
+
+#include <easyMathLib/easyMath.h>
+#include <easyMathLib/simdSupport.h>
+
+namespace easyMath
+{
+    namespace impl_detail_
+    {
+        /**
+         * @brief Allocator aligning storage to cache lines (64 bytes).
+         *
+         * @tparam T element type.
+         */
+        template<class T>
+        struct CacheLineAllocator_
+        {
+            /// @brief Element type.
+            using value_type = T;
+
+            /// @brief Cache line size.
+            static constexpr std::size_t ALIGNMENT = 64;
+
+            inline constexpr CacheLineAllocator_() noexcept = default;
+
+            template<class U>
+            inline constexpr CacheLineAllocator_(const CacheLineAllocator_<U>&) noexcept {}
+
+            /// @brief Allocate `count` elements.
+            [[nodiscard]] inline constexpr T* allocate(std::size_t count)
+            {
+                if(std::is_constant_evaluated())
+                    return std::allocator<T>{}.allocate(count);
+                return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t{ALIGNMENT}));
+            }
+
+            /// @brief Release `count` elements at `pointer`.
+            inline constexpr void deallocate(T* pointer, std::size_t count) noexcept
+            {
+                if(std::is_constant_evaluated())
+                    return std::allocator<T>{}.deallocate(pointer, count);
+                ::operator delete(pointer, count * sizeof(T), std::align_val_t{ALIGNMENT});
+            }
+
+            template<class U>
+            [[nodiscard]] inline constexpr bool operator==(const CacheLineAllocator_<U>&) const noexcept { return true; }
+        };
+    }
+
+    /**
+     * @brief Interval bound type usable with `IntervalIndex` (eg: integers, floating point, `WideUInt`).
+     *
+     * @tparam T type to check.
+     */
+    template<class T>
+    concept IntervalBound = std::totally_ordered<T> && std::semiregular<T>;
+
+    /**
+     * @brief Immutable index of sorted, non overlapping inclusive intervals `[lower, upper]`, finds the interval
+     * holding a value (same as a linear scan of `valueBetweenInclusive`) in O(log n).
+     *
+     * Lower bounds are stored in Eytzinger (breadth first) order, children of node `k` at `2k` and `2k + 1`, so the
+     * top levels share a few cache lines and the descent is a branch free compare and shift. Descendants four
+     * levels down (one cache line of 4 byte bounds) are prefetched at every step. `bucketize` descends a group of
+     * values level by level so their cache misses overlap.
+     *
+     * @tparam T bound type.
+     */
+    template<IntervalBound T>
+    class IntervalIndex
+    {
+    public:
+
+        /// @brief Bucket (interval) index type.
+        using BucketId = std::uint32_t;
+
+        /// @brief Bucket of values outside every interval.
+        static constexpr BucketId NO_BUCKET = ~BucketId{0};
+
+    private:
+
+        /// @brief Node distance to the prefetched descendants, about one cache line of bounds.
+        static constexpr std::size_t PREFETCH_STRIDE_ = std::bit_floor(std::max<std::size_t>(1, 64 / sizeof(T)));
+
+        /// @brief Values descended together by `forEachBucket_`.
+        static constexpr std::size_t GROUP_ = 16;
+
+        /// @brief Lower bounds in Eytzinger order from index 1, padded to a power of 2 so the last level reads stay in bounds.
+        std::vector<T, impl_detail_::CacheLineAllocator_<T>> tree_;
+
+        /// @brief Interval before the node (in sorted order) for each node, `size_` if none, index 0 is past every node.
+        std::vector<BucketId> predecessor_;
+
+        /// @brief Upper bounds in sorted order, one extra entry read for `size_`.
+        std::vector<T> uppers_;
+
+        /// @brief Number of intervals.
+        std::size_t size_ = 0;
+
+        /// @brief Number of tree levels, all but the last one full.
+        std::size_t depth_ = 0;
+
+        /**
+         * @brief Fill subtree of `node` with in order bounds from `rank`.
+         *
+         * @param[in] lowers sorted lower bounds.
+         * @param[in] rank sorted index of the leftmost bound of the subtree.
+         * @param[in] node subtree root.
+         * @return std::size_t sorted index past the subtree.
+         */
+        inline constexpr std::size_t build_(std::span<const T> lowers, std::size_t rank, std::size_t node)
+        {
+            if(node > size_)
+                return rank;
+
+            rank = build_(lowers, rank, 2 * node);
+
+            tree_[node] = lowers[rank];
+            predecessor_[node] = static_cast<BucketId>((rank == 0) ? size_ : rank - 1);
+
+            return build_(lowers, rank + 1, 2 * node + 1);
+        }
+
+        /// @brief Child of `node` towards `value`.
+        [[nodiscard]] inline constexpr std::size_t step_(std::size_t node, const T& value) const noexcept
+        {
+            return 2 * node + static_cast<std::size_t>(tree_[node] <= value);
+        }
+
+        /// @brief Prefetch descendants of `node`, no effect in constant evaluation.
+        inline constexpr void prefetch_(std::size_t node) const noexcept
+        {
+            if(!std::is_constant_evaluated())
+                impl_detail_::prefetch_(tree_.data() + std::min(node * PREFETCH_STRIDE_, tree_.size() - 1));
+        }
+
+        /**
+         * @brief Last level step and bucket of the descent ending at `node`.
+         *
+         * @param[in] node node reached after `depth_ - 1` steps.
+         * @param[in] value value to locate.
+         * @return BucketId bucket holding `value`, `NO_BUCKET` if none.
+         */
+        [[nodiscard]] inline constexpr BucketId finish_(std::size_t node, const T& value) const noexcept
+        {
+            // the last level may be partial, nodes past `size_` end the descent.
+            std::size_t next = step_(node, value);
+            node = (node <= size_) ? next : node;
+
+            // strip right turns and the final left turn, leaving the first bound greater than `value`.
+            node >>= std::countr_one(node) + 1;
+
+            BucketId candidate = predecessor_[node];
+            bool inside = (candidate < size_) & (value <= uppers_[candidate]);
+            return inside ? candidate : NO_BUCKET;
+        }
+
+        /**
+         * @brief Call `consumer(i, bucket)` for each value, groups of values descend together.
+         *
+         * @tparam Consumer callable `void(std::size_t, BucketId)`.
+         * @param[in] values values to locate.
+         * @param[in] consumer bucket consumer.
+         */
+        template<class Consumer>
+        inline constexpr void forEachBucket_(std::span<const T> values, Consumer&& consumer) const noexcept
+        {
+            std::size_t i = 0;
+
+            for(; i + GROUP_ <= values.size(); i += GROUP_)
+            {
+                std::size_t nodes[GROUP_];
+                std::fill(nodes, nodes + GROUP_, std::size_t{1});
+
+                for(std::size_t level = 1; level < depth_; ++level)
+                    for(std::size_t j = 0; j < GROUP_; ++j)
+                    {
+                        prefetch_(nodes[j]);
+                        nodes[j] = step_(nodes[j], values[i + j]);
+                    }
+
+                for(std::size_t j = 0; j < GROUP_; ++j)
+                    consumer(i + j, finish_(nodes[j], values[i + j]));
+            }
+
+            for(const T& value : values.subspan(i))
+                consumer(i++, find(value));
+        }
+
+    public:
+
+        /// @brief Bound type.
+        using ValueType = T;
+
+        /// @brief Index without intervals.
+        inline constexpr IntervalIndex() : tree_(2), predecessor_(1, 0), uppers_(1) {}
+
+        /**
+         * @brief Index intervals `[lowers[i], uppers[i]]`.
+         *
+         * @param[in] lowers inclusive lower bounds, requires `lowers[i] <= uppers[i] < lowers[i + 1]`.
+         * @param[in] uppers inclusive upper bounds, requires same size as `lowers`, fewer than `NO_BUCKET` intervals.
+         */
+        inline constexpr IntervalIndex(std::span<const T> lowers, std::span<const T> uppers) :
+            tree_(std::max<std::size_t>(2, std::bit_ceil(lowers.size() + 1)), lowers.empty() ? T{} : lowers.front()),
+            predecessor_(lowers.size() + 1),
+            uppers_(uppers.begin(), uppers.end()),
+            size_(lowers.size()),
+            depth_(static_cast<std::size_t>(std::bit_width(lowers.size())))
+        {
+            uppers_.resize(size_ + 1, uppers_.empty() ? T{} : uppers_.front());
+
+            // all bounds less or equal: last interval.
+            predecessor_[0] = static_cast<BucketId>((size_ == 0) ? 0 : size_ - 1);
+            static_cast<void>(build_(lowers, 0, 1));
+        }
+
+        /// @brief Number of intervals (buckets).
+        [[nodiscard]] inline constexpr std::size_t bucketCount() const noexcept { return size_; }
+
+        /// @brief Whether there are no intervals.
+        [[nodiscard]] inline constexpr bool empty() const noexcept { return size_ == 0; }
+
+        /// @brief Inclusive upper bound of `bucket`, requires `bucket < bucketCount()`.
+        [[nodiscard]] inline constexpr const T& upper(BucketId bucket) const noexcept { return uppers_[bucket]; }
+
+        /**
+         * @brief Inclusive lower bound of `bucket`.
+         *
+         * @param[in] bucket requires `bucket < bucketCount()`.
+         * @return T lower bound.
+         */
+        [[nodiscard]] inline constexpr T lower(BucketId bucket) const noexcept
+        {
+            // the tree is also a search tree of sorted ranks, rank of a node is its predecessor + 1.
+            std::size_t node = 1;
+
+            while(node <= size_)
+            {
+                std::size_t rank = (predecessor_[node] == size_) ? 0 : predecessor_[node] + 1;
+                if(rank == bucket)
+                    break;
+                node = 2 * node + static_cast<std::size_t>(rank < bucket);
+            }
+
+            return tree_[node];
+        }
+
+        /**
+         * @brief Bucket holding `value`.
+         *
+         * @param[in] value value to locate.
+         * @return BucketId index of the interval holding `value`, `NO_BUCKET` if none.
+         */
+        [[nodiscard]] inline constexpr BucketId find(const T& value) const noexcept
+        {
+            std::size_t node = 1;
+
+            for(std::size_t level = 1; level < depth_; ++level)
+            {
+                prefetch_(node);
+                node = step_(node, value);
+            }
+
+            return finish_(node, value);
+        }
+
+        /// @brief Whether any interval holds `value`.
+        [[nodiscard]] inline constexpr bool contains(const T& value) const noexcept { return find(value) != NO_BUCKET; }
+
+        /**
+         * @brief Bucket of each value.
+         *
+         * @param[in] values values to locate.
+         * @param[out] buckets bucket of each value (`NO_BUCKET` if none), requires at least `values.size()` entries.
+         * @return std::size_t number of values inside an interval.
+         */
+        inline constexpr std::size_t bucketize(std::span<const T> values, std::span<BucketId> buckets) const noexcept
+        {
+            std::size_t count = 0;
+
+            forEachBucket_(values, [&](std::size_t i, BucketId bucket)
+            {
+                buckets[i] = bucket;
+                count += static_cast<std::size_t>(bucket != NO_BUCKET);
+            });
+
+            return count;
+        }
+
+        /**
+         * @brief Bucket of each value and bucket counts.
+         *
+         * @param[in] values values to locate.
+         * @param[out] buckets bucket of each value (`NO_BUCKET` if none), requires at least `values.size()` entries.
+         * @param[inout] histogram counts incremented per bucket, requires `bucketCount() + 1` entries, the last counts
+         * values outside every interval.
+         * @return std::size_t number of values inside an interval.
+         */
+        inline constexpr std::size_t bucketize(std::span<const T> values, std::span<BucketId> buckets, std::span<std::size_t> histogram) const noexcept
+        {
+            std::size_t count = 0;
+
+            forEachBucket_(values, [&](std::size_t i, BucketId bucket)
+            {
+                buckets[i] = bucket;
+                count += static_cast<std::size_t>(bucket != NO_BUCKET);
+                ++histogram[std::min<std::size_t>(bucket, size_)];
+            });
+
+            return count;
+        }
+
+        /**
+         * @brief Bucket counts only.
+         *
+         * @param[in] values values to locate.
+         * @param[inout] histogram counts incremented per bucket, requires `bucketCount() + 1` entries, the last counts
+         * values outside every interval.
+         */
+        inline constexpr void histogram(std::span<const T> values, std::span<std::size_t> histogram) const noexcept
+        {
+            forEachBucket_(values, [&](std::size_t, BucketId bucket)
+            {
+                ++histogram[std::min<std::size_t>(bucket, size_)];
+            });
+        }
+    };
+}
+
+#endif // INCLUDE_EASYMATHLIB_INTERVALINDEX_H_INCLUDED
@@ -0,0 +1,469 @@
+/**
+ * @file InvariantDivider.h
+ * @author Harith Manoj
+ * @brief Division by a runtime invariant denominator using precomputed multiply-shift reciprocals.
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (C) Harith Manoj
+ *
+ *
+ *                      APACHE LICENSE 2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef INCLUDE_EASYMATHLIB_INVARIANTDIVIDER_H_INCLUDED
+
+/// @brief include\easyMathLib\InvariantDivider.h Header Guard
+#define INCLUDE_EASYMATHLIB_INVARIANTDIVIDER_H_INCLUDED
+
+#include <span>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <type_traits>
+
+#include <easyMathLib/easyMath.h>
+#include <easyMathLib/simdSupport.h>
+#include <easyMathLib/WideUInt.h>
+
+namespace easyMath
+{
+    /**
+     * @brief Builtin integer usable with `InvariantDivider` (any signed or unsigned width, not `bool`).
+     *
+     * @tparam Integer type to check.
+     */
+    template<class Integer>
+    concept InvariantDivisible = std::integral<Integer> && !std::same_as<Integer, bool> && (sizeof(Integer) <= 8);
+
+    /**
+     * @brief Divide by a denominator fixed at runtime (eg: page size, shard count) without hardware division.
+     *
+     * Construction computes a multiply-shift reciprocal once (Granlund-Montgomery, as in libdivide),
+     * each division then costs a high multiply, an add and shifts.
+     * Results are identical to builtin `/`, `%` and `easyMath::divideRoundUp` for every numerator.
+     *
+     * Requires divisor to be non zero. Dividing the lowest signed value by -1 wraps (builtin is undefined).
+     *
+     * @tparam Integer builtin integer type.
+     */
+    template<InvariantDivisible Integer>
+    class InvariantDivider
+    {
+    public:
+
+        /// @brief Unsigned type of same width.
+        using UInt = std::make_unsigned_t<Integer>;
+
+    private:
+
+        /// @brief Width of `Integer` in bits.
+        static constexpr std::size_t WIDTH = sizeof(Integer) * 8;
+
+        /// @brief Divisor.
+        Integer divisor_;
+
+        /// @brief Reciprocal multiplier.
+        UInt magic_;
+
+        /// @brief Unsigned: shift of `(n - t)` (0 if divisor is 1, else 1). Signed: final arithmetic shift.
+        std::uint8_t shift_;
+
+        /// @brief Unsigned: final shift. Signed: unused.
+        std::uint8_t postShift_;
+
+        /// @brief Signed: all ones if numerator is to be added (or subtracted) to high product.
+        UInt addMask_;
+
+        /// @brief Signed: all ones if numerator is to be subtracted rathar than added.
+        UInt negateMask_;
+
+        /// @brief Signed: 1 if quotient is to be rounded towards zero, 0 for divisor +-1.
+        UInt roundMask_;
+
+        /// @brief High half of `lhs * rhs` (unsigned).
+        [[nodiscard]] static inline constexpr UInt multiplyHigh_(UInt lhs, UInt rhs) noexcept
+        {
+            if constexpr (WIDTH == 64)
+                return multiplyHigh64(lhs, rhs);
+            else
+                return static_cast<UInt>((static_cast<std::uint64_t>(lhs) * rhs) >> WIDTH);
+        }
+
+        /// @brief High half of `lhs * rhs` (signed, two's complement bits returned as unsigned).
+        [[nodiscard]] static inline constexpr UInt multiplyHighSigned_(UInt lhs, UInt rhs) noexcept
+        {
+            if constexpr (WIDTH == 64)
+            {
+                UInt lhsSign = UInt{0} - (lhs >> 63);
+                UInt rhsSign = UInt{0} - (rhs >> 63);
+                return multiplyHigh_(lhs, rhs) - (lhsSign & rhs) - (rhsSign & lhs);
+            }
+            else
+            {
+                auto product = static_cast<std::int64_t>(static_cast<Integer>(lhs)) * static_cast<Integer>(rhs);
+                return static_cast<UInt>(product >> WIDTH);
+            }
+        }
+
+        /// @brief Compute unsigned round up reciprocal `floor(2^W * (2^l - d) / d) + 1`, `l = ceil(log2(d))`.
+        inline constexpr void computeUnsigned_() noexcept
+        {
+            UInt divisor = static_cast<UInt>(divisor_);
+
+            if(divisor == 1)
+            {
+                magic_ = 0;
+                shift_ = 0;
+                postShift_ = 0;
+                return;
+            }
+
+            auto ceilLog = static_cast<std::size_t>(std::bit_width(static_cast<UInt>(divisor - 1)));
+
+            using Wide = std::conditional_t<(WIDTH < 64), std::uint64_t, WideUInt<128>>;
+
+            Wide numerator = (Wide(1u) << ceilLog) - Wide(divisor);
+            numerator = numerator << WIDTH;
+
+            magic_ = static_cast<UInt>(numerator / Wide(divisor) + Wide(1u));
+            shift_ = 1;
+            postShift_ = static_cast<std::uint8_t>(ceilLog - 1);
+        }
+
+        /// @brief Compute signed reciprocal (Hacker's Delight, figure 10-1).
+        inline constexpr void computeSigned_() noexcept
+        {
+            auto wrap = [](std::uint64_t value) { return static_cast<std::uint64_t>(static_cast<UInt>(value)); };
+
+            std::uint64_t unsignedDivisor = static_cast<UInt>(divisor_);
+            bool isNegative = divisor_ < 0;
+            std::uint64_t absolute = isNegative ? wrap(0 - unsignedDivisor) : unsignedDivisor;
+
+            if(absolute == 1)
+            {
+                magic_ = 0;
+                shift_ = 0;
+                addMask_ = ~UInt{0};
+                negateMask_ = isNegative ? ~UInt{0} : UInt{0};
+                roundMask_ = 0;
+                return;
+            }
+
+            std::uint64_t twoPower = std::uint64_t{1} << (WIDTH - 1);
+            std::uint64_t t = twoPower + (unsignedDivisor >> (WIDTH - 1));
+            std::uint64_t absoluteNc = wrap(t - 1 - t % absolute);
+            std::size_t power = WIDTH - 1;
+
+            std::uint64_t q1 = twoPower / absoluteNc;
+            std::uint64_t r1 = wrap(twoPower - q1 * absoluteNc);
+            std::uint64_t q2 = twoPower / absolute;
+            std::uint64_t r2 = wrap(twoPower - q2 * absolute);
+            std::uint64_t delta;
+
+            do
+            {
+                ++power;
+
+                q1 = wrap(2 * q1);
+                r1 = wrap(2 * r1);
+                if(r1 >= absoluteNc)
+                {
+                    q1 = wrap(q1 + 1);
+                    r1 = wrap(r1 - absoluteNc);
+                }
+
+                q2 = wrap(2 * q2);
+                r2 = wrap(2 * r2);
+                if(r2 >= absolute)
+                {
+                    q2 = wrap(q2 + 1);
+                    r2 = wrap(r2 - absolute);
+                }
+
+                delta = wrap(absolute - r2);
+            } while((q1 < delta) || ((q1 == delta) && (r1 == 0)));
+
+            std::uint64_t magic = wrap(q2 + 1);
+            if(isNegative)
+                magic = wrap(0 - magic);
+
+            magic_ = static_cast<UInt>(magic);
+            shift_ = static_cast<std::uint8_t>(power - WIDTH);
+
+            bool isMagicNegative = static_cast<Integer>(magic_) < 0;
+            bool isAdd = !isNegative && isMagicNegative;
+            bool isSubtract = isNegative && !isMagicNegative && (magic_ != 0);
+
+            addMask_ = (isAdd || isSubtract) ? ~UInt{0} : UInt{0};
+            negateMask_ = isSubtract ? ~UInt{0} : UInt{0};
+            roundMask_ = 1;
+        }
+
+#if defined(EASY_MATH_HAS_SSE2)
+
+        /// @brief SSE2 unsigned 32 bit quotient of 4 lanes.
+        [[nodiscard]] inline __m128i sse2DivideUnsigned32_(__m128i numerator) const noexcept
+        {
+            auto magic = _mm_set1_epi32(static_cast<int>(magic_));
+            auto even = _mm_srli_epi64(_mm_mul_epu32(numerator, magic), 32);
+            auto odd = _mm_mul_epu32(_mm_srli_epi64(numerator, 32), magic);
+            auto high = _mm_or_si128(even, _mm_and_si128(odd, _mm_set1_epi64x(static_cast<long long>(0xffffffff00000000ull))));
+
+            auto half = _mm_srl_epi32(_mm_sub_epi32(numerator, high), _mm_cvtsi32_si128(shift_));
+            return _mm_srl_epi32(_mm_add_epi32(high, half), _mm_cvtsi32_si128(postShift_));
+        }
+
+#endif
+
+#if defined(EASY_MATH_DISPATCH_AVX2)
+
+        /// @brief AVX2 32 bit quotient of 8 lanes.
+        [[nodiscard]] EASY_MATH_TARGET_AVX2 inline __m256i avx2Divide32_(__m256i numerator) const noexcept
+        {
+            auto magic = _mm256_set1_epi32(static_cast<int>(magic_));
+
+            if constexpr (std::is_unsigned_v<Integer>)
+            {
+                auto even = _mm256_srli_epi64(_mm256_mul_epu32(numerator, magic), 32);
+                auto odd = _mm256_mul_epu32(_mm256_srli_epi64(numerator, 32), magic);
+                auto high = _mm256_blend_epi32(even, odd, 0xaa);
+
+                auto half = _mm256_srl_epi32(_mm256_sub_epi32(numerator, high), _mm_cvtsi32_si128(shift_));
+                return _mm256_srl_epi32(_mm256_add_epi32(high, half), _mm_cvtsi32_si128(postShift_));
+            }
+            else
+            {
+                auto even = _mm256_srli_epi64(_mm256_mul_epi32(numerator, magic), 32);
+                auto odd = _mm256_mul_epi32(_mm256_srli_epi64(numerator, 32), magic);
+                auto high = _mm256_blend_epi32(even, odd, 0xaa);
+
+                auto negate = _mm256_set1_epi32(static_cast<int>(negateMask_));
+                auto addend = _mm256_sub_epi32(_mm256_xor_si256(numerator, negate), negate);
+                auto quotient = _mm256_add_epi32(high, _mm256_and_si256(addend, _mm256_set1_epi32(static_cast<int>(addMask_))));
+
+                quotient = _mm256_sra_epi32(quotient, _mm_cvtsi32_si128(shift_));
+                auto round = _mm256_and_si256(_mm256_srli_epi32(quotient, 31), _mm256_set1_epi32(static_cast<int>(roundMask_)));
+                return _mm256_add_epi32(quotient, round);
+            }
+        }
+
+        /**
+         * @brief AVX2 part of `batch_` for 32 bit lanes, 8 numerators per step.
+         *
+         * @return std::size_t number of numerators processed.
+         */
+        template<int Operation>
+        EASY_MATH_TARGET_AVX2 inline std::size_t avx2Batch_(std::span<const Integer> numerators, std::span<Integer> results) const noexcept
+        {
+            auto divisor = _mm256_set1_epi32(static_cast<int>(divisor_));
+            std::size_t i = 0;
+
+            for(; i + 8 <= numerators.size(); i += 8)
+            {
+                auto numerator = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(numerators.data() + i));
+                auto quotient = avx2Divide32_(numerator);
+
+                if constexpr (Operation != 0)
+                {
+                    auto remainder = _mm256_sub_epi32(numerator, _mm256_mullo_epi32(quotient, divisor));
+
+                    if constexpr (Operation == 1)
+                        quotient = remainder;
+                    else
+                    {
+                        auto isExact = _mm256_cmpeq_epi32(remainder, _mm256_setzero_si256());
+                        quotient = _mm256_sub_epi32(quotient, _mm256_andnot_si256(isExact, _mm256_set1_epi32(-1)));
+                    }
+                }
+
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(results.data() + i), quotient);
+            }
+
+            return i;
+        }
+
+#endif
+
+        /**
+         * @brief Apply `operation` to each numerator, vectorised for 32 bit lanes (AVX2 if allowed by
+         * `easyLib::cpuTier()`, else SSE2 for unsigned division).
+         *
+         * @tparam Operation 0: divide, 1: modulo, 2: divideRoundUp.
+         */
+        template<int Operation>
+        inline void batch_(std::span<const Integer> numerators, std::span<Integer> results) const noexcept
+        {
+            std::size_t i = 0;
+
+#if defined(EASY_MATH_DISPATCH_AVX2)
+            if constexpr (WIDTH == 32)
+                if(impl_detail_::useAvx2_())
+                    i = avx2Batch_<Operation>(numerators, results);
+#endif
+
+#if defined(EASY_MATH_HAS_SSE2)
+            if constexpr ((WIDTH == 32) && std::is_unsigned_v<Integer> && (Operation == 0))
+            {
+                if(impl_detail_::useSse2_())
+                {
+                    for(; i + 4 <= numerators.size(); i += 4)
+                    {
+                        auto numerator = _mm_loadu_si128(reinterpret_cast<const __m128i*>(numerators.data() + i));
+                        _mm_storeu_si128(reinterpret_cast<__m128i*>(results.data() + i), sse2DivideUnsigned32_(numerator));
+                    }
+                }
+            }
+#endif
+
+            for(; i < numerators.size(); ++i)
+            {
+                if constexpr (Operation == 0)
+                    results[i] = divide(numerators[i]);
+                else if constexpr (Operation == 1)
+                    results[i] = modulo(numerators[i]);
+                else
+                    results[i] = divideRoundUp(numerators[i]);
+            }
+        }
+
+    public:
+
+        /**
+         * @brief Precompute reciprocal of `divisor`.
+         *
+         * @param[in] divisor denominator, must be non zero.
+         */
+        inline constexpr explicit InvariantDivider(Integer divisor) noexcept :
+            divisor_(divisor), magic_(0), shift_(0), postShift_(0), addMask_(0), negateMask_(0), roundMask_(0)
+        {
+            if constexpr (std::is_unsigned_v<Integer>)
+                computeUnsigned_();
+            else
+                computeSigned_();
+        }
+
+        /// @brief Divisor the reciprocal was computed for.
+        [[nodiscard]] inline constexpr Integer divisor() const noexcept { return divisor_; }
+
+        /**
+         * @brief Quotient truncated towards zero, equivalent to `numerator / divisor()`.
+         *
+         * @param[in] numerator numerator of division.
+         * @return Integer quotient.
+         */
+        [[nodiscard]] inline constexpr Integer divide(Integer numerator) const noexcept
+        {
+            auto value = static_cast<UInt>(numerator);
+
+            if constexpr (std::is_unsigned_v<Integer>)
+            {
+                UInt high = multiplyHigh_(magic_, value);
+                UInt half = static_cast<UInt>(static_cast<UInt>(value - high) >> shift_);
+                return static_cast<Integer>(static_cast<UInt>(high + half) >> postShift_);
+            }
+            else
+            {
+                UInt addend = static_cast<UInt>(static_cast<UInt>(value ^ negateMask_) - negateMask_);
+                UInt quotient = static_cast<UInt>(multiplyHighSigned_(magic_, value) + (addend & addMask_));
+                quotient = static_cast<UInt>(static_cast<Integer>(quotient) >> shift_);
+                return static_cast<Integer>(static_cast<UInt>(quotient + ((quotient >> (WIDTH - 1)) & roundMask_)));
+            }
+        }
+
+        /**
+         * @brief Remainder, equivalent to `numerator % divisor()`.
+         *
+         * @param[in] numerator numerator of division.
+         * @return Integer remainder.
+         */
+        [[nodiscard]] inline constexpr Integer modulo(Integer numerator) const noexcept
+        {
+            auto quotient = static_cast<UInt>(divide(numerator));
+            return static_cast<Integer>(static_cast<UInt>(static_cast<UInt>(numerator) - static_cast<UInt>(quotient * static_cast<UInt>(divisor_))));
+        }
+
+        /**
+         * @brief Quotient incremented if remainder is non zero, equivalent to `easyMath::divideRoundUp(numerator, divisor())`.
+         *
+         * @param[in] numerator numerator of division.
+         * @return Integer rounded up quotient.
+         */
+        [[nodiscard]] inline constexpr Integer divideRoundUp(Integer numerator) const noexcept
+        {
+            auto quotient = static_cast<UInt>(divide(numerator));
+            auto remainder = static_cast<UInt>(static_cast<UInt>(numerator) - static_cast<UInt>(quotient * static_cast<UInt>(divisor_)));
+            return static_cast<Integer>(static_cast<UInt>(quotient + static_cast<UInt>(remainder != 0)));
+        }
+
+        /**
+         * @brief Divide each numerator, `quotients[i] = numerators[i] / divisor()`.
+         *
+         * Requires `quotients.size() >= numerators.size()`, may alias.
+         *
+         * @param[in] numerators numerators.
+         * @param[out] quotients destination of quotients.
+         */
+        inline void divide(std::span<const Integer> numerators, std::span<Integer> quotients) const noexcept
+        {
+            batch_<0>(numerators, quotients);
+        }
+
+        /**
+         * @brief Remainder of each numerator, `remainders[i] = numerators[i] % divisor()`.
+         *
+         * Requires `remainders.size() >= numerators.size()`, may alias.
+         *
+         * @param[in] numerators numerators.
+         * @param[out] remainders destination of remainders.
+         */
+        inline void modulo(std::span<const Integer> numerators, std::span<Integer> remainders) const noexcept
+        {
+            batch_<1>(numerators, remainders);
+        }
+
+        /**
+         * @brief Rounded up quotient of each numerator, `quotients[i] = divideRoundUp(numerators[i], divisor())`.
+         *
+         * Requires `quotients.size() >= numerators.size()`, may alias.
+         *
+         * @param[in] numerators numerators.
+         * @param[out] quotients destination of rounded up quotients.
+         */
+        inline void divideRoundUp(std::span<const Integer> numerators, std::span<Integer> quotients) const noexcept
+        {
+            batch_<2>(numerators, quotients);
+        }
+    };
+
+    /**
+     * @brief Get rounded up result of division by an invariant divisor.
+     *
+     * @tparam Integer Number type.
+     * @param[in] numerator numerator of division.
+     * @param[in] denominator precomputed denominator.
+     * @return Integer division result, identical to `divideRoundUp(numerator, denominator.divisor())`.
+     */
+    template<InvariantDivisible Integer>
+    [[nodiscard]] inline constexpr Integer divideRoundUp(
+        const Integer& numerator,
+        const InvariantDivider<Integer>& denominator
+    ) noexcept
+    {
+        return denominator.divideRoundUp(numerator);
+    }
+}
+
+#endif // INCLUDE_EASYMATHLIB_INVARIANTDIVIDER_H_INCLUDED
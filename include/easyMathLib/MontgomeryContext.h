@@ -0,0 +1,229 @@
+/**
+ * @file MontgomeryContext.h
+ * @author Harith Manoj
+ * @brief Division free modular multiplication and exponentiation for a fixed odd modulus.
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (C) Harith Manoj
+ *
+ *
+ *                      APACHE LICENSE 2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef INCLUDE_EASYMATHLIB_MONTGOMERYCONTEXT_H_INCLUDED
+
+/// @brief include\easyMathLib\MontgomeryContext.h Header Guard
+#define INCLUDE_EASYMATHLIB_MONTGOMERYCONTEXT_H_INCLUDED
+
+#include <concepts>
+#include <cstdint>
+
+#include <easyMathLib/easyMath.h>
+
+namespace easyMath
+{
+    /**
+     * @brief Builtin unsigned modulus type usable with `MontgomeryContext` (32 or 64 bit).
+     *
+     * @tparam UInt type to check.
+     */
+    template<class UInt>
+    concept MontgomeryModulus = std::unsigned_integral<UInt> && !std::same_as<UInt, bool> && ((sizeof(UInt) == 4) || (sizeof(UInt) == 8));
+
+    /**
+     * @brief Repeated multiplication modulo a modulus fixed at runtime (eg: hash prime, checksum modulus) without
+     * hardware division.
+     *
+     * Values are kept in Montgomery form `x * R mod N`, `R = 2^W`. Construction computes `N^-1 mod R` and
+     * `R^2 mod N` once, each `multiply` then costs three multiplies and a conditional add (REDC).
+     * `multiplyModulo` and `powerModulo` convert in and out for one off use on plain values.
+     *
+     * Requires odd modulus. Montgomery form values passed in must be reduced (less than modulus).
+     *
+     * @tparam UInt 32 or 64 bit unsigned type.
+     */
+    template<MontgomeryModulus UInt>
+    class MontgomeryContext
+    {
+        /// @brief Width of `UInt` in bits.
+        static constexpr std::size_t WIDTH = sizeof(UInt) * 8;
+
+        /// @brief Modulus `N`.
+        UInt modulus_;
+
+        /// @brief `N^-1 mod R`.
+        UInt inverse_;
+
+        /// @brief `R mod N`, Montgomery form of 1.
+        UInt one_;
+
+        /// @brief `R^2 mod N`, converts into Montgomery form.
+        UInt rSquared_;
+
+        /// @brief Full product `lhs * rhs`, returns low half, stores high half in `high`.
+        [[nodiscard]] static inline constexpr UInt multiplyFull_(UInt lhs, UInt rhs, UInt& high) noexcept
+        {
+            if constexpr (WIDTH == 64)
+                return multiplyFull64(lhs, rhs, high);
+            else
+            {
+                auto product = static_cast<std::uint64_t>(lhs) * rhs;
+                high = static_cast<UInt>(product >> 32);
+                return static_cast<UInt>(product);
+            }
+        }
+
+        /// @brief REDC: `(high * R + low) / R mod N`, requires `high < N`.
+        [[nodiscard]] inline constexpr UInt reduce_(UInt high, UInt low) const noexcept
+        {
+            // m * N matches low modulo R, so the low halves cancel without borrow.
+            UInt factor = static_cast<UInt>(low * inverse_);
+            UInt factorHigh;
+            static_cast<void>(multiplyFull_(factor, modulus_, factorHigh));
+
+            UInt result = static_cast<UInt>(high - factorHigh);
+            return (high < factorHigh) ? static_cast<UInt>(result + modulus_) : result;
+        }
+
+    public:
+
+        /// @brief Modulus type.
+        using ValueType = UInt;
+
+        /**
+         * @brief Precompute constants for `modulus`.
+         *
+         * @param[in] modulus modulus, requires odd.
+         */
+        inline constexpr explicit MontgomeryContext(UInt modulus) noexcept : modulus_{modulus}, inverse_{modulus}
+        {
+            // Newton iteration, N * N = 1 mod 8 and every step doubles the correct bits.
+            for(std::size_t bits = 3; bits < WIDTH; bits *= 2)
+                inverse_ = static_cast<UInt>(inverse_ * static_cast<UInt>(2 - modulus * inverse_));
+
+            one_ = static_cast<UInt>(static_cast<UInt>(0 - modulus) % modulus);
+
+            if constexpr (WIDTH == 64)
+                static_cast<void>(divideFull64(one_, 0, modulus, rSquared_));
+            else
+                rSquared_ = static_cast<UInt>((static_cast<std::uint64_t>(one_) << 32) % modulus);
+        }
+
+        /// @brief Modulus.
+        [[nodiscard]] inline constexpr UInt modulus() const noexcept { return modulus_; }
+
+        /// @brief 1 in Montgomery form.
+        [[nodiscard]] inline constexpr UInt one() const noexcept { return one_; }
+
+        /**
+         * @brief Convert into Montgomery form.
+         *
+         * @param[in] value any value, reduced modulo `modulus` first.
+         * @return UInt `value * R mod N`.
+         */
+        [[nodiscard]] inline constexpr UInt toMontgomery(UInt value) const noexcept
+        {
+            return multiply(static_cast<UInt>(value % modulus_), rSquared_);
+        }
+
+        /**
+         * @brief Convert out of Montgomery form.
+         *
+         * @param[in] value Montgomery form value.
+         * @return UInt `value * R^-1 mod N`.
+         */
+        [[nodiscard]] inline constexpr UInt fromMontgomery(UInt value) const noexcept
+        {
+            return reduce_(0, value);
+        }
+
+        /**
+         * @brief Montgomery product.
+         *
+         * @param[in] lhs Montgomery form value.
+         * @param[in] rhs Montgomery form value.
+         * @return UInt `lhs * rhs * R^-1 mod N`, Montgomery form of the product.
+         */
+        [[nodiscard]] inline constexpr UInt multiply(UInt lhs, UInt rhs) const noexcept
+        {
+            UInt high;
+            UInt low = multiplyFull_(lhs, rhs, high);
+            return reduce_(high, low);
+        }
+
+        /// @brief `(lhs + rhs) mod N` for reduced values (either form).
+        [[nodiscard]] inline constexpr UInt add(UInt lhs, UInt rhs) const noexcept
+        {
+            UInt gap = static_cast<UInt>(modulus_ - rhs);
+            return (lhs >= gap) ? static_cast<UInt>(lhs - gap) : static_cast<UInt>(lhs + rhs);
+        }
+
+        /// @brief `(lhs - rhs) mod N` for reduced values (either form).
+        [[nodiscard]] inline constexpr UInt subtract(UInt lhs, UInt rhs) const noexcept
+        {
+            UInt difference = static_cast<UInt>(lhs - rhs);
+            return (lhs < rhs) ? static_cast<UInt>(difference + modulus_) : difference;
+        }
+
+        /**
+         * @brief Montgomery exponentiation by squaring.
+         *
+         * @param[in] base Montgomery form base.
+         * @param[in] exponent exponent.
+         * @return UInt Montgomery form of `base ^ exponent`.
+         */
+        [[nodiscard]] inline constexpr UInt power(UInt base, std::uint64_t exponent) const noexcept
+        {
+            UInt result = one_;
+
+            for(; exponent != 0; exponent >>= 1)
+            {
+                if(exponent & 1)
+                    result = multiply(result, base);
+                base = multiply(base, base);
+            }
+
+            return result;
+        }
+
+        /**
+         * @brief `(lhs * rhs) mod N` of plain values.
+         *
+         * @param[in] lhs any value.
+         * @param[in] rhs any value.
+         * @return UInt plain product modulo `modulus`.
+         */
+        [[nodiscard]] inline constexpr UInt multiplyModulo(UInt lhs, UInt rhs) const noexcept
+        {
+            // (lhs * R) * rhs * R^-1 is already the plain product.
+            return multiply(toMontgomery(lhs), static_cast<UInt>(rhs % modulus_));
+        }
+
+        /**
+         * @brief `base ^ exponent mod N` of plain values.
+         *
+         * @param[in] base any value.
+         * @param[in] exponent exponent.
+         * @return UInt plain power modulo `modulus`.
+         */
+        [[nodiscard]] inline constexpr UInt powerModulo(UInt base, std::uint64_t exponent) const noexcept
+        {
+            return fromMontgomery(power(toMontgomery(base), exponent));
+        }
+    };
+}
+
+#endif // INCLUDE_EASYMATHLIB_MONTGOMERYCONTEXT_H_INCLUDED
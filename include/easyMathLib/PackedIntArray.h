@@ -0,0 +1,568 @@
+/**
+ * @file PackedIntArray.h
+ * @author Harith Manoj
+ * @brief Random access array of N-bit unsigned integers stored densely in 64 bit words.
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (C) Harith Manoj
+ *
+ *
+ *                      APACHE LICENSE 2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef INCLUDE_EASYMATHLIB_PACKEDINTARRAY_H_INCLUDED
+
+/// @brief include\easyMathLib\PackedIntArray.h Header Guard
+#define INCLUDE_EASYMATHLIB_PACKEDINTARRAY_H_INCLUDED
+
+#include <span>
+#include <bit>
+#include <vector>
+#include <compare>
+#include <cstdint>
+#include <iterator>
+#include <algorithm>
+#include <initializer_list>
+
+#include <easyMathLib/easyMath.h>
+
+namespace easyMath
+{
+    namespace impl_detail_
+    {
+        /**
+         * @brief Mask of lower `Bits` bits of a 64 bit word (valid for `Bits == 64`).
+         *
+         * @tparam Bits element width, 1 to 64.
+         */
+        template<std::size_t Bits>
+        constexpr std::uint64_t PACKED_ELEMENT_MASK_ = (Bits == 64) ? ~std::uint64_t{0} : nBitMask<std::uint64_t>(Bits);
+
+        /**
+         * @brief Number of words backing `size` elements, including one padding word so that
+         * every element can be read with two unconditional loads.
+         *
+         * @tparam Bits element width.
+         * @param[in] size element count.
+         * @return std::size_t word count.
+         */
+        template<std::size_t Bits>
+        [[nodiscard]] inline constexpr std::size_t packedWordCount_(std::size_t size) noexcept
+        {
+            return divideRoundUp<std::size_t>(size * Bits, 64) + 1;
+        }
+
+        /**
+         * @brief Read element `index`, straddling at most two words.
+         *
+         * @tparam Bits element width.
+         * @param[in] words padded word storage.
+         * @param[in] index element index.
+         * @return std::uint64_t element value.
+         */
+        template<std::size_t Bits>
+        [[nodiscard]] inline constexpr std::uint64_t packedGet_(const std::uint64_t* words, std::size_t index) noexcept
+        {
+            std::size_t bit = index * Bits;
+            std::size_t word = bit / 64;
+            std::size_t shift = bit % 64;
+
+            // double shift keeps shift count below 64 when the element does not straddle.
+            auto low = words[word] >> shift;
+            auto high = (words[word + 1] << 1) << (63 - shift);
+
+            return (low | high) & PACKED_ELEMENT_MASK_<Bits>;
+        }
+
+        /**
+         * @brief Overwrite element `index`.
+         *
+         * @tparam Bits element width.
+         * @param[inout] words padded word storage.
+         * @param[in] index element index.
+         * @param[in] value new value, bits above `Bits` are ignored.
+         */
+        template<std::size_t Bits>
+        inline constexpr void packedSet_(std::uint64_t* words, std::size_t index, std::uint64_t value) noexcept
+        {
+            constexpr auto mask = PACKED_ELEMENT_MASK_<Bits>;
+
+            std::size_t bit = index * Bits;
+            std::size_t word = bit / 64;
+            std::size_t shift = bit % 64;
+
+            value &= mask;
+
+            words[word] = (words[word] & ~(mask << shift)) | (value << shift);
+
+            auto highMask = (mask >> 1) >> (63 - shift);
+            words[word + 1] = (words[word + 1] & ~highMask) | ((value >> 1) >> (63 - shift));
+        }
+
+        /**
+         * @brief Random access iterator over packed elements.
+         *
+         * Constant iterators yield values, mutable iterators yield `PackedIntArray<Bits>::Reference` proxies.
+         *
+         * @tparam Bits element width.
+         * @tparam isConst true for read only iteration.
+         */
+        template<std::size_t Bits, bool isConst>
+        class PackedIterator_;
+    }
+
+    template<std::size_t Bits>
+        requires ((Bits > 0) && (Bits <= 64))
+    class PackedIntArray;
+
+    /**
+     * @brief Non owning read only view of packed N-bit elements (like `std::span` for `PackedIntArray`).
+     *
+     * @tparam Bits element width, 1 to 64.
+     */
+    template<std::size_t Bits>
+        requires ((Bits > 0) && (Bits <= 64))
+    class PackedIntView
+    {
+    public:
+
+        /// @brief Element type.
+        using value_type = SizeCapableUint<Bits>;
+
+        /// @brief Read only random access iterator.
+        using Iterator = impl_detail_::PackedIterator_<Bits, true>;
+
+    private:
+
+        /// @brief Padded word storage.
+        const std::uint64_t* words_ = nullptr;
+
+        /// @brief Number of elements.
+        std::size_t size_ = 0;
+
+    public:
+
+        /// @brief Empty view.
+        inline constexpr PackedIntView() noexcept = default;
+
+        /**
+         * @brief View `size` elements stored in `words`.
+         *
+         * @param[in] words storage in `PackedIntArray` layout, requires at least `PackedIntArray<Bits>::wordCount(size)` words.
+         * @param[in] size element count.
+         */
+        inline constexpr PackedIntView(std::span<const std::uint64_t> words, std::size_t size) noexcept :
+            words_(words.data()), size_(size) {}
+
+        /// @brief Number of elements.
+        [[nodiscard]] inline constexpr std::size_t size() const noexcept { return size_; }
+
+        /// @brief Check if view has no elements.
+        [[nodiscard]] inline constexpr bool empty() const noexcept { return size_ == 0; }
+
+        /// @brief Element at index, requires `index < size()`.
+        [[nodiscard]] inline constexpr value_type get(std::size_t index) const noexcept
+        {
+            return static_cast<value_type>(impl_detail_::packedGet_<Bits>(words_, index));
+        }
+
+        /// @brief Element at index, requires `index < size()`.
+        [[nodiscard]] inline constexpr value_type operator[](std::size_t index) const noexcept { return get(index); }
+
+        /// @brief Iterator to first element.
+        [[nodiscard]] inline constexpr Iterator begin() const noexcept { return Iterator(words_, 0); }
+
+        /// @brief End iterator.
+        [[nodiscard]] inline constexpr Iterator end() const noexcept { return Iterator(words_, size_); }
+
+        /// @brief Underlying words (padded).
+        [[nodiscard]] inline constexpr std::span<const std::uint64_t> words() const noexcept
+        {
+            return {words_, impl_detail_::packedWordCount_<Bits>(size_)};
+        }
+    };
+
+    /**
+     * @brief Dynamic array of N-bit unsigned integers, element i occupies bits `[i * Bits, (i + 1) * Bits)`
+     * of a little endian 64 bit word array.
+     *
+     * `get` / `set` are O(1) and touch at most two words (storage keeps a padding word so both loads are
+     * unconditional). Unused bits past the last element are always zero.
+     *
+     * @tparam Bits element width, 1 to 64.
+     */
+    template<std::size_t Bits>
+        requires ((Bits > 0) && (Bits <= 64))
+    class PackedIntArray
+    {
+    public:
+
+        /// @brief Element type, smallest unsigned integer holding `Bits` bits.
+        using value_type = SizeCapableUint<Bits>;
+
+        /// @brief Read only random access iterator.
+        using ConstIterator = impl_detail_::PackedIterator_<Bits, true>;
+
+        /// @brief Mutable random access iterator yielding `Reference` proxies.
+        using Iterator = impl_detail_::PackedIterator_<Bits, false>;
+
+        /// @brief Proxy reference to an element.
+        class Reference
+        {
+            /// @brief Padded word storage.
+            std::uint64_t* words_;
+
+            /// @brief Element index.
+            std::size_t index_;
+
+        public:
+
+            /**
+             * @brief Refer to element `index` of `words`.
+             *
+             * @param[in] words padded word storage.
+             * @param[in] index element index.
+             */
+            inline constexpr Reference(std::uint64_t* words, std::size_t index) noexcept : words_(words), index_(index) {}
+
+            /// @brief Read element.
+            inline constexpr operator value_type() const noexcept
+            {
+                return static_cast<value_type>(impl_detail_::packedGet_<Bits>(words_, index_));
+            }
+
+            /// @brief Write element, bits above `Bits` are ignored.
+            inline constexpr const Reference& operator=(value_type value) const noexcept
+            {
+                impl_detail_::packedSet_<Bits>(words_, index_, value);
+                return *this;
+            }
+
+            /// @brief Copy element value (not the reference).
+            inline constexpr const Reference& operator=(const Reference& other) const noexcept
+            {
+                return *this = static_cast<value_type>(other);
+            }
+        };
+
+    private:
+
+        /// @brief Padded word storage.
+        std::vector<std::uint64_t> words_;
+
+        /// @brief Number of elements.
+        std::size_t size_;
+
+        /// @brief Zero bits past the last element (invariant after shrinking).
+        inline constexpr void clearTail_() noexcept
+        {
+            std::size_t usedBits = size_ * Bits;
+            std::size_t lastWord = usedBits / 64;
+
+            if(usedBits % 64 != 0)
+                words_[lastWord] &= nBitMask<std::uint64_t>(usedBits % 64);
+            else
+                words_[lastWord] = 0;
+
+            std::fill(words_.begin() + static_cast<std::ptrdiff_t>(lastWord) + 1, words_.end(), std::uint64_t{0});
+        }
+
+    public:
+
+        /**
+         * @brief Number of words required to store `size` elements (including the padding word).
+         *
+         * @param[in] size element count.
+         * @return std::size_t word count.
+         */
+        [[nodiscard]] static inline constexpr std::size_t wordCount(std::size_t size) noexcept
+        {
+            return impl_detail_::packedWordCount_<Bits>(size);
+        }
+
+        /// @brief Empty array.
+        inline constexpr PackedIntArray() : words_(1, 0), size_(0) {}
+
+        /**
+         * @brief Array of `count` copies of `value`.
+         *
+         * @param[in] count element count.
+         * @param[in] value initial value of every element.
+         */
+        inline constexpr explicit PackedIntArray(std::size_t count, value_type value = 0) : words_(wordCount(count), 0), size_(count)
+        {
+            if(value != 0)
+                for(std::size_t i = 0; i < count; ++i)
+                    impl_detail_::packedSet_<Bits>(words_.data(), i, value);
+        }
+
+        /**
+         * @brief Array holding copies of `values`.
+         *
+         * @param[in] values initial elements.
+         */
+        inline constexpr explicit PackedIntArray(std::span<const value_type> values) : PackedIntArray()
+        {
+            append(values);
+        }
+
+        /**
+         * @brief Array holding copies of `values`.
+         *
+         * @param[in] values initial elements.
+         */
+        inline constexpr PackedIntArray(std::initializer_list<value_type> values) : PackedIntArray()
+        {
+            append(std::span<const value_type>(values.begin(), values.size()));
+        }
+
+        /// @brief Number of elements.
+        [[nodiscard]] inline constexpr std::size_t size() const noexcept { return size_; }
+
+        /// @brief Check if array has no elements.
+        [[nodiscard]] inline constexpr bool empty() const noexcept { return size_ == 0; }
+
+        /// @brief Reserve storage for `count` elements.
+        inline constexpr void reserve(std::size_t count) { words_.reserve(wordCount(count)); }
+
+        /// @brief Remove all elements.
+        inline constexpr void clear() noexcept { resize(0); }
+
+        /**
+         * @brief Change element count, new elements are set to `value`.
+         *
+         * @param[in] count new element count.
+         * @param[in] value value of appended elements.
+         */
+        inline constexpr void resize(std::size_t count, value_type value = 0)
+        {
+            std::size_t oldSize = size_;
+
+            words_.resize(wordCount(count), 0);
+            size_ = count;
+
+            if(count < oldSize)
+                clearTail_();
+            else if(value != 0)
+                for(std::size_t i = oldSize; i < count; ++i)
+                    impl_detail_::packedSet_<Bits>(words_.data(), i, value);
+        }
+
+        /// @brief Element at index, requires `index < size()`.
+        [[nodiscard]] inline constexpr value_type get(std::size_t index) const noexcept
+        {
+            return static_cast<value_type>(impl_detail_::packedGet_<Bits>(words_.data(), index));
+        }
+
+        /**
+         * @brief Overwrite element at index, requires `index < size()`.
+         *
+         * @param[in] index element index.
+         * @param[in] value new value, bits above `Bits` are ignored.
+         */
+        inline constexpr void set(std::size_t index, value_type value) noexcept
+        {
+            impl_detail_::packedSet_<Bits>(words_.data(), index, value);
+        }
+
+        /// @brief Element at index, requires `index < size()`.
+        [[nodiscard]] inline constexpr value_type operator[](std::size_t index) const noexcept { return get(index); }
+
+        /// @brief Proxy to element at index, requires `index < size()`.
+        [[nodiscard]] inline constexpr Reference operator[](std::size_t index) noexcept { return Reference(words_.data(), index); }
+
+        /**
+         * @brief Append one element.
+         *
+         * @param[in] value element to append, bits above `Bits` are ignored.
+         */
+        inline constexpr void pushBack(value_type value)
+        {
+            words_.resize(wordCount(size_ + 1), 0);
+            impl_detail_::packedSet_<Bits>(words_.data(), size_, value);
+            ++size_;
+        }
+
+        /// @brief Remove last element, requires `!empty()`.
+        inline constexpr void popBack() noexcept { resize(size_ - 1); }
+
+        /**
+         * @brief Append elements, storage grows once and elements are OR-ed into the zeroed tail.
+         *
+         * @param[in] values elements to append, bits above `Bits` are ignored.
+         */
+        inline constexpr void append(std::span<const value_type> values)
+        {
+            constexpr auto mask = impl_detail_::PACKED_ELEMENT_MASK_<Bits>;
+
+            words_.resize(wordCount(size_ + values.size()), 0);
+
+            auto* words = words_.data();
+            std::size_t bit = size_ * Bits;
+
+            for(auto value : values)
+            {
+                std::uint64_t element = static_cast<std::uint64_t>(value) & mask;
+                std::size_t word = bit / 64;
+                std::size_t shift = bit % 64;
+
+                words[word] |= element << shift;
+                words[word + 1] |= (element >> 1) >> (63 - shift);
+
+                bit += Bits;
+            }
+
+            size_ += values.size();
+        }
+
+        /// @brief Mutable iterator to first element.
+        [[nodiscard]] inline constexpr Iterator begin() noexcept { return Iterator(words_.data(), 0); }
+
+        /// @brief Mutable end iterator.
+        [[nodiscard]] inline constexpr Iterator end() noexcept { return Iterator(words_.data(), size_); }
+
+        /// @brief Read only iterator to first element.
+        [[nodiscard]] inline constexpr ConstIterator begin() const noexcept { return ConstIterator(words_.data(), 0); }
+
+        /// @brief Read only end iterator.
+        [[nodiscard]] inline constexpr ConstIterator end() const noexcept { return ConstIterator(words_.data(), size_); }
+
+        /// @brief Read only iterator to first element.
+        [[nodiscard]] inline constexpr ConstIterator cbegin() const noexcept { return begin(); }
+
+        /// @brief Read only end iterator.
+        [[nodiscard]] inline constexpr ConstIterator cend() const noexcept { return end(); }
+
+        /// @brief Read only view of all elements, invalidated by growth.
+        [[nodiscard]] inline constexpr PackedIntView<Bits> view() const noexcept { return PackedIntView<Bits>(words_, size_); }
+
+        /// @brief Implicit conversion to read only view.
+        inline constexpr operator PackedIntView<Bits>() const noexcept { return view(); }
+
+        /// @brief Underlying words (padded, `wordCount(size())` long).
+        [[nodiscard]] inline constexpr std::span<const std::uint64_t> words() const noexcept { return words_; }
+
+        /// @brief Element wise equality.
+        [[nodiscard]] friend inline constexpr bool operator==(const PackedIntArray& lhs, const PackedIntArray& rhs) noexcept
+        {
+            return (lhs.size_ == rhs.size_) && (lhs.words_ == rhs.words_);
+        }
+    };
+
+    namespace impl_detail_
+    {
+        template<std::size_t Bits, bool isConst>
+        class PackedIterator_
+        {
+        public:
+
+            using iterator_concept = std::random_access_iterator_tag;
+            using iterator_category = std::conditional_t<isConst, std::random_access_iterator_tag, std::input_iterator_tag>;
+            using value_type = SizeCapableUint<Bits>;
+            using difference_type = std::ptrdiff_t;
+            using reference = std::conditional_t<isConst, value_type, typename PackedIntArray<Bits>::Reference>;
+
+        private:
+
+            /// @brief Word pointer type.
+            using WordPointer = std::conditional_t<isConst, const std::uint64_t*, std::uint64_t*>;
+
+            /// @brief Padded word storage.
+            WordPointer words_ = nullptr;
+
+            /// @brief Element index.
+            std::size_t index_ = 0;
+
+        public:
+
+            /// @brief Singular iterator.
+            inline constexpr PackedIterator_() noexcept = default;
+
+            /**
+             * @brief Iterator to element `index` of `words`.
+             *
+             * @param[in] words padded word storage.
+             * @param[in] index element index.
+             */
+            inline constexpr PackedIterator_(WordPointer words, std::size_t index) noexcept : words_(words), index_(index) {}
+
+            /// @brief Mutable to read only conversion.
+            inline constexpr operator PackedIterator_<Bits, true>() const noexcept requires (!isConst)
+            {
+                return PackedIterator_<Bits, true>(words_, index_);
+            }
+
+            /// @brief Current element (value or proxy).
+            [[nodiscard]] inline constexpr reference operator*() const noexcept
+            {
+                if constexpr (isConst)
+                    return static_cast<value_type>(packedGet_<Bits>(words_, index_));
+                else
+                    return reference(words_, index_);
+            }
+
+            /// @brief Element at offset.
+            [[nodiscard]] inline constexpr reference operator[](difference_type offset) const noexcept { return *(*this + offset); }
+
+            /// @brief Step by one element.
+            inline constexpr PackedIterator_& operator++() noexcept { ++index_; return *this; }
+            inline constexpr PackedIterator_ operator++(int) noexcept { auto ret = *this; ++index_; return ret; }
+            inline constexpr PackedIterator_& operator--() noexcept { --index_; return *this; }
+            inline constexpr PackedIterator_ operator--(int) noexcept { auto ret = *this; --index_; return ret; }
+
+            /// @brief Step by `offset` elements.
+            inline constexpr PackedIterator_& operator+=(difference_type offset) noexcept
+            {
+                index_ = static_cast<std::size_t>(static_cast<difference_type>(index_) + offset);
+                return *this;
+            }
+
+            inline constexpr PackedIterator_& operator-=(difference_type offset) noexcept { return *this += -offset; }
+
+            /// @brief Offset iterator.
+            [[nodiscard]] friend inline constexpr PackedIterator_ operator+(PackedIterator_ it, difference_type offset) noexcept { return it += offset; }
+            [[nodiscard]] friend inline constexpr PackedIterator_ operator+(difference_type offset, PackedIterator_ it) noexcept { return it += offset; }
+            [[nodiscard]] friend inline constexpr PackedIterator_ operator-(PackedIterator_ it, difference_type offset) noexcept { return it -= offset; }
+
+            /// @brief Element distance.
+            [[nodiscard]] friend inline constexpr difference_type operator-(const PackedIterator_& lhs, const PackedIterator_& rhs) noexcept
+            {
+                return static_cast<difference_type>(lhs.index_) - static_cast<difference_type>(rhs.index_);
+            }
+
+            /// @brief Compare positions (iterators of the same array).
+            [[nodiscard]] friend inline constexpr bool operator==(const PackedIterator_& lhs, const PackedIterator_& rhs) noexcept
+            {
+                return lhs.index_ == rhs.index_;
+            }
+
+            [[nodiscard]] friend inline constexpr std::strong_ordering operator<=>(const PackedIterator_& lhs, const PackedIterator_& rhs) noexcept
+            {
+                return lhs.index_ <=> rhs.index_;
+            }
+        };
+    }
+
+    /**
+     * @brief `PackedIntArray` with width selected from the maximum value to be stored (see `MaxCapableUint`).
+     *
+     * @tparam maxValue maximum value to be supported.
+     */
+    template<std::size_t maxValue>
+    using MaxCapablePackedIntArray = PackedIntArray<std::max<std::size_t>(1, std::bit_width(maxValue))>;
+}
+
+#endif // INCLUDE_EASYMATHLIB_PACKEDINTARRAY_H_INCLUDED
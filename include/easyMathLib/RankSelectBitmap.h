@@ -0,0 +1,300 @@
+/**
+ * @file RankSelectBitmap.h
+ * @author Harith Manoj
+ * @brief Succinct bitmap with constant time rank and near constant time select.
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (C) Harith Manoj
+ *
+ *
+ *                      APACHE LICENSE 2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef INCLUDE_EASYMATHLIB_RANKSELECTBITMAP_H_INCLUDED
+
+/// @brief include\easyMathLib\RankSelectBitmap.h Header Guard
+#define INCLUDE_EASYMATHLIB_RANKSELECTBITMAP_H_INCLUDED
+
+#include <span>
+#include <bit>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+#include <type_traits>
+
+#include <easyMathLib/easyMath.h>
+#include <easyMathLib/simdSupport.h>
+
+namespace easyMath
+{
+    namespace impl_detail_
+    {
+        /**
+         * @brief Number of set bits, `popcnt` when available at runtime, else `std::popcount`.
+         *
+         * @param[in] word word to count.
+         * @return std::size_t number of set bits.
+         */
+        [[nodiscard]] inline constexpr std::size_t popCount64_(std::uint64_t word) noexcept
+        {
+#if defined(EASY_MATH_HAS_POPCNT) && (defined(__x86_64__) || defined(_M_X64))
+            if(!std::is_constant_evaluated())
+                return static_cast<std::size_t>(_mm_popcnt_u64(word));
+#endif
+            return static_cast<std::size_t>(std::popcount(word));
+        }
+
+        /**
+         * @brief Position of the set bit of rank `rank` in `word` (`pdep` + `tzcnt` with BMI2).
+         *
+         * @param[in] word word, requires more than `rank` set bits.
+         * @param[in] rank 0 based rank of set bit.
+         * @return std::size_t bit position.
+         */
+        [[nodiscard]] inline constexpr std::size_t selectInWord_(std::uint64_t word, std::size_t rank) noexcept
+        {
+#if defined(EASY_MATH_HAS_BMI2) && (defined(__x86_64__) || defined(_M_X64))
+            if(!std::is_constant_evaluated())
+                return static_cast<std::size_t>(std::countr_zero(_pdep_u64(std::uint64_t{1} << rank, word)));
+#endif
+            std::size_t position = 0;
+
+            // skip whole bytes, then bits.
+            for(std::size_t count = popCount64_(word & 0xff); count <= rank; count = popCount64_(word & 0xff))
+            {
+                rank -= count;
+                word >>= 8;
+                position += 8;
+            }
+
+            for(;; word >>= 1, ++position)
+                if((word & 1) && (rank-- == 0))
+                    return position;
+        }
+    }
+
+    /**
+     * @brief Immutable bitmap answering `rank` (ones before a position) in O(1) and `select` (position of the
+     * k-th one) in near O(1).
+     *
+     * Index: absolute one count per 4096 bit superblock (64 bit) and relative count per 512 bit block (16 bit),
+     * about 4.7% over the bitmap, plus the superblock of every 4096th one for select.
+     * Rank adds at most 7 full word popcounts and one `nBitMask` masked partial word.
+     */
+    class RankSelectBitmap
+    {
+    public:
+
+        /// @brief Bits per block.
+        static constexpr std::size_t BLOCK_BITS = 512;
+
+        /// @brief Bits per superblock.
+        static constexpr std::size_t SUPERBLOCK_BITS = 4096;
+
+        /// @brief Number of ones between select samples.
+        static constexpr std::size_t SELECT_SAMPLE = 4096;
+
+    private:
+
+        /// @brief Words per block.
+        static constexpr std::size_t BLOCK_WORDS_ = BLOCK_BITS / 64;
+
+        /// @brief Blocks per superblock.
+        static constexpr std::size_t SUPERBLOCK_BLOCKS_ = SUPERBLOCK_BITS / BLOCK_BITS;
+
+        /// @brief Bits, little endian within words, bits past `size_` are zero.
+        std::vector<std::uint64_t> words_;
+
+        /// @brief Number of bits.
+        std::size_t size_ = 0;
+
+        /// @brief Ones before each superblock (one extra entry holding the total).
+        std::vector<std::uint64_t> superblocks_;
+
+        /// @brief Ones before each block relative to its superblock.
+        std::vector<std::uint16_t> blocks_;
+
+        /// @brief Superblock holding the one of rank `i * SELECT_SAMPLE`.
+        std::vector<std::uint32_t> selectSamples_;
+
+        /// @brief Build rank and select index.
+        inline constexpr void build_()
+        {
+            words_.resize(divideRoundUp<std::size_t>(size_, 64));
+
+            if(size_ % 64 != 0)
+                words_.back() &= nBitMask<std::uint64_t>(size_ % 64);
+
+            std::size_t blockCount = divideRoundUp(words_.size(), BLOCK_WORDS_);
+            std::size_t superblockCount = divideRoundUp(blockCount, SUPERBLOCK_BLOCKS_);
+
+            superblocks_.assign(superblockCount + 1, 0);
+            blocks_.assign(blockCount, 0);
+            selectSamples_.clear();
+
+            std::uint64_t total = 0;
+            std::uint64_t superblockStart = 0;
+
+            for(std::size_t block = 0; block < blockCount; ++block)
+            {
+                if(block % SUPERBLOCK_BLOCKS_ == 0)
+                {
+                    superblockStart = total;
+                    superblocks_[block / SUPERBLOCK_BLOCKS_] = total;
+                }
+
+                blocks_[block] = static_cast<std::uint16_t>(total - superblockStart);
+
+                std::size_t end = std::min(words_.size(), (block + 1) * BLOCK_WORDS_);
+                for(std::size_t word = block * BLOCK_WORDS_; word < end; ++word)
+                {
+                    std::uint64_t count = impl_detail_::popCount64_(words_[word]);
+
+                    // sample every SELECT_SAMPLE-th one crossed by this word.
+                    while(selectSamples_.size() * SELECT_SAMPLE < total + count)
+                        selectSamples_.push_back(static_cast<std::uint32_t>(block / SUPERBLOCK_BLOCKS_));
+
+                    total += count;
+                }
+            }
+
+            superblocks_[superblockCount] = total;
+        }
+
+    public:
+
+        /// @brief Empty bitmap.
+        inline constexpr RankSelectBitmap() : superblocks_(1, 0) {}
+
+        /**
+         * @brief Index a copy of `bitCount` bits from `words` (bit i at `words[i / 64] >> (i % 64)`).
+         *
+         * @param[in] words source words, requires at least `divideRoundUp(bitCount, 64)` words.
+         * @param[in] bitCount number of bits.
+         */
+        inline constexpr RankSelectBitmap(std::span<const std::uint64_t> words, std::size_t bitCount) :
+            words_(words.begin(), words.begin() + static_cast<std::ptrdiff_t>(divideRoundUp<std::size_t>(bitCount, 64))),
+            size_(bitCount)
+        {
+            build_();
+        }
+
+        /**
+         * @brief Index `bitCount` bits, taking ownership of `words`.
+         *
+         * @param[in] words source words, requires at least `divideRoundUp(bitCount, 64)` words.
+         * @param[in] bitCount number of bits.
+         */
+        inline constexpr RankSelectBitmap(std::vector<std::uint64_t>&& words, std::size_t bitCount) :
+            words_(std::move(words)), size_(bitCount)
+        {
+            build_();
+        }
+
+        /// @brief Number of bits.
+        [[nodiscard]] inline constexpr std::size_t size() const noexcept { return size_; }
+
+        /// @brief Number of set bits.
+        [[nodiscard]] inline constexpr std::size_t count() const noexcept { return static_cast<std::size_t>(superblocks_.back()); }
+
+        /// @brief Bit at index, requires `index < size()`.
+        [[nodiscard]] inline constexpr bool get(std::size_t index) const noexcept { return (words_[index / 64] >> (index % 64)) & 1; }
+
+        /// @brief Bit at index, requires `index < size()`.
+        [[nodiscard]] inline constexpr bool operator[](std::size_t index) const noexcept { return get(index); }
+
+        /**
+         * @brief Number of set bits in `[0, index)`.
+         *
+         * @param[in] index position, requires `index <= size()`.
+         * @return std::size_t rank.
+         */
+        [[nodiscard]] inline constexpr std::size_t rank(std::size_t index) const noexcept
+        {
+            if(index >= size_)
+                return count();
+
+            std::size_t block = index / BLOCK_BITS;
+            std::size_t word = index / 64;
+
+            std::size_t ret = static_cast<std::size_t>(superblocks_[index / SUPERBLOCK_BITS]) + blocks_[block];
+
+            for(std::size_t i = block * BLOCK_WORDS_; i < word; ++i)
+                ret += impl_detail_::popCount64_(words_[i]);
+
+            return ret + impl_detail_::popCount64_(words_[word] & nBitMask<std::uint64_t>(index % 64));
+        }
+
+        /**
+         * @brief Number of clear bits in `[0, index)`.
+         *
+         * @param[in] index position, requires `index <= size()`.
+         * @return std::size_t rank of zeros.
+         */
+        [[nodiscard]] inline constexpr std::size_t rankZero(std::size_t index) const noexcept
+        {
+            return std::min(index, size_) - rank(index);
+        }
+
+        /**
+         * @brief Position of set bit of rank `rank` (0 based, `rank(select(k)) == k`).
+         *
+         * @param[in] rank rank of set bit, requires `rank < count()`.
+         * @return std::size_t bit position.
+         */
+        [[nodiscard]] inline constexpr std::size_t select(std::size_t rank) const noexcept
+        {
+            std::size_t sample = rank / SELECT_SAMPLE;
+
+            // superblocks between this sample and the next bound the search.
+            auto first = superblocks_.begin() + selectSamples_[sample];
+            auto last = (sample + 1 < selectSamples_.size())
+                ? superblocks_.begin() + selectSamples_[sample + 1] + 1
+                : superblocks_.end() - 1;
+
+            auto superblock = static_cast<std::size_t>(std::upper_bound(first, last, rank) - superblocks_.begin()) - 1;
+            rank -= static_cast<std::size_t>(superblocks_[superblock]);
+
+            std::size_t block = superblock * SUPERBLOCK_BLOCKS_;
+            std::size_t blockEnd = std::min(blocks_.size(), block + SUPERBLOCK_BLOCKS_);
+            while((block + 1 < blockEnd) && (blocks_[block + 1] <= rank))
+                ++block;
+
+            rank -= blocks_[block];
+
+            std::size_t word = block * BLOCK_WORDS_;
+            for(std::size_t count = impl_detail_::popCount64_(words_[word]); count <= rank; count = impl_detail_::popCount64_(words_[word]))
+            {
+                rank -= count;
+                ++word;
+            }
+
+            return word * 64 + impl_detail_::selectInWord_(words_[word], rank);
+        }
+
+        /// @brief Underlying words.
+        [[nodiscard]] inline constexpr std::span<const std::uint64_t> words() const noexcept { return words_; }
+
+        /// @brief Bytes used by the rank / select index (excluding the bits).
+        [[nodiscard]] inline constexpr std::size_t indexBytes() const noexcept
+        {
+            return superblocks_.size() * sizeof(std::uint64_t) + blocks_.size() * sizeof(std::uint16_t)
+                + selectSamples_.size() * sizeof(std::uint32_t);
+        }
+    };
+}
+
+#endif // INCLUDE_EASYMATHLIB_RANKSELECTBITMAP_H_INCLUDED
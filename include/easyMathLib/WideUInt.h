@@ -0,0 +1,620 @@
+/**
+ * @file WideUInt.h
+ * @author Harith Manoj
+ * @brief Fixed width multi limb unsigned integer.
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (C) Harith Manoj
+ *
+ *
+ *                      APACHE LICENSE 2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef INCLUDE_EASYMATHLIB_WIDEUINT_H_INCLUDED
+
+/// @brief include\easyMathLib\WideUInt.h Header Guard
+#define INCLUDE_EASYMATHLIB_WIDEUINT_H_INCLUDED
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <compare>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+
+#include <easyMathLib/easyMath.h>
+#include <easyMathLib/carryChain.h>
+
+namespace easyMath
+{
+    /**
+     * @brief Stack allocated fixed width unsigned integer of `Bits` bits, stored as little endian 64 bit limbs.
+     *
+     * Arithmetic wraps modulo 2^Bits like the builtin unsigned types. Provides `bitSize`, `nBitMask`,
+     * `willAddOverflow` and `willSubtractUnderflow` hooks used by `NumericTraits`, satisfies `UnsignedIntegral`.
+     * Add and subtract are carry chains over the limbs (see `addWithCarry`, `subWithBorrow`).
+     *
+     * Shifts by `Bits` or more produce 0, division by 0 is undefined as for builtin types.
+     *
+     * @tparam Bits number of bits, multiple of 64.
+     */
+    template<std::size_t Bits>
+        requires ((Bits % 64 == 0) && (Bits > 0))
+    class WideUInt
+    {
+    public:
+
+        /// @brief Type of each limb.
+        using Limb = std::uint64_t;
+
+        /// @brief Number of limbs.
+        static constexpr std::size_t LIMB_COUNT = Bits / 64;
+
+    private:
+
+        /// @brief Limbs, index 0 is least significant.
+        std::array<Limb, LIMB_COUNT> limbs_{};
+
+        /// @brief limb at `index`, 0 if `index` out of range (branch-free select).
+        [[nodiscard]] inline constexpr Limb limbOrZero_(std::size_t index) const noexcept
+        {
+            bool isValid = index < LIMB_COUNT;
+            return limbs_[isValid ? index : 0] & (Limb{0} - static_cast<Limb>(isValid));
+        }
+
+        /**
+         * @brief Divide by `divisor`, store quotient in `quotient` and remainder in `remainder`.
+         *
+         * Uses half limb division if divisor fits in 32 bits, else shift subtract from highest set bit.
+         * Operands are taken by value as `quotient` or `remainder` may alias them.
+         */
+        static inline constexpr void divide_(
+            const WideUInt dividend,
+            const WideUInt divisor,
+            WideUInt& quotient,
+            WideUInt& remainder
+        ) noexcept
+        {
+            quotient = 0u;
+            remainder = 0u;
+
+            if(divisor.significantBits() <= 32)
+            {
+                Limb denominator = divisor.limbs_[0];
+                Limb carry = 0;
+
+                for(std::size_t i = LIMB_COUNT; i-- > 0;)
+                {
+                    Limb high = (carry << 32) | (dividend.limbs_[i] >> 32);
+                    Limb highQuotient = high / denominator;
+                    carry = high % denominator;
+
+                    Limb low = (carry << 32) | (dividend.limbs_[i] & 0xffffffffull);
+                    Limb lowQuotient = low / denominator;
+                    carry = low % denominator;
+
+                    quotient.limbs_[i] = (highQuotient << 32) | lowQuotient;
+                }
+
+                remainder.limbs_[0] = carry;
+                return;
+            }
+
+            for(std::size_t i = dividend.significantBits(); i-- > 0;)
+            {
+                // bit shifted out of remainder, if set the shifted remainder exceeds any divisor.
+                bool isOut = (remainder.limbs_[LIMB_COUNT - 1] >> 63) != 0;
+
+                remainder <<= 1u;
+                remainder.limbs_[0] |= (dividend.limbs_[i / 64] >> (i % 64)) & 1u;
+
+                WideUInt difference;
+                bool borrow = subtract_(remainder, divisor, difference) && !isOut;
+
+                Limb keep = Limb{0} - static_cast<Limb>(borrow);
+                for(std::size_t j = 0; j < LIMB_COUNT; ++j)
+                    remainder.limbs_[j] = (remainder.limbs_[j] & keep) | (difference.limbs_[j] & ~keep);
+
+                quotient.limbs_[i / 64] |= static_cast<Limb>(!borrow) << (i % 64);
+            }
+        }
+
+        /// @brief `sum = lhs + rhs`, returns carry out.
+        static inline constexpr bool add_(const WideUInt& lhs, const WideUInt& rhs, WideUInt& sum) noexcept
+        {
+            return addWithCarry<Limb>(sum.limbs_, lhs.limbs_, rhs.limbs_);
+        }
+
+        /// @brief `difference = lhs - rhs`, returns borrow out.
+        static inline constexpr bool subtract_(const WideUInt& lhs, const WideUInt& rhs, WideUInt& difference) noexcept
+        {
+            return subWithBorrow<Limb>(difference.limbs_, lhs.limbs_, rhs.limbs_);
+        }
+
+        /// @brief 2^64 in floating point type `Float`.
+        template<std::floating_point Float>
+        static inline constexpr Float limbScale_() noexcept
+        {
+            return static_cast<Float>(4294967296.0) * static_cast<Float>(4294967296.0);
+        }
+
+    public:
+
+        /// @brief Construct zero.
+        inline constexpr WideUInt() noexcept = default;
+
+        /**
+         * @brief Construct from builtin integer, negative values are sign extended (wraps modulo 2^Bits).
+         *
+         * Integers wider than a limb (`__int128`) fill as many limbs as they span.
+         *
+         * @param[in] value value to convert.
+         */
+        template<std::integral Integer>
+        inline constexpr WideUInt(Integer value) noexcept
+        {
+            Limb extension = (std::is_signed_v<Integer> && (value < 0)) ? ~Limb{0} : Limb{0};
+            limbs_.fill(extension);
+
+            if constexpr (sizeof(Integer) <= sizeof(Limb))
+                limbs_[0] = static_cast<Limb>(static_cast<std::conditional_t<std::is_signed_v<Integer>, std::int64_t, std::uint64_t>>(value));
+            else
+            {
+                for(std::size_t i = 0; (i < LIMB_COUNT) && (i < sizeof(Integer) / sizeof(Limb)); ++i)
+                    limbs_[i] = static_cast<Limb>(value >> (64 * i));
+            }
+        }
+
+        /**
+         * @brief Construct from floating point value, truncates fraction, values below 1 produce 0.
+         *
+         * @param[in] value value to convert.
+         */
+        template<std::floating_point Float>
+        inline constexpr WideUInt(Float value) noexcept
+        {
+            if(!(value >= static_cast<Float>(1)))
+                return;
+
+            Float scale = 1;
+            for(std::size_t i = 1; i < LIMB_COUNT; ++i)
+                scale *= limbScale_<Float>();
+
+            for(std::size_t i = LIMB_COUNT; i-- > 0;)
+            {
+                Float part = value / scale;
+
+                if(part >= static_cast<Float>(1))
+                {
+                    auto limb = (part >= limbScale_<Float>()) ? ~Limb{0} : static_cast<Limb>(part);
+                    limbs_[i] = limb;
+                    value -= static_cast<Float>(limb) * scale;
+                }
+
+                scale /= limbScale_<Float>();
+            }
+        }
+
+        /**
+         * @brief Construct from different width, truncates or zero extends.
+         *
+         * @param[in] value value to convert.
+         */
+        template<std::size_t OtherBits>
+        inline constexpr explicit WideUInt(const WideUInt<OtherBits>& value) noexcept
+        {
+            for(std::size_t i = 0; (i < LIMB_COUNT) && (i < WideUInt<OtherBits>::LIMB_COUNT); ++i)
+                limbs_[i] = value.limb(i);
+        }
+
+        /**
+         * @brief Construct from limbs.
+         *
+         * @param[in] limbs limbs, index 0 least significant.
+         */
+        inline constexpr explicit WideUInt(const std::array<Limb, LIMB_COUNT>& limbs) noexcept : limbs_(limbs) {}
+
+        /// @brief Convert to builtin integer, truncates to lower bits (non zero test for `bool`).
+        template<std::integral Integer>
+        inline constexpr operator Integer() const noexcept
+        {
+            if constexpr (std::is_same_v<Integer, bool>)
+                return !isZero();
+            else if constexpr (sizeof(Integer) <= sizeof(Limb))
+                return static_cast<Integer>(limbs_[0]);
+            else
+            {
+                std::make_unsigned_t<Integer> ret = 0;
+
+                for(std::size_t i = std::min(LIMB_COUNT, sizeof(Integer) / sizeof(Limb)); i-- > 0;)
+                    ret = (ret << 64) | limbs_[i];
+
+                return static_cast<Integer>(ret);
+            }
+        }
+
+        /// @brief Convert to floating point, rounds to nearest representable.
+        template<std::floating_point Float>
+        inline constexpr operator Float() const noexcept
+        {
+            Float ret = 0;
+
+            for(std::size_t i = LIMB_COUNT; i-- > 0;)
+                ret = ret * limbScale_<Float>() + static_cast<Float>(limbs_[i]);
+
+            return ret;
+        }
+
+        /// @brief Limb at `index`, index 0 least significant.
+        [[nodiscard]] inline constexpr Limb limb(std::size_t index) const noexcept { return limbs_[index]; }
+
+        /// @brief Reference to limb at `index`, index 0 least significant.
+        [[nodiscard]] inline constexpr Limb& limb(std::size_t index) noexcept { return limbs_[index]; }
+
+        /// @brief Limb array, index 0 least significant.
+        [[nodiscard]] inline constexpr const std::array<Limb, LIMB_COUNT>& limbs() const noexcept { return limbs_; }
+
+        /// @brief true if all bits are 0.
+        [[nodiscard]] inline constexpr bool isZero() const noexcept
+        {
+            Limb any = 0;
+
+            for(auto limb : limbs_)
+                any |= limb;
+
+            return any == 0;
+        }
+
+        /// @brief Position of highest set bit + 1, 0 if value is 0.
+        [[nodiscard]] inline constexpr std::size_t significantBits() const noexcept
+        {
+            for(std::size_t i = LIMB_COUNT; i-- > 0;)
+                if(limbs_[i] != 0)
+                    return i * 64 + static_cast<std::size_t>(std::bit_width(limbs_[i]));
+
+            return 0;
+        }
+
+        /// @brief Number of bits, hook for `easyMath::bitSize`.
+        [[nodiscard]] static inline constexpr std::size_t bitSize() noexcept { return Bits; }
+
+        /**
+         * @brief Generate mask with lower `size` bits set, hook for `easyMath::nBitMask`.
+         *
+         * @param[in] size number of bits to set, saturates at `Bits`.
+         * @return WideUInt mask.
+         */
+        [[nodiscard]] static inline constexpr WideUInt nBitMask(std::size_t size) noexcept
+        {
+            WideUInt ret;
+
+            for(std::size_t i = 0; i < LIMB_COUNT; ++i)
+            {
+                std::size_t low = i * 64;
+                Limb full = Limb{0} - static_cast<Limb>(size >= low + 64);
+                Limb isPartial = Limb{0} - static_cast<Limb>((size > low) && (size < low + 64));
+                Limb partial = (Limb{1} << ((size - low) & 63)) - 1;
+                ret.limbs_[i] = full | (partial & isPartial);
+            }
+
+            return ret;
+        }
+
+        /**
+         * @brief Check if `lhs + rhs > max`, hook for `easyMath::willAddOverflow`.
+         *
+         * @param[in] lhs left hand side of operation.
+         * @param[in] rhs right hand side of operation.
+         * @param[in] max maximum allowed value.
+         * @return true if addition overflows.
+         */
+        [[nodiscard]] static inline constexpr bool willAddOverflow(const WideUInt& lhs, const WideUInt& rhs, const WideUInt& max) noexcept
+        {
+            WideUInt sum;
+            bool carry = add_(lhs, rhs, sum);
+            return carry | (sum > max);
+        }
+
+        /**
+         * @brief Check if `lhs - rhs < lowest`, hook for `easyMath::willSubtractUnderflow`.
+         *
+         * @param[in] lhs left hand side of operation.
+         * @param[in] rhs right hand side of operation.
+         * @param[in] lowest lowest allowed value.
+         * @return true if subtraction underflows.
+         */
+        [[nodiscard]] static inline constexpr bool willSubtractUnderflow(const WideUInt& lhs, const WideUInt& rhs, const WideUInt& lowest) noexcept
+        {
+            WideUInt difference;
+            bool borrow = subtract_(lhs, rhs, difference);
+            return borrow | (difference < lowest);
+        }
+
+        inline constexpr WideUInt& operator += (const WideUInt& rhs) noexcept
+        {
+            add_(*this, rhs, *this);
+            return *this;
+        }
+
+        inline constexpr WideUInt& operator -= (const WideUInt& rhs) noexcept
+        {
+            subtract_(*this, rhs, *this);
+            return *this;
+        }
+
+        inline constexpr WideUInt& operator *= (const WideUInt& rhs) noexcept
+        {
+            WideUInt product;
+
+            for(std::size_t i = 0; i < LIMB_COUNT; ++i)
+            {
+                Limb carry = 0;
+
+                for(std::size_t j = 0; i + j < LIMB_COUNT; ++j)
+                {
+                    Limb high;
+                    Limb low = impl_detail_::multiplyFull64_(limbs_[i], rhs.limbs_[j], high);
+
+                    low += carry;
+                    high += static_cast<Limb>(low < carry);
+                    product.limbs_[i + j] += low;
+                    high += static_cast<Limb>(product.limbs_[i + j] < low);
+                    carry = high;
+                }
+            }
+
+            *this = product;
+            return *this;
+        }
+
+        inline constexpr WideUInt& operator /= (const WideUInt& rhs) noexcept
+        {
+            WideUInt remainder;
+            divide_(*this, rhs, *this, remainder);
+            return *this;
+        }
+
+        inline constexpr WideUInt& operator %= (const WideUInt& rhs) noexcept
+        {
+            WideUInt quotient;
+            divide_(*this, rhs, quotient, *this);
+            return *this;
+        }
+
+        inline constexpr WideUInt& operator &= (const WideUInt& rhs) noexcept
+        {
+            for(std::size_t i = 0; i < LIMB_COUNT; ++i)
+                limbs_[i] &= rhs.limbs_[i];
+            return *this;
+        }
+
+        inline constexpr WideUInt& operator |= (const WideUInt& rhs) noexcept
+        {
+            for(std::size_t i = 0; i < LIMB_COUNT; ++i)
+                limbs_[i] |= rhs.limbs_[i];
+            return *this;
+        }
+
+        inline constexpr WideUInt& operator ^= (const WideUInt& rhs) noexcept
+        {
+            for(std::size_t i = 0; i < LIMB_COUNT; ++i)
+                limbs_[i] ^= rhs.limbs_[i];
+            return *this;
+        }
+
+        /// @brief Shift left, branch-free limb loop, 0 if `shift >= Bits`.
+        template<std::integral Integer>
+        inline constexpr WideUInt& operator <<= (Integer shift) noexcept
+        {
+            auto amount = static_cast<std::size_t>(shift);
+            std::size_t limbShift = amount / 64;
+            std::size_t bitShift = amount % 64;
+
+            WideUInt ret;
+            for(std::size_t i = 0; i < LIMB_COUNT; ++i)
+            {
+                Limb current = limbOrZero_(i - limbShift);
+                Limb lower = limbOrZero_(i - limbShift - 1);
+                ret.limbs_[i] = (current << bitShift) | ((lower >> 1) >> (63 - bitShift));
+            }
+
+            *this = ret;
+            return *this;
+        }
+
+        /// @brief Shift right, branch-free limb loop, 0 if `shift >= Bits`.
+        template<std::integral Integer>
+        inline constexpr WideUInt& operator >>= (Integer shift) noexcept
+        {
+            auto amount = static_cast<std::size_t>(shift);
+            std::size_t limbShift = amount / 64;
+            std::size_t bitShift = amount % 64;
+
+            WideUInt ret;
+            for(std::size_t i = 0; i < LIMB_COUNT; ++i)
+            {
+                Limb current = limbOrZero_(i + limbShift);
+                Limb upper = limbOrZero_(i + limbShift + 1);
+                ret.limbs_[i] = (current >> bitShift) | ((upper << 1) << (63 - bitShift));
+            }
+
+            *this = ret;
+            return *this;
+        }
+
+        inline constexpr WideUInt& operator ++ () noexcept { return *this += WideUInt(1u); }
+
+        inline constexpr WideUInt& operator -- () noexcept { return *this -= WideUInt(1u); }
+
+        inline constexpr WideUInt operator ++ (int) noexcept
+        {
+            auto ret = *this;
+            ++(*this);
+            return ret;
+        }
+
+        inline constexpr WideUInt operator -- (int) noexcept
+        {
+            auto ret = *this;
+            --(*this);
+            return ret;
+        }
+
+        [[nodiscard]] inline constexpr WideUInt operator ~ () const noexcept
+        {
+            WideUInt ret;
+            for(std::size_t i = 0; i < LIMB_COUNT; ++i)
+                ret.limbs_[i] = ~limbs_[i];
+            return ret;
+        }
+
+        [[nodiscard]] inline constexpr WideUInt operator - () const noexcept { return WideUInt{} - *this; }
+
+        [[nodiscard]] inline constexpr WideUInt operator + () const noexcept { return *this; }
+
+        [[nodiscard]] friend inline constexpr WideUInt operator + (WideUInt lhs, const WideUInt& rhs) noexcept { return lhs += rhs; }
+        [[nodiscard]] friend inline constexpr WideUInt operator - (WideUInt lhs, const WideUInt& rhs) noexcept { return lhs -= rhs; }
+        [[nodiscard]] friend inline constexpr WideUInt operator * (WideUInt lhs, const WideUInt& rhs) noexcept { return lhs *= rhs; }
+        [[nodiscard]] friend inline constexpr WideUInt operator / (WideUInt lhs, const WideUInt& rhs) noexcept { return lhs /= rhs; }
+        [[nodiscard]] friend inline constexpr WideUInt operator % (WideUInt lhs, const WideUInt& rhs) noexcept { return lhs %= rhs; }
+        [[nodiscard]] friend inline constexpr WideUInt operator & (WideUInt lhs, const WideUInt& rhs) noexcept { return lhs &= rhs; }
+        [[nodiscard]] friend inline constexpr WideUInt operator | (WideUInt lhs, const WideUInt& rhs) noexcept { return lhs |= rhs; }
+        [[nodiscard]] friend inline constexpr WideUInt operator ^ (WideUInt lhs, const WideUInt& rhs) noexcept { return lhs ^= rhs; }
+
+        /*
+         * Mixed operand overloads, exact matches so that builtin operators
+         * (reachable through the implicit conversions) are not ambiguous.
+         */
+
+        template<std::integral Integer>
+        [[nodiscard]] friend inline constexpr WideUInt operator + (WideUInt lhs, Integer rhs) noexcept { return lhs += WideUInt(rhs); }
+        template<std::integral Integer>
+        [[nodiscard]] friend inline constexpr WideUInt operator + (Integer lhs, const WideUInt& rhs) noexcept { return WideUInt(lhs) += rhs; }
+        template<std::integral Integer>
+        [[nodiscard]] friend inline constexpr WideUInt operator - (WideUInt lhs, Integer rhs) noexcept { return lhs -= WideUInt(rhs); }
+        template<std::integral Integer>
+        [[nodiscard]] friend inline constexpr WideUInt operator - (Integer lhs, const WideUInt& rhs) noexcept { return WideUInt(lhs) -= rhs; }
+        template<std::integral Integer>
+        [[nodiscard]] friend inline constexpr WideUInt operator * (WideUInt lhs, Integer rhs) noexcept { return lhs *= WideUInt(rhs); }
+        template<std::integral Integer>
+        [[nodiscard]] friend inline constexpr WideUInt operator * (Integer lhs, const WideUInt& rhs) noexcept { return WideUInt(lhs) *= rhs; }
+        template<std::integral Integer>
+        [[nodiscard]] friend inline constexpr WideUInt operator / (WideUInt lhs, Integer rhs) noexcept { return lhs /= WideUInt(rhs); }
+        template<std::integral Integer>
+        [[nodiscard]] friend inline constexpr WideUInt operator / (Integer lhs, const WideUInt& rhs) noexcept { return WideUInt(lhs) /= rhs; }
+        template<std::integral Integer>
+        [[nodiscard]] friend inline constexpr WideUInt operator % (WideUInt lhs, Integer rhs) noexcept { return lhs %= WideUInt(rhs); }
+        template<std::integral Integer>
+        [[nodiscard]] friend inline constexpr WideUInt operator % (Integer lhs, const WideUInt& rhs) noexcept { return WideUInt(lhs) %= rhs; }
+        template<std::integral Integer>
+        [[nodiscard]] friend inline constexpr WideUInt operator & (WideUInt lhs, Integer rhs) noexcept { return lhs &= WideUInt(rhs); }
+        template<std::integral Integer>
+        [[nodiscard]] friend inline constexpr WideUInt operator & (Integer lhs, const WideUInt& rhs) noexcept { return WideUInt(lhs) &= rhs; }
+        template<std::integral Integer>
+        [[nodiscard]] friend inline constexpr WideUInt operator | (WideUInt lhs, Integer rhs) noexcept { return lhs |= WideUInt(rhs); }
+        template<std::integral Integer>
+        [[nodiscard]] friend inline constexpr WideUInt operator | (Integer lhs, const WideUInt& rhs) noexcept { return WideUInt(lhs) |= rhs; }
+        template<std::integral Integer>
+        [[nodiscard]] friend inline constexpr WideUInt operator ^ (WideUInt lhs, Integer rhs) noexcept { return lhs ^= WideUInt(rhs); }
+        template<std::integral Integer>
+        [[nodiscard]] friend inline constexpr WideUInt operator ^ (Integer lhs, const WideUInt& rhs) noexcept { return WideUInt(lhs) ^= rhs; }
+
+        template<std::integral Integer>
+        [[nodiscard]] friend inline constexpr WideUInt operator << (WideUInt lhs, Integer shift) noexcept { return lhs <<= shift; }
+        template<std::integral Integer>
+        [[nodiscard]] friend inline constexpr WideUInt operator >> (WideUInt lhs, Integer shift) noexcept { return lhs >>= shift; }
+
+        [[nodiscard]] friend inline constexpr bool operator == (const WideUInt& lhs, const WideUInt& rhs) noexcept
+        {
+            Limb difference = 0;
+
+            for(std::size_t i = 0; i < LIMB_COUNT; ++i)
+                difference |= lhs.limbs_[i] ^ rhs.limbs_[i];
+
+            return difference == 0;
+        }
+
+        [[nodiscard]] friend inline constexpr std::strong_ordering operator <=> (const WideUInt& lhs, const WideUInt& rhs) noexcept
+        {
+            WideUInt difference;
+            bool borrow = subtract_(lhs, rhs, difference);
+
+            if(borrow)
+                return std::strong_ordering::less;
+            else if(difference.isZero())
+                return std::strong_ordering::equal;
+            else
+                return std::strong_ordering::greater;
+        }
+
+        template<std::integral Integer>
+        [[nodiscard]] friend inline constexpr bool operator == (const WideUInt& lhs, Integer rhs) noexcept { return lhs == WideUInt(rhs); }
+
+        template<std::integral Integer>
+        [[nodiscard]] friend inline constexpr std::strong_ordering operator <=> (const WideUInt& lhs, Integer rhs) noexcept { return lhs <=> WideUInt(rhs); }
+    };
+
+    /// @brief 128 bit unsigned integer.
+    using UInt128 = WideUInt<128>;
+
+    /// @brief 256 bit unsigned integer.
+    using UInt256 = WideUInt<256>;
+
+    /// @brief 512 bit unsigned integer.
+    using UInt512 = WideUInt<512>;
+}
+
+/// @brief `std::numeric_limits` for `easyMath::WideUInt`, enables `NumericTraits`.
+template<std::size_t Bits>
+struct std::numeric_limits<easyMath::WideUInt<Bits>>
+{
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_signed = false;
+    static constexpr bool is_integer = true;
+    static constexpr bool is_exact = true;
+    static constexpr bool has_infinity = false;
+    static constexpr bool has_quiet_NaN = false;
+    static constexpr bool has_signaling_NaN = false;
+    static constexpr std::float_denorm_style has_denorm = std::denorm_absent;
+    static constexpr bool has_denorm_loss = false;
+    static constexpr std::float_round_style round_style = std::round_toward_zero;
+    static constexpr bool is_iec559 = false;
+    static constexpr bool is_bounded = true;
+    static constexpr bool is_modulo = true;
+    static constexpr int digits = static_cast<int>(Bits);
+    static constexpr int digits10 = static_cast<int>(Bits * 643 / 2136);
+    static constexpr int max_digits10 = 0;
+    static constexpr int radix = 2;
+    static constexpr int min_exponent = 0;
+    static constexpr int min_exponent10 = 0;
+    static constexpr int max_exponent = 0;
+    static constexpr int max_exponent10 = 0;
+    static constexpr bool traps = false;
+    static constexpr bool tinyness_before = false;
+
+    static constexpr easyMath::WideUInt<Bits> min() noexcept { return {}; }
+    static constexpr easyMath::WideUInt<Bits> lowest() noexcept { return {}; }
+    static constexpr easyMath::WideUInt<Bits> max() noexcept { return ~easyMath::WideUInt<Bits>{}; }
+    static constexpr easyMath::WideUInt<Bits> epsilon() noexcept { return {}; }
+    static constexpr easyMath::WideUInt<Bits> round_error() noexcept { return {}; }
+    static constexpr easyMath::WideUInt<Bits> infinity() noexcept { return {}; }
+    static constexpr easyMath::WideUInt<Bits> quiet_NaN() noexcept { return {}; }
+    static constexpr easyMath::WideUInt<Bits> signaling_NaN() noexcept { return {}; }
+    static constexpr easyMath::WideUInt<Bits> denorm_min() noexcept { return {}; }
+};
+
+#endif // INCLUDE_EASYMATHLIB_WIDEUINT_H_INCLUDED
@@ -0,0 +1,404 @@
+/**
+ * @file bitPacking.h
+ * @author Harith Manoj
+ * @brief Pack arrays of N-bit integers into dense little endian bit streams and back.
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (C) Harith Manoj
+ *
+ *
+ *                      APACHE LICENSE 2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef INCLUDE_EASYMATHLIB_BITPACKING_H_INCLUDED
+
+/// @brief include\easyMathLib\bitPacking.h Header Guard
+#define INCLUDE_EASYMATHLIB_BITPACKING_H_INCLUDED
+
+#include <span>
+#include <array>
+#include <vector>
+#include <utility>
+#include <bit>
+#include <cstring>
+#include <concepts>
+#include <cstdint>
+#include <type_traits>
+
+#include <easyMathLib/easyMath.h>
+#include <easyMathLib/simdSupport.h>
+
+namespace easyMath
+{
+    namespace impl_detail_
+    {
+        /// @brief Number of values per packed group, a group of N-bit values is exactly N bytes.
+        constexpr std::size_t PACK_GROUP_SIZE_ = 8;
+
+        /**
+         * @brief Mask of lower `Bits` bits of a 64 bit word (valid for `Bits == 64`).
+         *
+         * @tparam Bits width in bits, 1 to 64.
+         */
+        template<std::size_t Bits>
+        constexpr std::uint64_t PACK_VALUE_MASK_ = (Bits == 64) ? ~std::uint64_t{0} : nBitMask<std::uint64_t>(Bits);
+
+        /**
+         * @brief Little endian load of 8 bytes, single unaligned load at runtime on little endian hosts.
+         *
+         * @param[in] bytes pointer to first byte, 8 bytes must be readable.
+         * @return std::uint64_t loaded word.
+         */
+        [[nodiscard]] inline constexpr std::uint64_t loadLittle64_(const std::uint8_t* bytes) noexcept
+        {
+            std::uint64_t word = 0;
+
+            if constexpr (std::endian::native == std::endian::little)
+                if(!std::is_constant_evaluated())
+                {
+                    std::memcpy(&word, bytes, sizeof(word));
+                    return word;
+                }
+
+            for(std::size_t i = 0; i < 8; ++i)
+                word |= static_cast<std::uint64_t>(bytes[i]) << (8 * i);
+
+            return word;
+        }
+
+        /**
+         * @brief Little endian store of 8 bytes, single unaligned store at runtime on little endian hosts.
+         *
+         * @param[out] bytes pointer to first byte, 8 bytes must be writable.
+         * @param[in] word word to store.
+         */
+        inline constexpr void storeLittle64_(std::uint8_t* bytes, std::uint64_t word) noexcept
+        {
+            if constexpr (std::endian::native == std::endian::little)
+                if(!std::is_constant_evaluated())
+                {
+                    std::memcpy(bytes, &word, sizeof(word));
+                    return;
+                }
+
+            for(std::size_t i = 0; i < 8; ++i)
+                bytes[i] = static_cast<std::uint8_t>(word >> (8 * i));
+        }
+
+        /**
+         * @brief Pack one group of 8 values into `Bits` bytes.
+         *
+         * @tparam Bits width of each value.
+         * @tparam UInt value type.
+         * @param[in] values pointer to 8 values.
+         * @param[out] bytes pointer to `Bits` writable bytes.
+         */
+        template<std::size_t Bits, class UInt>
+        inline constexpr void packGroup_(const UInt* values, std::uint8_t* bytes) noexcept
+        {
+            std::array<std::uint64_t, (Bits + 7) / 8 + 1> words{};
+
+            [&]<std::size_t... J>(std::index_sequence<J...>)
+            {
+                ([&]
+                {
+                    constexpr std::size_t offset = J * Bits;
+                    constexpr std::size_t word = offset / 64;
+                    constexpr std::size_t shift = offset % 64;
+
+                    auto value = static_cast<std::uint64_t>(values[J]) & PACK_VALUE_MASK_<Bits>;
+                    words[word] |= value << shift;
+
+                    if constexpr ((shift != 0) && (shift + Bits > 64))
+                        words[word + 1] |= value >> (64 - shift);
+                }(), ...);
+            }(std::make_index_sequence<PACK_GROUP_SIZE_>{});
+
+            if constexpr (std::endian::native == std::endian::little)
+                if(!std::is_constant_evaluated())
+                {
+                    std::memcpy(bytes, words.data(), Bits);
+                    return;
+                }
+
+            for(std::size_t i = 0; i < Bits; ++i)
+                bytes[i] = static_cast<std::uint8_t>(words[i / 8] >> (8 * (i % 8)));
+        }
+
+        /**
+         * @brief Unpack one group of 8 values from `Bits` bytes.
+         *
+         * Reads up to `Bits + 9` bytes (one word past the group end), caller pads near the buffer end.
+         *
+         * @tparam Bits width of each value.
+         * @tparam UInt value type.
+         * @param[in] bytes pointer to group, `Bits + 9` readable bytes.
+         * @param[out] values pointer to 8 writable values.
+         */
+        template<std::size_t Bits, class UInt>
+        inline constexpr void unpackGroup_(const std::uint8_t* bytes, UInt* values) noexcept
+        {
+            [&]<std::size_t... J>(std::index_sequence<J...>)
+            {
+                ([&]
+                {
+                    constexpr std::size_t offset = J * Bits;
+                    constexpr std::size_t byte = offset / 8;
+                    constexpr std::size_t shift = offset % 8;
+
+                    auto word = loadLittle64_(bytes + byte) >> shift;
+
+                    if constexpr ((shift != 0) && (shift + Bits > 64))
+                        word |= static_cast<std::uint64_t>(bytes[byte + 8]) << (64 - shift);
+
+                    values[J] = static_cast<UInt>(word & PACK_VALUE_MASK_<Bits>);
+                }(), ...);
+            }(std::make_index_sequence<PACK_GROUP_SIZE_>{});
+        }
+
+#if defined(EASY_MATH_DISPATCH_AVX2)
+
+        /**
+         * @brief AVX2 unpack one group of 8 values of width at most 25 bits into 32 bit lanes.
+         *
+         * Each value lies in a 4 byte window, the low 128 bit lane gathers values 0-3 and the high lane 4-7
+         * with `pshufb`, then a per lane variable shift and mask isolates the value.
+         *
+         * @tparam Bits width of each value.
+         * @param[in] bytes pointer to group, 32 readable bytes.
+         * @param[out] values pointer to 8 writable values.
+         */
+        template<std::size_t Bits>
+        EASY_MATH_TARGET_AVX2 inline void avx2UnpackGroup32_(const std::uint8_t* bytes, std::uint32_t* values) noexcept
+        {
+            static_assert(Bits <= 25);
+
+            constexpr std::size_t highBase = (4 * Bits) / 8;
+
+            constexpr auto shuffle = []()
+            {
+                std::array<std::uint8_t, 32> ret{};
+
+                for(std::size_t j = 0; j < PACK_GROUP_SIZE_; ++j)
+                {
+                    std::size_t byte = (j * Bits) / 8 - ((j < 4) ? 0 : highBase);
+
+                    for(std::size_t k = 0; k < 4; ++k)
+                        ret[4 * j + k] = static_cast<std::uint8_t>(byte + k);
+                }
+
+                return ret;
+            }();
+
+            auto low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes));
+            auto high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + highBase));
+            auto window = _mm256_inserti128_si256(_mm256_castsi128_si256(low), high, 1);
+
+            auto gathered = _mm256_shuffle_epi8(window, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(shuffle.data())));
+            auto shifts = _mm256_setr_epi32(
+                0, Bits % 8, (2 * Bits) % 8, (3 * Bits) % 8, (4 * Bits) % 8, (5 * Bits) % 8, (6 * Bits) % 8, (7 * Bits) % 8
+            );
+
+            auto result = _mm256_and_si256(
+                _mm256_srlv_epi32(gathered, shifts),
+                _mm256_set1_epi32(static_cast<int>(PACK_VALUE_MASK_<Bits>))
+            );
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(values), result);
+        }
+
+        /**
+         * @brief AVX2 unpack of whole groups while `readSize` bytes remain readable from the group start.
+         *
+         * @tparam Bits width of each value.
+         * @tparam readSize bytes read past the start of each group.
+         * @param[in] bytes packed stream.
+         * @param[out] values destination, whole groups only.
+         * @return std::size_t number of groups unpacked.
+         */
+        template<std::size_t Bits, std::size_t readSize>
+        EASY_MATH_TARGET_AVX2 inline std::size_t avx2UnpackGroups32_(std::span<const std::uint8_t> bytes, std::span<std::uint32_t> values) noexcept
+        {
+            std::size_t group = 0;
+
+            for(; (group < values.size() / PACK_GROUP_SIZE_) && (group * Bits + readSize <= bytes.size()); ++group)
+                avx2UnpackGroup32_<Bits>(bytes.data() + group * Bits, values.data() + group * PACK_GROUP_SIZE_);
+
+            return group;
+        }
+
+#endif
+    }
+
+    /**
+     * @brief Number of bytes occupied by `count` packed values of `Bits` bits.
+     *
+     * @tparam Bits width of each value.
+     * @param[in] count number of values.
+     * @return std::size_t packed size in bytes.
+     */
+    template<std::size_t Bits>
+    [[nodiscard]] inline constexpr std::size_t packedByteSize(std::size_t count) noexcept
+    {
+        return divideRoundUp<std::size_t>(count * Bits, 8);
+    }
+
+    /**
+     * @brief Pack values into a dense bit stream, value i occupies bits `[i * Bits, (i + 1) * Bits)`
+     * (least significant bit first, little endian bytes).
+     *
+     * Bits above `Bits` in each value are ignored. Unused bits of the last byte are zeroed.
+     * Specialised at compile time for each width, groups of 8 values map to `Bits` bytes.
+     *
+     * @tparam Bits width of each packed value, 1 to bit size of `UInt`.
+     * @tparam UInt unsigned value type.
+     * @param[in] values values to pack.
+     * @param[out] bytes destination, requires `bytes.size() >= packedByteSize<Bits>(values.size())`.
+     * @return std::size_t number of bytes written.
+     */
+    template<std::size_t Bits, std::unsigned_integral UInt = std::conditional_t<(Bits <= 32), std::uint32_t, std::uint64_t>>
+        requires ((Bits > 0) && (Bits <= bitSize<UInt>()) && (Bits <= 64))
+    inline constexpr std::size_t pack(
+        std::type_identity_t<std::span<const UInt>> values,
+        std::span<std::uint8_t> bytes
+    ) noexcept
+    {
+        constexpr std::size_t groupSize = impl_detail_::PACK_GROUP_SIZE_;
+
+        std::size_t fullGroups = values.size() / groupSize;
+
+        for(std::size_t group = 0; group < fullGroups; ++group)
+            impl_detail_::packGroup_<Bits>(values.data() + group * groupSize, bytes.data() + group * Bits);
+
+        std::size_t done = fullGroups * groupSize;
+        std::size_t written = fullGroups * Bits;
+
+        if(done != values.size())
+        {
+            std::array<UInt, groupSize> tail{};
+            std::array<std::uint8_t, Bits> tailBytes{};
+
+            for(std::size_t i = done; i < values.size(); ++i)
+                tail[i - done] = values[i];
+
+            impl_detail_::packGroup_<Bits>(tail.data(), tailBytes.data());
+
+            std::size_t tailSize = packedByteSize<Bits>(values.size() - done);
+            for(std::size_t i = 0; i < tailSize; ++i)
+                bytes[written + i] = tailBytes[i];
+
+            written += tailSize;
+        }
+
+        return written;
+    }
+
+    /**
+     * @brief Pack values into a newly allocated dense bit stream.
+     *
+     * @tparam Bits width of each packed value, 1 to bit size of `UInt`.
+     * @tparam UInt unsigned value type.
+     * @param[in] values values to pack.
+     * @return std::vector<std::uint8_t> packed bytes, `packedByteSize<Bits>(values.size())` long.
+     */
+    template<std::size_t Bits, std::unsigned_integral UInt = std::conditional_t<(Bits <= 32), std::uint32_t, std::uint64_t>>
+        requires ((Bits > 0) && (Bits <= bitSize<UInt>()) && (Bits <= 64))
+    [[nodiscard]] inline constexpr std::vector<std::uint8_t> pack(std::type_identity_t<std::span<const UInt>> values)
+    {
+        std::vector<std::uint8_t> bytes(packedByteSize<Bits>(values.size()));
+        pack<Bits, UInt>(values, bytes);
+        return bytes;
+    }
+
+    /**
+     * @brief Unpack `values.size()` values from a dense bit stream produced by `pack`.
+     *
+     * Uses AVX2 shuffle / variable shift kernels for widths up to 25 bits into 32 bit values when allowed by
+     * `easyLib::cpuTier()`, compile time specialised scalar kernels otherwise.
+     *
+     * @tparam Bits width of each packed value, 1 to bit size of `UInt`.
+     * @tparam UInt unsigned value type.
+     * @param[in] bytes packed stream, requires `bytes.size() >= packedByteSize<Bits>(values.size())`.
+     * @param[out] values destination of unpacked values.
+     * @return std::size_t number of bytes consumed.
+     */
+    template<std::size_t Bits, std::unsigned_integral UInt = std::conditional_t<(Bits <= 32), std::uint32_t, std::uint64_t>>
+        requires ((Bits > 0) && (Bits <= bitSize<UInt>()) && (Bits <= 64))
+    inline constexpr std::size_t unpack(
+        std::span<const std::uint8_t> bytes,
+        std::type_identity_t<std::span<UInt>> values
+    ) noexcept
+    {
+        constexpr std::size_t groupSize = impl_detail_::PACK_GROUP_SIZE_;
+        // fast path reads at most one word past the group, or a full 32 byte vector.
+        constexpr std::size_t readSize = (Bits + 9 > 32) ? (Bits + 9) : 32;
+
+        std::size_t fullGroups = values.size() / groupSize;
+        std::size_t group = 0;
+
+        if(!std::is_constant_evaluated())
+        {
+#if defined(EASY_MATH_DISPATCH_AVX2)
+            if constexpr ((Bits <= 25) && (sizeof(UInt) == 4))
+                if(impl_detail_::useAvx2_())
+                    group = impl_detail_::avx2UnpackGroups32_<Bits, readSize>(
+                        bytes, std::span<std::uint32_t>(reinterpret_cast<std::uint32_t*>(values.data()), values.size())
+                    );
+#endif
+        }
+
+        for(; (group < fullGroups) && (group * Bits + readSize <= bytes.size()); ++group)
+            impl_detail_::unpackGroup_<Bits>(bytes.data() + group * Bits, values.data() + group * groupSize);
+
+        // groups near the end of the buffer are decoded from a zero padded copy.
+        for(std::size_t done = group * groupSize; done < values.size(); done += groupSize, ++group)
+        {
+            std::array<std::uint8_t, readSize> padded{};
+            std::array<UInt, groupSize> tail{};
+
+            std::size_t available = bytes.size() - group * Bits;
+            for(std::size_t i = 0; (i < available) && (i < Bits); ++i)
+                padded[i] = bytes[group * Bits + i];
+
+            impl_detail_::unpackGroup_<Bits>(padded.data(), tail.data());
+
+            for(std::size_t i = 0; (i < groupSize) && (done + i < values.size()); ++i)
+                values[done + i] = tail[i];
+        }
+
+        return packedByteSize<Bits>(values.size());
+    }
+
+    /**
+     * @brief Unpack `count` values from a dense bit stream into a newly allocated vector.
+     *
+     * @tparam Bits width of each packed value, 1 to bit size of `UInt`.
+     * @tparam UInt unsigned value type.
+     * @param[in] bytes packed stream, requires `bytes.size() >= packedByteSize<Bits>(count)`.
+     * @param[in] count number of values to unpack.
+     * @return std::vector<UInt> unpacked values.
+     */
+    template<std::size_t Bits, std::unsigned_integral UInt = std::conditional_t<(Bits <= 32), std::uint32_t, std::uint64_t>>
+        requires ((Bits > 0) && (Bits <= bitSize<UInt>()) && (Bits <= 64))
+    [[nodiscard]] inline constexpr std::vector<UInt> unpack(std::span<const std::uint8_t> bytes, std::size_t count)
+    {
+        std::vector<UInt> values(count);
+        unpack<Bits, UInt>(bytes, values);
+        return values;
+    }
+}
+
+#endif // INCLUDE_EASYMATHLIB_BITPACKING_H_INCLUDED
@@ -0,0 +1,549 @@
+/**
+ * @file byteOrder.h
+ * @author Harith Manoj
+ * @brief Byte swap, bit reversal and big / little endian conversion of unsigned integers and integer spans.
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (C) Harith Manoj
+ *
+ *
+ *                      APACHE LICENSE 2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef INCLUDE_EASYMATHLIB_BYTEORDER_H_INCLUDED
+
+/// @brief include\easyMathLib\byteOrder.h Header Guard
+#define INCLUDE_EASYMATHLIB_BYTEORDER_H_INCLUDED
+
+#include <span>
+#include <bit>
+#include <array>
+#include <cstdint>
+#include <concepts>
+#include <algorithm>
+#include <type_traits>
+
+#include <easyMathLib/easyMath.h>
+#include <easyMathLib/simdSupport.h>
+
+namespace easyMath
+{
+    namespace impl_detail_
+    {
+        /**
+         * @brief Builtin unsigned type (including `unsigned __int128`), stored as plain host order bytes.
+         *
+         * @tparam UInt type to check.
+         */
+        template<class UInt>
+        concept BuiltinUnsigned_ = (std::unsigned_integral<UInt> && !std::same_as<UInt, bool>)
+#if defined(__SIZEOF_INT128__)
+            || std::same_as<UInt, BuiltinUInt128>
+#endif
+            ;
+
+        /**
+         * @brief Reverse bits of each byte of a 64 bit word.
+         *
+         * @param[in] word word.
+         * @return std::uint64_t word with bits of each byte reversed.
+         */
+        [[nodiscard]] inline constexpr std::uint64_t reverseBitsInBytes_(std::uint64_t word) noexcept
+        {
+            word = ((word >> 1) & 0x5555555555555555ull) | ((word & 0x5555555555555555ull) << 1);
+            word = ((word >> 2) & 0x3333333333333333ull) | ((word & 0x3333333333333333ull) << 2);
+            return ((word >> 4) & 0x0f0f0f0f0f0f0f0full) | ((word & 0x0f0f0f0f0f0f0f0full) << 4);
+        }
+
+        /**
+         * @brief Byte order reversal of a builtin value, `bswap` at runtime.
+         *
+         * @tparam UInt builtin unsigned type.
+         * @param[in] value value.
+         * @return UInt value with reversed bytes.
+         */
+        template<BuiltinUnsigned_ UInt>
+        [[nodiscard]] inline constexpr UInt builtinByteSwap_(UInt value) noexcept
+        {
+            if constexpr (sizeof(UInt) == 1)
+                return value;
+            else if constexpr (sizeof(UInt) > 8)
+            {
+                auto low = static_cast<std::uint64_t>(value), high = static_cast<std::uint64_t>(value >> 64);
+                return (static_cast<UInt>(builtinByteSwap_(low)) << 64) | builtinByteSwap_(high);
+            }
+            else
+            {
+#if defined(__GNUC__) || defined(__clang__)
+                if constexpr (sizeof(UInt) == 2)
+                    return static_cast<UInt>(__builtin_bswap16(value));
+                else if constexpr (sizeof(UInt) == 4)
+                    return static_cast<UInt>(__builtin_bswap32(value));
+                else
+                    return static_cast<UInt>(__builtin_bswap64(value));
+#else
+                UInt result = 0;
+                for(std::size_t byte = 0; byte < sizeof(UInt); ++byte, value >>= 8)
+                    result = static_cast<UInt>((result << 8) | (value & 0xff));
+                return result;
+#endif
+            }
+        }
+
+        /**
+         * @brief Byte shuffle reversing bytes of every `size` byte element, repeated for each 16 byte lane of a
+         * 64 byte register (narrower registers load a prefix).
+         *
+         * @tparam size element size in bytes.
+         */
+        template<std::size_t size>
+        alignas(64) inline constexpr std::array<std::uint8_t, 64> BYTE_REVERSE_SHUFFLE_ = []()
+        {
+            std::array<std::uint8_t, 64> shuffle{};
+            for(std::size_t i = 0; i < 64; ++i)
+                shuffle[i] = static_cast<std::uint8_t>((i % 16 / size) * size + (size - 1 - i % size));
+            return shuffle;
+        }();
+
+        /// @brief `pshufb` table of the reversed 4 bit index, `shift` to the upper nibble, repeated per 16 byte lane.
+        template<std::size_t shift>
+        alignas(64) inline constexpr std::array<std::uint8_t, 64> NIBBLE_REVERSE_ = []()
+        {
+            std::array<std::uint8_t, 64> table{};
+            for(std::size_t i = 0; i < 64; ++i)
+                table[i] = static_cast<std::uint8_t>((((i & 1) << 3) | ((i & 2) << 1) | ((i & 4) >> 1) | ((i & 8) >> 3)) << shift);
+            return table;
+        }();
+
+        /// @brief `gf2p8affineqb` matrix reversing the bits of each byte.
+        inline constexpr std::int64_t GFNI_BIT_REVERSE_ = 0x8040201008040201ll;
+
+#if defined(EASY_MATH_DISPATCH_SSE4_2)
+
+        /**
+         * @brief SSSE3 byte order / bit reversal of 16 byte blocks.
+         *
+         * @tparam size element size in bytes.
+         * @tparam reverseBits also reverse bits of each byte.
+         * @param[in] source source bytes.
+         * @param[out] destination destination bytes, may equal `source`.
+         * @param[in] byteCount number of bytes.
+         * @return std::size_t number of bytes converted (whole blocks).
+         */
+        template<std::size_t size, bool reverseBits>
+        EASY_MATH_TARGET_SSE4_2 inline std::size_t sse4ByteOrder_(const std::uint8_t* source, std::uint8_t* destination, std::size_t byteCount) noexcept
+        {
+            [[maybe_unused]] const __m128i shuffle = _mm_load_si128(reinterpret_cast<const __m128i*>(BYTE_REVERSE_SHUFFLE_<size>.data()));
+            [[maybe_unused]] const __m128i lowTable = _mm_load_si128(reinterpret_cast<const __m128i*>(NIBBLE_REVERSE_<4>.data()));
+            [[maybe_unused]] const __m128i highTable = _mm_load_si128(reinterpret_cast<const __m128i*>(NIBBLE_REVERSE_<0>.data()));
+            [[maybe_unused]] const __m128i nibble = _mm_set1_epi8(0x0f);
+
+            std::size_t i = 0;
+            for(; i + 16 <= byteCount; i += 16)
+            {
+                __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i));
+
+                if constexpr (size > 1)
+                    block = _mm_shuffle_epi8(block, shuffle);
+
+                if constexpr (reverseBits)
+                {
+#if defined(EASY_MATH_HAS_GFNI)
+                    block = _mm_gf2p8affine_epi64_epi8(block, _mm_set1_epi64x(GFNI_BIT_REVERSE_), 0);
+#else
+                    __m128i low = _mm_shuffle_epi8(lowTable, _mm_and_si128(block, nibble));
+                    __m128i high = _mm_shuffle_epi8(highTable, _mm_and_si128(_mm_srli_epi16(block, 4), nibble));
+                    block = _mm_or_si128(low, high);
+#endif
+                }
+
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i), block);
+            }
+
+            return i;
+        }
+
+#endif
+
+#if defined(EASY_MATH_DISPATCH_AVX2)
+
+        /**
+         * @brief AVX2 byte order / bit reversal of 64 byte blocks, see `sse4ByteOrder_`.
+         *
+         * @tparam size element size in bytes.
+         * @tparam reverseBits also reverse bits of each byte.
+         * @param[in] source source bytes.
+         * @param[out] destination destination bytes, may equal `source`.
+         * @param[in] byteCount number of bytes.
+         * @return std::size_t number of bytes converted (whole blocks).
+         */
+        template<std::size_t size, bool reverseBits>
+        EASY_MATH_TARGET_AVX2 inline std::size_t avx2ByteOrder_(const std::uint8_t* source, std::uint8_t* destination, std::size_t byteCount) noexcept
+        {
+            [[maybe_unused]] const __m256i shuffle = _mm256_load_si256(reinterpret_cast<const __m256i*>(BYTE_REVERSE_SHUFFLE_<size>.data()));
+            [[maybe_unused]] const __m256i lowTable = _mm256_load_si256(reinterpret_cast<const __m256i*>(NIBBLE_REVERSE_<4>.data()));
+            [[maybe_unused]] const __m256i highTable = _mm256_load_si256(reinterpret_cast<const __m256i*>(NIBBLE_REVERSE_<0>.data()));
+            [[maybe_unused]] const __m256i nibble = _mm256_set1_epi8(0x0f);
+
+            std::size_t i = 0;
+            for(; i + 64 <= byteCount; i += 64)
+            {
+                // two independent vectors per iteration to keep both shuffle ports busy.
+                __m256i blocks[2] = {
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + i)),
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + i + 32))
+                };
+
+                for(auto& block : blocks)
+                {
+                    if constexpr (size > 1)
+                        block = _mm256_shuffle_epi8(block, shuffle);
+
+                    if constexpr (reverseBits)
+                    {
+#if defined(EASY_MATH_HAS_GFNI)
+                        block = _mm256_gf2p8affine_epi64_epi8(block, _mm256_set1_epi64x(GFNI_BIT_REVERSE_), 0);
+#else
+                        __m256i low = _mm256_shuffle_epi8(lowTable, _mm256_and_si256(block, nibble));
+                        __m256i high = _mm256_shuffle_epi8(highTable, _mm256_and_si256(_mm256_srli_epi16(block, 4), nibble));
+                        block = _mm256_or_si256(low, high);
+#endif
+                    }
+                }
+
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + i), blocks[0]);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + i + 32), blocks[1]);
+            }
+
+            return i;
+        }
+
+#endif
+
+#if defined(EASY_MATH_DISPATCH_AVX512BW)
+
+        /**
+         * @brief AVX-512 BW byte order / bit reversal of 64 byte blocks, see `sse4ByteOrder_`.
+         *
+         * @tparam size element size in bytes.
+         * @tparam reverseBits also reverse bits of each byte.
+         * @param[in] source source bytes.
+         * @param[out] destination destination bytes, may equal `source`.
+         * @param[in] byteCount number of bytes.
+         * @return std::size_t number of bytes converted (whole blocks).
+         */
+        template<std::size_t size, bool reverseBits>
+        EASY_MATH_TARGET_AVX512BW inline std::size_t avx512ByteOrder_(const std::uint8_t* source, std::uint8_t* destination, std::size_t byteCount) noexcept
+        {
+            [[maybe_unused]] const __m512i shuffle = _mm512_load_si512(BYTE_REVERSE_SHUFFLE_<size>.data());
+            [[maybe_unused]] const __m512i lowTable = _mm512_load_si512(NIBBLE_REVERSE_<4>.data());
+            [[maybe_unused]] const __m512i highTable = _mm512_load_si512(NIBBLE_REVERSE_<0>.data());
+            [[maybe_unused]] const __m512i nibble = _mm512_set1_epi8(0x0f);
+
+            std::size_t i = 0;
+            for(; i + 64 <= byteCount; i += 64)
+            {
+                __m512i block = _mm512_loadu_si512(source + i);
+
+                if constexpr (size > 1)
+                    block = _mm512_shuffle_epi8(block, shuffle);
+
+                if constexpr (reverseBits)
+                {
+#if defined(EASY_MATH_HAS_GFNI)
+                    block = _mm512_gf2p8affine_epi64_epi8(block, _mm512_set1_epi64(GFNI_BIT_REVERSE_), 0);
+#else
+                    __m512i low = _mm512_shuffle_epi8(lowTable, _mm512_and_si512(block, nibble));
+                    __m512i high = _mm512_shuffle_epi8(highTable, _mm512_and_si512(_mm512_srli_epi16(block, 4), nibble));
+                    block = _mm512_or_si512(low, high);
+#endif
+                }
+
+                _mm512_storeu_si512(destination + i, block);
+            }
+
+            return i;
+        }
+
+#endif
+
+        /**
+         * @brief Byte swap (and bit reversal) of a span, vector kernels for builtin types at runtime.
+         *
+         * @tparam reverseBits also reverse bits of each byte.
+         * @tparam UInt unsigned type.
+         * @param[in] values source values.
+         * @param[out] result destination, requires at least `values.size()` entries, may be `values`.
+         * @param[in] scalar scalar conversion of one value.
+         */
+        template<bool reverseBits, class UInt, class Scalar>
+        inline constexpr void byteOrderSpan_(std::span<const UInt> values, std::span<UInt> result, Scalar scalar) noexcept
+        {
+            std::size_t i = 0;
+
+            if constexpr (BuiltinUnsigned_<UInt> && (reverseBits || (sizeof(UInt) > 1)))
+            {
+                if(!std::is_constant_evaluated())
+                {
+                    [[maybe_unused]] auto source = reinterpret_cast<const std::uint8_t*>(values.data());
+                    [[maybe_unused]] auto destination = reinterpret_cast<std::uint8_t*>(result.data());
+                    [[maybe_unused]] std::size_t byteCount = values.size() * sizeof(UInt);
+                    std::size_t done = 0;
+
+#if defined(EASY_MATH_DISPATCH_AVX512BW)
+                    if(useAvx512_())
+                        done = avx512ByteOrder_<sizeof(UInt), reverseBits>(source, destination, byteCount);
+                    else
+#endif
+#if defined(EASY_MATH_DISPATCH_AVX2)
+                    if(useAvx2_())
+                        done = avx2ByteOrder_<sizeof(UInt), reverseBits>(source, destination, byteCount);
+#endif
+#if defined(EASY_MATH_DISPATCH_SSE4_2)
+                    if(useSse42_())
+                        done += sse4ByteOrder_<sizeof(UInt), reverseBits>(source + done, destination + done, byteCount - done);
+#endif
+
+                    i = done / sizeof(UInt);
+                }
+            }
+
+            for(; i < values.size(); ++i)
+                result[i] = scalar(values[i]);
+        }
+    }
+
+    /**
+     * @brief Reverse byte order of `value` (`std::byteswap` for any `UnsignedIntegral`, including `WideUInt`).
+     *
+     * @tparam UInt unsigned type, whole number of bytes.
+     * @param[in] value value.
+     * @return UInt value with reversed bytes.
+     */
+    template<UnsignedIntegral UInt>
+    [[nodiscard]] inline constexpr UInt byteSwap(UInt value) noexcept
+    {
+        static_assert(bitSize<UInt>() % 8 == 0, "byteSwap requires a whole number of bytes");
+
+        if constexpr (impl_detail_::BuiltinUnsigned_<UInt>)
+            return impl_detail_::builtinByteSwap_(value);
+        else
+        {
+            UInt result = 0;
+            for(std::size_t byte = 0; byte < bitSize<UInt>() / 8; ++byte, value >>= 8)
+                result = (result << 8) | (value & UInt(0xffu));
+            return result;
+        }
+    }
+
+    /**
+     * @brief Reverse bit order of `value` (bit `i` moves to bit `bitSize - 1 - i`).
+     *
+     * @tparam UInt unsigned type, whole number of bytes.
+     * @param[in] value value.
+     * @return UInt value with reversed bits.
+     */
+    template<UnsignedIntegral UInt>
+    [[nodiscard]] inline constexpr UInt bitReverse(UInt value) noexcept
+    {
+        static_assert(bitSize<UInt>() % 8 == 0, "bitReverse requires a whole number of bytes");
+
+        if constexpr (impl_detail_::BuiltinUnsigned_<UInt> && (sizeof(UInt) <= 8))
+            return byteSwap(static_cast<UInt>(impl_detail_::reverseBitsInBytes_(value)));
+        else if constexpr (impl_detail_::BuiltinUnsigned_<UInt>)
+        {
+            auto low = static_cast<std::uint64_t>(value), high = static_cast<std::uint64_t>(value >> 64);
+            return (static_cast<UInt>(bitReverse(low)) << 64) | bitReverse(high);
+        }
+        else
+        {
+            UInt result = 0;
+            for(std::size_t byte = 0; byte < bitSize<UInt>() / 8; ++byte, value >>= 8)
+            {
+                auto reversed = impl_detail_::reverseBitsInBytes_(static_cast<std::uint8_t>(value & UInt(0xffu)));
+                result = (result << 8) | UInt(static_cast<std::uint8_t>(reversed));
+            }
+            return result;
+        }
+    }
+
+    /// @brief Big endian representation of `value` (no-op on big endian hosts).
+    template<UnsignedIntegral UInt>
+    [[nodiscard]] inline constexpr UInt toBigEndian(UInt value) noexcept
+    {
+        if constexpr (std::endian::native == std::endian::big)
+            return value;
+        else
+            return byteSwap(value);
+    }
+
+    /// @brief Value of big endian representation `value` (no-op on big endian hosts).
+    template<UnsignedIntegral UInt>
+    [[nodiscard]] inline constexpr UInt fromBigEndian(UInt value) noexcept
+    {
+        return toBigEndian(value);
+    }
+
+    /// @brief Little endian representation of `value` (no-op on little endian hosts).
+    template<UnsignedIntegral UInt>
+    [[nodiscard]] inline constexpr UInt toLittleEndian(UInt value) noexcept
+    {
+        if constexpr (std::endian::native == std::endian::little)
+            return value;
+        else
+            return byteSwap(value);
+    }
+
+    /// @brief Value of little endian representation `value` (no-op on little endian hosts).
+    template<UnsignedIntegral UInt>
+    [[nodiscard]] inline constexpr UInt fromLittleEndian(UInt value) noexcept
+    {
+        return toLittleEndian(value);
+    }
+
+    /**
+     * @brief Reverse byte order of each value, `pshufb` (SSSE3 / AVX2 / AVX-512 BW) for builtin types at runtime.
+     *
+     * @tparam UInt unsigned type.
+     * @param[in] values source values.
+     * @param[out] result swapped values, requires at least `values.size()` entries, may be `values`.
+     */
+    template<UnsignedIntegral UInt>
+    inline constexpr void byteSwap(std::span<const UInt> values, std::span<UInt> result) noexcept
+    {
+        impl_detail_::byteOrderSpan_<false>(values, result, [](UInt value) { return byteSwap(value); });
+    }
+
+    /**
+     * @brief Reverse byte order of each value in place, see `byteSwap(std::span<const UInt>, std::span<UInt>)`.
+     *
+     * @tparam UInt unsigned type.
+     * @param[inout] values values to swap.
+     */
+    template<UnsignedIntegral UInt>
+    inline constexpr void byteSwap(std::span<UInt> values) noexcept
+    {
+        byteSwap<UInt>(std::span<const UInt>(values), values);
+    }
+
+    /**
+     * @brief Reverse bit order of each value, `pshufb` byte shuffle with nibble table lookup (or GFNI
+     * `gf2p8affineqb` when targeted) for builtin types at runtime.
+     *
+     * @tparam UInt unsigned type.
+     * @param[in] values source values.
+     * @param[out] result reversed values, requires at least `values.size()` entries, may be `values`.
+     */
+    template<UnsignedIntegral UInt>
+    inline constexpr void bitReverse(std::span<const UInt> values, std::span<UInt> result) noexcept
+    {
+        impl_detail_::byteOrderSpan_<true>(values, result, [](UInt value) { return bitReverse(value); });
+    }
+
+    /**
+     * @brief Reverse bit order of each value in place, see `bitReverse(std::span<const UInt>, std::span<UInt>)`.
+     *
+     * @tparam UInt unsigned type.
+     * @param[inout] values values to reverse.
+     */
+    template<UnsignedIntegral UInt>
+    inline constexpr void bitReverse(std::span<UInt> values) noexcept
+    {
+        bitReverse<UInt>(std::span<const UInt>(values), values);
+    }
+
+    /**
+     * @brief Big endian representation of each value, copy on big endian hosts.
+     *
+     * @tparam UInt unsigned type.
+     * @param[in] values source values.
+     * @param[out] result converted values, requires at least `values.size()` entries, may be `values`.
+     */
+    template<UnsignedIntegral UInt>
+    inline constexpr void toBigEndian(std::span<const UInt> values, std::span<UInt> result) noexcept
+    {
+        if constexpr (std::endian::native == std::endian::big)
+        {
+            if(values.data() != result.data())
+                std::copy(values.begin(), values.end(), result.begin());
+        }
+        else
+            byteSwap<UInt>(values, result);
+    }
+
+    /// @brief Big endian representation of each value in place, no-op on big endian hosts.
+    template<UnsignedIntegral UInt>
+    inline constexpr void toBigEndian(std::span<UInt> values) noexcept
+    {
+        toBigEndian<UInt>(std::span<const UInt>(values), values);
+    }
+
+    /// @brief Values of big endian representations, see `toBigEndian(std::span<const UInt>, std::span<UInt>)`.
+    template<UnsignedIntegral UInt>
+    inline constexpr void fromBigEndian(std::span<const UInt> values, std::span<UInt> result) noexcept
+    {
+        toBigEndian<UInt>(values, result);
+    }
+
+    /// @brief Values of big endian representations in place, no-op on big endian hosts.
+    template<UnsignedIntegral UInt>
+    inline constexpr void fromBigEndian(std::span<UInt> values) noexcept
+    {
+        toBigEndian<UInt>(values);
+    }
+
+    /**
+     * @brief Little endian representation of each value, copy on little endian hosts.
+     *
+     * @tparam UInt unsigned type.
+     * @param[in] values source values.
+     * @param[out] result converted values, requires at least `values.size()` entries, may be `values`.
+     */
+    template<UnsignedIntegral UInt>
+    inline constexpr void toLittleEndian(std::span<const UInt> values, std::span<UInt> result) noexcept
+    {
+        if constexpr (std::endian::native == std::endian::little)
+        {
+            if(values.data() != result.data())
+                std::copy(values.begin(), values.end(), result.begin());
+        }
+        else
+            byteSwap<UInt>(values, result);
+    }
+
+    /// @brief Little endian representation of each value in place, no-op on little endian hosts.
+    template<UnsignedIntegral UInt>
+    inline constexpr void toLittleEndian(std::span<UInt> values) noexcept
+    {
+        toLittleEndian<UInt>(std::span<const UInt>(values), values);
+    }
+
+    /// @brief Values of little endian representations, see `toLittleEndian(std::span<const UInt>, std::span<UInt>)`.
+    template<UnsignedIntegral UInt>
+    inline constexpr void fromLittleEndian(std::span<const UInt> values, std::span<UInt> result) noexcept
+    {
+        toLittleEndian<UInt>(values, result);
+    }
+
+    /// @brief Values of little endian representations in place, no-op on little endian hosts.
+    template<UnsignedIntegral UInt>
+    inline constexpr void fromLittleEndian(std::span<UInt> values) noexcept
+    {
+        toLittleEndian<UInt>(values);
+    }
+}
+
+#endif // INCLUDE_EASYMATHLIB_BYTEORDER_H_INCLUDED
@@ -0,0 +1,193 @@
+/**
+ * @file carryChain.h
+ * @author Harith Manoj
+ * @brief Multi limb add with carry and subtract with borrow over spans.
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (C) Harith Manoj
+ *
+ *
+ *                      APACHE LICENSE 2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef INCLUDE_EASYMATHLIB_CARRYCHAIN_H_INCLUDED
+
+/// @brief include\easyMathLib\carryChain.h Header Guard
+#define INCLUDE_EASYMATHLIB_CARRYCHAIN_H_INCLUDED
+
+#include <span>
+#include <concepts>
+#include <cstdint>
+#include <type_traits>
+
+#include <easyMathLib/easyMath.h>
+#include <easyMathLib/simdSupport.h>
+
+namespace easyMath
+{
+    namespace impl_detail_
+    {
+        /**
+         * @brief Add with carry, uses `_addcarry_u32/u64` (`adc`) when evaluated at runtime on x86.
+         *
+         * @tparam Limb builtin unsigned type.
+         * @param[in] carryIn carry in.
+         * @param[in] lhs left hand side of add operation.
+         * @param[in] rhs right hand side of add operation.
+         * @param[out] sum `lhs + rhs + carryIn` modulo 2^bitSize.
+         * @return unsigned char carry out (0 or 1).
+         */
+        template<std::unsigned_integral Limb>
+        [[nodiscard]] inline constexpr unsigned char limbAddCarry_(unsigned char carryIn, Limb lhs, Limb rhs, Limb& sum) noexcept
+        {
+#if defined(EASY_MATH_HAS_SSE2) && (defined(__x86_64__) || defined(_M_X64))
+            if(!std::is_constant_evaluated())
+            {
+                if constexpr (sizeof(Limb) == 8)
+                {
+                    unsigned long long out;
+                    auto carry = _addcarry_u64(carryIn, lhs, rhs, &out);
+                    sum = static_cast<Limb>(out);
+                    return carry;
+                }
+                else if constexpr (sizeof(Limb) == 4)
+                {
+                    unsigned int out;
+                    auto carry = _addcarry_u32(carryIn, lhs, rhs, &out);
+                    sum = static_cast<Limb>(out);
+                    return carry;
+                }
+            }
+#endif
+            return static_cast<unsigned char>(addCarry_<Limb>(lhs, rhs, carryIn != 0, sum));
+        }
+
+        /**
+         * @brief Subtract with borrow, uses `_subborrow_u32/u64` (`sbb`) when evaluated at runtime on x86.
+         *
+         * @tparam Limb builtin unsigned type.
+         * @param[in] borrowIn borrow in.
+         * @param[in] lhs left hand side of subtract operation.
+         * @param[in] rhs right hand side of subtract operation.
+         * @param[out] difference `lhs - rhs - borrowIn` modulo 2^bitSize.
+         * @return unsigned char borrow out (0 or 1).
+         */
+        template<std::unsigned_integral Limb>
+        [[nodiscard]] inline constexpr unsigned char limbSubtractBorrow_(unsigned char borrowIn, Limb lhs, Limb rhs, Limb& difference) noexcept
+        {
+#if defined(EASY_MATH_HAS_SSE2) && (defined(__x86_64__) || defined(_M_X64))
+            if(!std::is_constant_evaluated())
+            {
+                if constexpr (sizeof(Limb) == 8)
+                {
+                    unsigned long long out;
+                    auto borrow = _subborrow_u64(borrowIn, lhs, rhs, &out);
+                    difference = static_cast<Limb>(out);
+                    return borrow;
+                }
+                else if constexpr (sizeof(Limb) == 4)
+                {
+                    unsigned int out;
+                    auto borrow = _subborrow_u32(borrowIn, lhs, rhs, &out);
+                    difference = static_cast<Limb>(out);
+                    return borrow;
+                }
+            }
+#endif
+            return static_cast<unsigned char>(subtractBorrow_<Limb>(lhs, rhs, borrowIn != 0, difference));
+        }
+    }
+
+    /**
+     * @brief Add two little endian limb arrays, propagating carry across the whole array.
+     *
+     * `dst` may alias `lhs` or `rhs` (eg: in place accumulation). Requires `lhs` and `rhs`
+     * to hold at least `dst.size()` limbs.
+     *
+     * @tparam Limb builtin unsigned limb type.
+     * @param[out] dst destination, `dst.size()` limbs are written.
+     * @param[in] lhs left hand side limbs, index 0 least significant.
+     * @param[in] rhs right hand side limbs, index 0 least significant.
+     * @param[in] carryIn carry into the least significant limb.
+     * @return true if carry out of the most significant limb.
+     */
+    template<std::unsigned_integral Limb>
+    inline constexpr bool addWithCarry(
+        std::span<Limb> dst,
+        std::type_identity_t<std::span<const Limb>> lhs,
+        std::type_identity_t<std::span<const Limb>> rhs,
+        bool carryIn = false
+    ) noexcept
+    {
+        unsigned char carry = carryIn ? 1 : 0;
+        std::size_t size = dst.size();
+        std::size_t i = 0;
+
+        for(; i + 4 <= size; i += 4)
+        {
+            carry = impl_detail_::limbAddCarry_<Limb>(carry, lhs[i], rhs[i], dst[i]);
+            carry = impl_detail_::limbAddCarry_<Limb>(carry, lhs[i + 1], rhs[i + 1], dst[i + 1]);
+            carry = impl_detail_::limbAddCarry_<Limb>(carry, lhs[i + 2], rhs[i + 2], dst[i + 2]);
+            carry = impl_detail_::limbAddCarry_<Limb>(carry, lhs[i + 3], rhs[i + 3], dst[i + 3]);
+        }
+
+        for(; i < size; ++i)
+            carry = impl_detail_::limbAddCarry_<Limb>(carry, lhs[i], rhs[i], dst[i]);
+
+        return carry != 0;
+    }
+
+    /**
+     * @brief Subtract two little endian limb arrays (`lhs - rhs`), propagating borrow across the whole array.
+     *
+     * `dst` may alias `lhs` or `rhs` (eg: in place accumulation). Requires `lhs` and `rhs`
+     * to hold at least `dst.size()` limbs.
+     *
+     * @tparam Limb builtin unsigned limb type.
+     * @param[out] dst destination, `dst.size()` limbs are written.
+     * @param[in] lhs left hand side limbs, index 0 least significant.
+     * @param[in] rhs right hand side limbs, index 0 least significant.
+     * @param[in] borrowIn borrow into the least significant limb.
+     * @return true if borrow out of the most significant limb.
+     */
+    template<std::unsigned_integral Limb>
+    inline constexpr bool subWithBorrow(
+        std::span<Limb> dst,
+        std::type_identity_t<std::span<const Limb>> lhs,
+        std::type_identity_t<std::span<const Limb>> rhs,
+        bool borrowIn = false
+    ) noexcept
+    {
+        unsigned char borrow = borrowIn ? 1 : 0;
+        std::size_t size = dst.size();
+        std::size_t i = 0;
+
+        for(; i + 4 <= size; i += 4)
+        {
+            borrow = impl_detail_::limbSubtractBorrow_<Limb>(borrow, lhs[i], rhs[i], dst[i]);
+            borrow = impl_detail_::limbSubtractBorrow_<Limb>(borrow, lhs[i + 1], rhs[i + 1], dst[i + 1]);
+            borrow = impl_detail_::limbSubtractBorrow_<Limb>(borrow, lhs[i + 2], rhs[i + 2], dst[i + 2]);
+            borrow = impl_detail_::limbSubtractBorrow_<Limb>(borrow, lhs[i + 3], rhs[i + 3], dst[i + 3]);
+        }
+
+        for(; i < size; ++i)
+            borrow = impl_detail_::limbSubtractBorrow_<Limb>(borrow, lhs[i], rhs[i], dst[i]);
+
+        return borrow != 0;
+    }
+}
+
+#endif // INCLUDE_EASYMATHLIB_CARRYCHAIN_H_INCLUDED
@@ -29,10 +29,13 @@
 #define INCLUDE_EASYMATHLIB_EASYMATH_H_INCLUDED
 
 #include <cmath>
+#include <array>
 #include <vector>
 #include <ranges>
 #include <cstdint>
 #include <bit>
+#include <concepts>
+#include <type_traits>
 
 #include <easyLib/version.h>
 
@@ -240,6 +243,82 @@ namespace easyMath
         static constexpr bool is2sCompRepInteger = std::numeric_limits<Numeric>::is_integer;
     };
 
+#if defined(__SIZEOF_INT128__)
+    /// @brief Builtin signed 128 bit integer, spelled through `__extension__` so `-Wpedantic` builds stay warning free.
+    __extension__ typedef __int128 BuiltinInt128;
+
+    /// @brief Builtin unsigned 128 bit integer, spelled through `__extension__` so `-Wpedantic` builds stay warning free.
+    __extension__ typedef unsigned __int128 BuiltinUInt128;
+
+    namespace impl_detail_
+    {
+        /**
+         * @brief `std::numeric_limits` members for the 128 bit extension integers, not every standard library
+         * specializes them outside of GNU modes.
+         *
+         * @tparam Int128 `__int128` or `unsigned __int128`.
+         */
+        template<class Int128>
+        struct Int128Limits_
+        {
+            static constexpr bool is_specialized = true;
+            static constexpr bool is_signed = static_cast<Int128>(-1) < static_cast<Int128>(0);
+            static constexpr bool is_integer = true;
+            static constexpr bool is_exact = true;
+            static constexpr bool has_infinity = false;
+            static constexpr bool has_quiet_NaN = false;
+            static constexpr bool has_signaling_NaN = false;
+            static constexpr bool is_iec559 = false;
+            static constexpr bool is_bounded = true;
+            static constexpr bool is_modulo = !is_signed;
+            static constexpr bool traps = false;
+            static constexpr bool tinyness_before = false;
+            static constexpr int digits = is_signed ? 127 : 128;
+            static constexpr int digits10 = 38;
+            static constexpr int max_digits10 = 0;
+            static constexpr int radix = 2;
+            static constexpr int min_exponent = 0;
+            static constexpr int min_exponent10 = 0;
+            static constexpr int max_exponent = 0;
+            static constexpr int max_exponent10 = 0;
+
+            /// @brief Largest value.
+            static constexpr Int128 max() noexcept
+            {
+                return is_signed ? static_cast<Int128>(~static_cast<BuiltinUInt128>(0) >> 1) : static_cast<Int128>(~static_cast<BuiltinUInt128>(0));
+            }
+
+            /// @brief Minimum value, same as `lowest` for integers.
+            static constexpr Int128 min() noexcept { return is_signed ? -max() - 1 : 0; }
+
+            /// @brief Smallest value.
+            static constexpr Int128 lowest() noexcept { return min(); }
+
+            /// @brief Floating point only members, 0 for integers.
+            static constexpr Int128 epsilon() noexcept { return 0; }
+            static constexpr Int128 round_error() noexcept { return 0; }
+            static constexpr Int128 infinity() noexcept { return 0; }
+            static constexpr Int128 quiet_NaN() noexcept { return 0; }
+            static constexpr Int128 signaling_NaN() noexcept { return 0; }
+            static constexpr Int128 denorm_min() noexcept { return 0; }
+        };
+    }
+
+    /// @brief `__int128` is a first class 2's complement integer.
+    template<>
+    struct NumericTraits<BuiltinInt128> : public impl_detail_::Int128Limits_<BuiltinInt128>, public SelfCheckingNumericTraits<BuiltinInt128>
+    {
+        static constexpr bool is2sCompRepInteger = true;
+    };
+
+    /// @brief `unsigned __int128` is a first class unsigned integer.
+    template<>
+    struct NumericTraits<BuiltinUInt128> : public impl_detail_::Int128Limits_<BuiltinUInt128>, public SelfCheckingNumericTraits<BuiltinUInt128>
+    {
+        static constexpr bool is2sCompRepInteger = true;
+    };
+#endif
+
     /**
      * @brief Check if type is Integer of standard 2's complement representation if signed, and standard representation if unsigned.
      * 
@@ -387,9 +466,66 @@ namespace easyMath
             return impl_detail_::checkNegativeOverflow_(lhs, rhs, lowest);
     }
 
+    namespace impl_detail_
+    {
+        /**
+         * @brief Add with carry in for builtin unsigned types, lowers to a carry flag chain.
+         * 
+         * @tparam UInt builtin unsigned type.
+         * @param[in] lhs left hand side of add operation.
+         * @param[in] rhs right hand side of add operation.
+         * @param[in] carryIn carry in.
+         * @param[out] sum `lhs + rhs + carryIn` modulo 2^bitSize.
+         * @return true if carry out.
+         */
+        template<std::unsigned_integral UInt>
+        [[nodiscard]] inline constexpr bool addCarry_(UInt lhs, UInt rhs, bool carryIn, UInt& sum) noexcept
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            UInt partial;
+            bool carryPartial = __builtin_add_overflow(lhs, rhs, &partial);
+            bool carryOut = __builtin_add_overflow(partial, static_cast<UInt>(carryIn), &sum);
+            return carryPartial | carryOut;
+#else
+            UInt partial = static_cast<UInt>(lhs + rhs);
+            bool carryPartial = partial < lhs;
+            sum = static_cast<UInt>(partial + static_cast<UInt>(carryIn));
+            return carryPartial | (sum < partial);
+#endif
+        }
+
+        /**
+         * @brief Subtract with borrow in for builtin unsigned types, lowers to a borrow flag chain.
+         * 
+         * @tparam UInt builtin unsigned type.
+         * @param[in] lhs left hand side of subtract operation.
+         * @param[in] rhs right hand side of subtract operation.
+         * @param[in] borrowIn borrow in.
+         * @param[out] difference `lhs - rhs - borrowIn` modulo 2^bitSize.
+         * @return true if borrow out.
+         */
+        template<std::unsigned_integral UInt>
+        [[nodiscard]] inline constexpr bool subtractBorrow_(UInt lhs, UInt rhs, bool borrowIn, UInt& difference) noexcept
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            UInt partial;
+            bool borrowPartial = __builtin_sub_overflow(lhs, rhs, &partial);
+            bool borrowOut = __builtin_sub_overflow(partial, static_cast<UInt>(borrowIn), &difference);
+            return borrowPartial | borrowOut;
+#else
+            UInt partial = static_cast<UInt>(lhs - rhs);
+            bool borrowPartial = lhs < rhs;
+            difference = static_cast<UInt>(partial - static_cast<UInt>(borrowIn));
+            return borrowPartial | (partial < static_cast<UInt>(borrowIn));
+#endif
+        }
+    }
+
     /**
      * @brief Add lhs, rhs, and previous overflow (carry in) and report if overflow exists.
      * 
+     * For builtin unsigned types with `max` at its default, lowers to a single carry chain add.
+     * 
      * @tparam Numeric Basic type to use.
      * @param[inout] lhs left hand side of add operation.
      * @param[in] rhs right hand side of add operation.
@@ -405,6 +541,12 @@ namespace easyMath
         Numeric max = NumericTraits<Numeric>::max()
     ) noexcept
     {
+        if constexpr (std::unsigned_integral<Numeric> && !std::same_as<Numeric, bool>)
+        {
+            if(max == NumericTraits<Numeric>::max())
+                return impl_detail_::addCarry_<Numeric>(lhs, rhs, lastOpOverflow, lhs);
+        }
+
         std::uint8_t addOverflowPrevious = (lastOpOverflow? 1 : 0);
         auto overflow = willAddOverflow<Numeric>(lhs, rhs, max);
         lhs += rhs;
@@ -437,6 +579,180 @@ namespace easyMath
         return addAndCheckOverflow<Numeric>(sum, rhs, lastOpOverflow, max);
     }
 
+    /**
+     * @brief Subtract rhs and previous underflow (borrow in) from lhs and report if underflow exists.
+     * 
+     * For builtin unsigned types with `lowest` at its default, lowers to a single borrow chain subtract.
+     * 
+     * @tparam Numeric Basic type to use.
+     * @param[inout] lhs left hand side of subtract operation.
+     * @param[in] rhs right hand side of subtract operation.
+     * @param[in] lastOpUnderflow underflow in previous subtract operation (borrow in).
+     * @param[in] lowest lowest allowed (or possible) value.
+     * @return true if subtract underflows (borrow out).
+     */
+    template<class Numeric>
+    inline constexpr bool subtractAndCheckUnderflow(
+        Numeric& lhs,
+        Numeric rhs,
+        bool lastOpUnderflow = false,
+        Numeric lowest = NumericTraits<Numeric>::lowest()
+    ) noexcept
+    {
+        if constexpr (std::unsigned_integral<Numeric> && !std::same_as<Numeric, bool>)
+        {
+            if(lowest == NumericTraits<Numeric>::lowest())
+                return impl_detail_::subtractBorrow_<Numeric>(lhs, rhs, lastOpUnderflow, lhs);
+        }
+
+        std::uint8_t subtractUnderflowPrevious = (lastOpUnderflow? 1 : 0);
+        auto underflow = willSubtractUnderflow<Numeric>(lhs, rhs, NumericTraits<Numeric>::max(), lowest);
+        lhs -= rhs;
+        underflow = underflow || willSubtractUnderflow<Numeric>(lhs, subtractUnderflowPrevious, NumericTraits<Numeric>::max(), lowest);
+        lhs -= subtractUnderflowPrevious;
+        return underflow;
+    }
+
+
+    namespace impl_detail_
+    {
+        /**
+         * @brief Full 64 x 64 -> 128 bit unsigned multiply.
+         *
+         * @param[in] lhs left hand side of multiply.
+         * @param[in] rhs right hand side of multiply.
+         * @param[out] high upper 64 bits of product.
+         * @return std::uint64_t lower 64 bits of product.
+         */
+        [[nodiscard]] inline constexpr std::uint64_t multiplyFull64_(std::uint64_t lhs, std::uint64_t rhs, std::uint64_t& high) noexcept
+        {
+#if defined(__SIZEOF_INT128__)
+            auto product = static_cast<BuiltinUInt128>(lhs) * rhs;
+            high = static_cast<std::uint64_t>(product >> 64);
+            return static_cast<std::uint64_t>(product);
+#else
+            std::uint64_t lhsLow = lhs & 0xffffffffull, lhsHigh = lhs >> 32;
+            std::uint64_t rhsLow = rhs & 0xffffffffull, rhsHigh = rhs >> 32;
+
+            std::uint64_t lowLow = lhsLow * rhsLow;
+            std::uint64_t highLow = lhsHigh * rhsLow;
+            std::uint64_t lowHigh = lhsLow * rhsHigh;
+            std::uint64_t highHigh = lhsHigh * rhsHigh;
+
+            std::uint64_t middle = (lowLow >> 32) + (highLow & 0xffffffffull) + lowHigh;
+
+            high = highHigh + (highLow >> 32) + (middle >> 32);
+            return (middle << 32) | (lowLow & 0xffffffffull);
+#endif
+        }
+
+        /**
+         * @brief 128 / 64 -> 128 bit unsigned divide, lower 64 bits of quotient.
+         *
+         * @param[in] high upper 64 bits of dividend.
+         * @param[in] low lower 64 bits of dividend.
+         * @param[in] divisor divisor, requires non zero.
+         * @param[out] remainder remainder.
+         * @return std::uint64_t lower 64 bits of quotient.
+         */
+        [[nodiscard]] inline constexpr std::uint64_t divideFull64_(std::uint64_t high, std::uint64_t low, std::uint64_t divisor, std::uint64_t& remainder) noexcept
+        {
+#if defined(__SIZEOF_INT128__)
+            auto dividend = (static_cast<BuiltinUInt128>(high) << 64) | low;
+            remainder = static_cast<std::uint64_t>(dividend % divisor);
+            return static_cast<std::uint64_t>(dividend / divisor);
+#else
+            // upper quotient bits are dropped, restoring division of the low word by bits.
+            std::uint64_t partial = high % divisor;
+            std::uint64_t quotient = 0;
+
+            for(std::size_t bit = 64; bit-- > 0;)
+            {
+                bool isOver = (partial >> 63) != 0;
+                partial = (partial << 1) | ((low >> bit) & 1);
+                quotient <<= 1;
+
+                if(isOver || (partial >= divisor))
+                {
+                    partial -= divisor;
+                    quotient |= 1;
+                }
+            }
+
+            remainder = partial;
+            return quotient;
+#endif
+        }
+    }
+
+    /**
+     * @brief Upper 64 bits of the full 128 bit unsigned product (`mulhi`).
+     *
+     * @param[in] lhs left hand side of multiply.
+     * @param[in] rhs right hand side of multiply.
+     * @return std::uint64_t `(lhs * rhs) >> 64`.
+     */
+    [[nodiscard]] inline constexpr std::uint64_t multiplyHigh64(std::uint64_t lhs, std::uint64_t rhs) noexcept
+    {
+        std::uint64_t high;
+        static_cast<void>(impl_detail_::multiplyFull64_(lhs, rhs, high));
+        return high;
+    }
+
+    /**
+     * @brief Upper 64 bits of the full 128 bit signed product.
+     *
+     * @param[in] lhs left hand side of multiply.
+     * @param[in] rhs right hand side of multiply.
+     * @return std::int64_t `(lhs * rhs) >> 64` (arithmetic).
+     */
+    [[nodiscard]] inline constexpr std::int64_t multiplyHighSigned64(std::int64_t lhs, std::int64_t rhs) noexcept
+    {
+        auto unsignedLhs = static_cast<std::uint64_t>(lhs), unsignedRhs = static_cast<std::uint64_t>(rhs);
+
+        // signed high = unsigned high - (lhs < 0 ? rhs : 0) - (rhs < 0 ? lhs : 0).
+        std::uint64_t lhsSign = std::uint64_t{0} - (unsignedLhs >> 63), rhsSign = std::uint64_t{0} - (unsignedRhs >> 63);
+        return static_cast<std::int64_t>(multiplyHigh64(unsignedLhs, unsignedRhs) - (lhsSign & unsignedRhs) - (rhsSign & unsignedLhs));
+    }
+
+    /**
+     * @brief Full 64 x 64 -> 128 bit unsigned multiply.
+     *
+     * @param[in] lhs left hand side of multiply.
+     * @param[in] rhs right hand side of multiply.
+     * @param[out] high upper 64 bits of product.
+     * @return std::uint64_t lower 64 bits of product.
+     */
+    [[nodiscard]] inline constexpr std::uint64_t multiplyFull64(std::uint64_t lhs, std::uint64_t rhs, std::uint64_t& high) noexcept
+    {
+        return impl_detail_::multiplyFull64_(lhs, rhs, high);
+    }
+
+    /**
+     * @brief 128 / 64 -> 64 bit unsigned divide with remainder (`divmod`).
+     *
+     * Quotient must fit 64 bits, ie requires `high < divisor`. On x86-64 lowers to a single `div` instead of the
+     * 128 bit division library call.
+     *
+     * @param[in] high upper 64 bits of dividend, requires less than `divisor`.
+     * @param[in] low lower 64 bits of dividend.
+     * @param[in] divisor divisor, requires non zero.
+     * @param[out] remainder remainder.
+     * @return std::uint64_t quotient.
+     */
+    [[nodiscard]] inline constexpr std::uint64_t divideFull64(std::uint64_t high, std::uint64_t low, std::uint64_t divisor, std::uint64_t& remainder) noexcept
+    {
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+        if(!std::is_constant_evaluated())
+        {
+            std::uint64_t quotient;
+            __asm__("divq %[divisor]" : "=a"(quotient), "=d"(remainder) : [divisor] "rm"(divisor), "a"(low), "d"(high));
+            return quotient;
+        }
+#endif
+        return impl_detail_::divideFull64_(high, low, divisor, remainder);
+    }
+
 
     /**
      * @brief Acquire bitsize of each item.
@@ -646,9 +962,9 @@ namespace easyMath
     {
         std::array<Destination, divideRoundUp<std::size_t>(bitSize<Source>(), destSize_)> ret;
 
-        for(std::size_t i = 0; i < ret; ++i)
+        for(std::size_t i = 0; i < ret.size(); ++i)
         {
-            ret[i] = static_cast<decltype(ret)::value_type>(value & nBitMask<Source>(destSize_));
+            ret[i] = static_cast<Destination>(value & nBitMask<Source>(destSize_));
             value = value >> destSize_;
         }
 
@@ -0,0 +1,512 @@
+/**
+ * @file morton.h
+ * @author Harith Manoj
+ * @brief Morton (Z-order) encode / decode of 2D and 3D unsigned integer coordinates.
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (C) Harith Manoj
+ *
+ *
+ *                      APACHE LICENSE 2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef INCLUDE_EASYMATHLIB_MORTON_H_INCLUDED
+
+/// @brief include\easyMathLib\morton.h Header Guard
+#define INCLUDE_EASYMATHLIB_MORTON_H_INCLUDED
+
+#include <span>
+#include <array>
+#include <concepts>
+#include <cstdint>
+#include <type_traits>
+
+#include <easyMathLib/easyMath.h>
+#include <easyMathLib/simdSupport.h>
+#include <easyMathLib/WideUInt.h>
+
+namespace easyMath
+{
+    /**
+     * @brief Builtin unsigned coordinate type (8 to 64 bits) accepted by Morton kernels.
+     *
+     * @tparam Coordinate type to check.
+     */
+    template<class Coordinate>
+    concept MortonCoordinate = std::unsigned_integral<Coordinate> && !std::same_as<Coordinate, bool>;
+
+    /**
+     * @brief Morton code type, smallest unsigned integer holding `Dimensions * bitSize<Coordinate>()` bits,
+     * `WideUInt` beyond 64 bits (eg: 2D 64 bit coordinates give `UInt128`).
+     *
+     * @tparam Coordinate coordinate type.
+     * @tparam Dimensions number of dimensions (2 or 3).
+     */
+    template<MortonCoordinate Coordinate, std::size_t Dimensions>
+    using MortonCode = std::conditional_t<
+        (bitSize<Coordinate>() * Dimensions <= 64),
+        SizeCapableUint<bitSize<Coordinate>() * Dimensions>,
+        WideUInt<(bitSize<Coordinate>() * Dimensions + 63) / 64 * 64>
+    >;
+
+    namespace impl_detail_
+    {
+        /**
+         * @brief Coordinate bits interleaved into one 64 bit piece (2D: 32, 3D: 21).
+         *
+         * @tparam Dimensions number of dimensions.
+         */
+        template<std::size_t Dimensions>
+        constexpr std::size_t MORTON_CHUNK_BITS_ = 64 / Dimensions;
+
+        /**
+         * @brief Bit positions of one coordinate in a 64 bit piece.
+         *
+         * @tparam Dimensions number of dimensions.
+         */
+        template<std::size_t Dimensions>
+        constexpr std::uint64_t MORTON_SPREAD_MASK_ = (Dimensions == 2) ? 0x5555555555555555ull : 0x1249249249249249ull;
+
+        /**
+         * @brief Spread lower `MORTON_CHUNK_BITS_` bits of `value` to every `Dimensions`-th bit.
+         *
+         * Uses BMI2 `pdep` at runtime when available, magic number shift / mask steps otherwise.
+         *
+         * @tparam Dimensions number of dimensions.
+         * @param[in] value bits to spread, requires `value < 2^MORTON_CHUNK_BITS_`.
+         * @return std::uint64_t spread bits.
+         */
+        template<std::size_t Dimensions>
+        [[nodiscard]] inline constexpr std::uint64_t mortonSpread_(std::uint64_t value) noexcept
+        {
+#if defined(EASY_MATH_HAS_BMI2) && (defined(__x86_64__) || defined(_M_X64))
+            if(!std::is_constant_evaluated())
+                return _pdep_u64(value, MORTON_SPREAD_MASK_<Dimensions>);
+#endif
+            if constexpr (Dimensions == 2)
+            {
+                value = (value | (value << 16)) & 0x0000ffff0000ffffull;
+                value = (value | (value << 8)) & 0x00ff00ff00ff00ffull;
+                value = (value | (value << 4)) & 0x0f0f0f0f0f0f0f0full;
+                value = (value | (value << 2)) & 0x3333333333333333ull;
+                value = (value | (value << 1)) & 0x5555555555555555ull;
+            }
+            else
+            {
+                value = (value | (value << 32)) & 0x001f00000000ffffull;
+                value = (value | (value << 16)) & 0x001f0000ff0000ffull;
+                value = (value | (value << 8)) & 0x100f00f00f00f00full;
+                value = (value | (value << 4)) & 0x10c30c30c30c30c3ull;
+                value = (value | (value << 2)) & 0x1249249249249249ull;
+            }
+
+            return value;
+        }
+
+        /**
+         * @brief Gather every `Dimensions`-th bit of `value` (inverse of `mortonSpread_`).
+         *
+         * Uses BMI2 `pext` at runtime when available, magic number shift / mask steps otherwise.
+         *
+         * @tparam Dimensions number of dimensions.
+         * @param[in] value spread bits.
+         * @return std::uint64_t compacted bits.
+         */
+        template<std::size_t Dimensions>
+        [[nodiscard]] inline constexpr std::uint64_t mortonCompact_(std::uint64_t value) noexcept
+        {
+#if defined(EASY_MATH_HAS_BMI2) && (defined(__x86_64__) || defined(_M_X64))
+            if(!std::is_constant_evaluated())
+                return _pext_u64(value, MORTON_SPREAD_MASK_<Dimensions>);
+#endif
+            value &= MORTON_SPREAD_MASK_<Dimensions>;
+
+            if constexpr (Dimensions == 2)
+            {
+                value = (value | (value >> 1)) & 0x3333333333333333ull;
+                value = (value | (value >> 2)) & 0x0f0f0f0f0f0f0f0full;
+                value = (value | (value >> 4)) & 0x00ff00ff00ff00ffull;
+                value = (value | (value >> 8)) & 0x0000ffff0000ffffull;
+                value = (value | (value >> 16)) & 0x00000000ffffffffull;
+            }
+            else
+            {
+                value = (value | (value >> 2)) & 0x10c30c30c30c30c3ull;
+                value = (value | (value >> 4)) & 0x100f00f00f00f00full;
+                value = (value | (value >> 8)) & 0x001f0000ff0000ffull;
+                value = (value | (value >> 16)) & 0x001f00000000ffffull;
+                value = (value | (value >> 32)) & 0x00000000001fffffull;
+            }
+
+            return value;
+        }
+
+        /**
+         * @brief Interleave coordinates, processed in `MORTON_CHUNK_BITS_` chunks written to consecutive pieces.
+         *
+         * @tparam Dimensions number of dimensions.
+         * @tparam Coordinate coordinate type.
+         * @param[in] coordinates coordinates, index 0 at the least significant interleaved bit.
+         * @return MortonCode<Coordinate, Dimensions> code.
+         */
+        template<std::size_t Dimensions, class Coordinate>
+        [[nodiscard]] inline constexpr MortonCode<Coordinate, Dimensions> mortonEncode_(
+            const std::array<Coordinate, Dimensions>& coordinates
+        ) noexcept
+        {
+            using Code = MortonCode<Coordinate, Dimensions>;
+
+            constexpr std::size_t coordinateBits = bitSize<Coordinate>();
+            constexpr std::size_t chunkBits = MORTON_CHUNK_BITS_<Dimensions>;
+
+            if constexpr (coordinateBits * Dimensions <= 64)
+            {
+                std::uint64_t code = 0;
+
+                for(std::size_t d = 0; d < Dimensions; ++d)
+                    code |= mortonSpread_<Dimensions>(coordinates[d]) << d;
+
+                return static_cast<Code>(code);
+            }
+            else
+            {
+                std::array<std::uint64_t, Code::LIMB_COUNT> limbs{};
+
+                for(std::size_t offset = 0; offset < coordinateBits; offset += chunkBits)
+                {
+                    std::uint64_t piece = 0;
+
+                    for(std::size_t d = 0; d < Dimensions; ++d)
+                        piece |= mortonSpread_<Dimensions>((static_cast<std::uint64_t>(coordinates[d]) >> offset) & nBitMask<std::uint64_t>(chunkBits)) << d;
+
+                    std::size_t bit = offset * Dimensions;
+                    limbs[bit / 64] |= piece << (bit % 64);
+                    if((bit % 64 != 0) && (bit / 64 + 1 < limbs.size()))
+                        limbs[bit / 64 + 1] |= piece >> (64 - bit % 64);
+                }
+
+                return Code(limbs);
+            }
+        }
+
+        /**
+         * @brief Split code into coordinates (inverse of `mortonEncode_`).
+         *
+         * @tparam Dimensions number of dimensions.
+         * @tparam Coordinate coordinate type.
+         * @param[in] code Morton code.
+         * @return std::array<Coordinate, Dimensions> coordinates.
+         */
+        template<std::size_t Dimensions, class Coordinate>
+        [[nodiscard]] inline constexpr std::array<Coordinate, Dimensions> mortonDecode_(
+            const MortonCode<Coordinate, Dimensions>& code
+        ) noexcept
+        {
+            constexpr std::size_t coordinateBits = bitSize<Coordinate>();
+            constexpr std::size_t chunkBits = MORTON_CHUNK_BITS_<Dimensions>;
+
+            std::array<Coordinate, Dimensions> coordinates{};
+
+            if constexpr (coordinateBits * Dimensions <= 64)
+            {
+                for(std::size_t d = 0; d < Dimensions; ++d)
+                    coordinates[d] = static_cast<Coordinate>(mortonCompact_<Dimensions>(static_cast<std::uint64_t>(code) >> d));
+            }
+            else
+            {
+                const auto& limbs = code.limbs();
+
+                for(std::size_t offset = 0; offset < coordinateBits; offset += chunkBits)
+                {
+                    std::size_t bit = offset * Dimensions;
+                    std::uint64_t piece = limbs[bit / 64] >> (bit % 64);
+                    if((bit % 64 != 0) && (bit / 64 + 1 < limbs.size()))
+                        piece |= limbs[bit / 64 + 1] << (64 - bit % 64);
+
+                    for(std::size_t d = 0; d < Dimensions; ++d)
+                        coordinates[d] |= static_cast<Coordinate>(mortonCompact_<Dimensions>(piece >> d) << offset);
+                }
+            }
+
+            return coordinates;
+        }
+
+#if defined(EASY_MATH_DISPATCH_AVX2)
+
+        /// @brief One magic number step, `(lanes | lanes << shift) & mask`.
+        [[nodiscard]] EASY_MATH_TARGET_AVX2 inline __m256i avx2MortonStep_(__m256i lanes, int shift, std::uint64_t mask) noexcept
+        {
+            return _mm256_and_si256(
+                _mm256_or_si256(lanes, _mm256_slli_epi64(lanes, shift)),
+                _mm256_set1_epi64x(static_cast<long long>(mask))
+            );
+        }
+
+        /**
+         * @brief AVX2 spread of four 64 bit lanes (magic number steps, see `mortonSpread_`).
+         *
+         * @tparam Dimensions number of dimensions.
+         * @param[in] value lanes holding at most `MORTON_CHUNK_BITS_` bits.
+         * @return __m256i spread lanes.
+         */
+        template<std::size_t Dimensions>
+        [[nodiscard]] EASY_MATH_TARGET_AVX2 inline __m256i avx2MortonSpread_(__m256i value) noexcept
+        {
+            if constexpr (Dimensions == 2)
+            {
+                value = avx2MortonStep_(value, 16, 0x0000ffff0000ffffull);
+                value = avx2MortonStep_(value, 8, 0x00ff00ff00ff00ffull);
+                value = avx2MortonStep_(value, 4, 0x0f0f0f0f0f0f0f0full);
+                value = avx2MortonStep_(value, 2, 0x3333333333333333ull);
+                return avx2MortonStep_(value, 1, 0x5555555555555555ull);
+            }
+            else
+            {
+                value = avx2MortonStep_(value, 32, 0x001f00000000ffffull);
+                value = avx2MortonStep_(value, 16, 0x001f0000ff0000ffull);
+                value = avx2MortonStep_(value, 8, 0x100f00f00f00f00full);
+                value = avx2MortonStep_(value, 4, 0x10c30c30c30c30c3ull);
+                return avx2MortonStep_(value, 2, 0x1249249249249249ull);
+            }
+        }
+
+        /**
+         * @brief AVX2 part of the 2D span `mortonEncode2` for 32 bit coordinates, four points per step.
+         *
+         * @return std::size_t number of points encoded.
+         */
+        template<class Coordinate>
+        EASY_MATH_TARGET_AVX2 inline std::size_t avx2MortonEncode2_(
+            std::span<const Coordinate> xs,
+            std::span<const Coordinate> ys,
+            std::span<MortonCode<Coordinate, 2>> codes
+        ) noexcept
+        {
+            std::size_t i = 0;
+
+            for(; i + 4 <= xs.size(); i += 4)
+            {
+                auto x = _mm256_cvtepu32_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(xs.data() + i)));
+                auto y = _mm256_cvtepu32_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ys.data() + i)));
+
+                auto code = _mm256_or_si256(avx2MortonSpread_<2>(x), _mm256_slli_epi64(avx2MortonSpread_<2>(y), 1));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(codes.data() + i), code);
+            }
+
+            return i;
+        }
+
+        /**
+         * @brief AVX2 part of the 3D span `mortonEncode3` for 16 bit coordinates, four points per step.
+         *
+         * @return std::size_t number of points encoded.
+         */
+        template<class Coordinate>
+        EASY_MATH_TARGET_AVX2 inline std::size_t avx2MortonEncode3_(
+            std::span<const Coordinate> xs,
+            std::span<const Coordinate> ys,
+            std::span<const Coordinate> zs,
+            std::span<MortonCode<Coordinate, 3>> codes
+        ) noexcept
+        {
+            std::size_t i = 0;
+
+            for(; i + 4 <= xs.size(); i += 4)
+            {
+                auto x = _mm256_cvtepu16_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(xs.data() + i)));
+                auto y = _mm256_cvtepu16_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(ys.data() + i)));
+                auto z = _mm256_cvtepu16_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(zs.data() + i)));
+
+                auto code = _mm256_or_si256(
+                    _mm256_or_si256(avx2MortonSpread_<3>(x), _mm256_slli_epi64(avx2MortonSpread_<3>(y), 1)),
+                    _mm256_slli_epi64(avx2MortonSpread_<3>(z), 2)
+                );
+
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(codes.data() + i), code);
+            }
+
+            return i;
+        }
+
+#endif
+    }
+
+    /**
+     * @brief Interleave bits of 2D coordinates (`x` on even bits, `y` on odd bits).
+     *
+     * @tparam Coordinate coordinate type, 8 to 64 bit unsigned.
+     * @param[in] x first coordinate.
+     * @param[in] y second coordinate.
+     * @return MortonCode<Coordinate, 2> Z-order code (`UInt128` for 64 bit coordinates).
+     */
+    template<MortonCoordinate Coordinate>
+    [[nodiscard]] inline constexpr MortonCode<Coordinate, 2> mortonEncode2(Coordinate x, Coordinate y) noexcept
+    {
+        return impl_detail_::mortonEncode_<2, Coordinate>({x, y});
+    }
+
+    /**
+     * @brief Interleave bits of 3D coordinates (`x` at bits 0 mod 3, `y` at 1 mod 3, `z` at 2 mod 3).
+     *
+     * @tparam Coordinate coordinate type, 8 to 64 bit unsigned.
+     * @param[in] x first coordinate.
+     * @param[in] y second coordinate.
+     * @param[in] z third coordinate.
+     * @return MortonCode<Coordinate, 3> Z-order code (`WideUInt` for 32 and 64 bit coordinates).
+     */
+    template<MortonCoordinate Coordinate>
+    [[nodiscard]] inline constexpr MortonCode<Coordinate, 3> mortonEncode3(Coordinate x, Coordinate y, Coordinate z) noexcept
+    {
+        return impl_detail_::mortonEncode_<3, Coordinate>({x, y, z});
+    }
+
+    /**
+     * @brief Split 2D Morton code into coordinates.
+     *
+     * @tparam Coordinate coordinate type.
+     * @param[in] code code produced by `mortonEncode2<Coordinate>`.
+     * @return std::array<Coordinate, 2> `{x, y}`.
+     */
+    template<MortonCoordinate Coordinate>
+    [[nodiscard]] inline constexpr std::array<Coordinate, 2> mortonDecode2(const std::type_identity_t<MortonCode<Coordinate, 2>>& code) noexcept
+    {
+        return impl_detail_::mortonDecode_<2, Coordinate>(code);
+    }
+
+    /**
+     * @brief Split 3D Morton code into coordinates.
+     *
+     * @tparam Coordinate coordinate type.
+     * @param[in] code code produced by `mortonEncode3<Coordinate>`.
+     * @return std::array<Coordinate, 3> `{x, y, z}`.
+     */
+    template<MortonCoordinate Coordinate>
+    [[nodiscard]] inline constexpr std::array<Coordinate, 3> mortonDecode3(const std::type_identity_t<MortonCode<Coordinate, 3>>& code) noexcept
+    {
+        return impl_detail_::mortonDecode_<3, Coordinate>(code);
+    }
+
+    /**
+     * @brief Encode 2D points, `codes[i] = mortonEncode2(xs[i], ys[i])`.
+     *
+     * 32 bit coordinates use AVX2 spreading of four points per step when allowed by `easyLib::cpuTier()`.
+     *
+     * @tparam Coordinate coordinate type.
+     * @param[in] xs first coordinates.
+     * @param[in] ys second coordinates, requires `ys.size() >= xs.size()`.
+     * @param[out] codes destination, requires `codes.size() >= xs.size()`.
+     */
+    template<MortonCoordinate Coordinate>
+    inline void mortonEncode2(
+        std::type_identity_t<std::span<const Coordinate>> xs,
+        std::type_identity_t<std::span<const Coordinate>> ys,
+        std::span<MortonCode<Coordinate, 2>> codes
+    ) noexcept
+    {
+        std::size_t i = 0;
+
+#if defined(EASY_MATH_DISPATCH_AVX2)
+        if constexpr (sizeof(Coordinate) == 4)
+            if(impl_detail_::useAvx2_())
+                i = impl_detail_::avx2MortonEncode2_<Coordinate>(xs, ys, codes);
+#endif
+
+        for(; i < xs.size(); ++i)
+            codes[i] = mortonEncode2<Coordinate>(xs[i], ys[i]);
+    }
+
+    /**
+     * @brief Encode 3D points, `codes[i] = mortonEncode3(xs[i], ys[i], zs[i])`.
+     *
+     * 16 bit coordinates use AVX2 spreading of four points per step when allowed by `easyLib::cpuTier()`.
+     *
+     * @tparam Coordinate coordinate type.
+     * @param[in] xs first coordinates.
+     * @param[in] ys second coordinates, requires `ys.size() >= xs.size()`.
+     * @param[in] zs third coordinates, requires `zs.size() >= xs.size()`.
+     * @param[out] codes destination, requires `codes.size() >= xs.size()`.
+     */
+    template<MortonCoordinate Coordinate>
+    inline void mortonEncode3(
+        std::type_identity_t<std::span<const Coordinate>> xs,
+        std::type_identity_t<std::span<const Coordinate>> ys,
+        std::type_identity_t<std::span<const Coordinate>> zs,
+        std::span<MortonCode<Coordinate, 3>> codes
+    ) noexcept
+    {
+        std::size_t i = 0;
+
+#if defined(EASY_MATH_DISPATCH_AVX2)
+        if constexpr (sizeof(Coordinate) == 2)
+            if(impl_detail_::useAvx2_())
+                i = impl_detail_::avx2MortonEncode3_<Coordinate>(xs, ys, zs, codes);
+#endif
+
+        for(; i < xs.size(); ++i)
+            codes[i] = mortonEncode3<Coordinate>(xs[i], ys[i], zs[i]);
+    }
+
+    /**
+     * @brief Decode 2D codes, `{xs[i], ys[i]} = mortonDecode2(codes[i])`.
+     *
+     * @tparam Coordinate coordinate type.
+     * @param[in] codes codes.
+     * @param[out] xs first coordinates, requires `xs.size() >= codes.size()`.
+     * @param[out] ys second coordinates, requires `ys.size() >= codes.size()`.
+     */
+    template<MortonCoordinate Coordinate>
+    inline void mortonDecode2(
+        std::type_identity_t<std::span<const MortonCode<Coordinate, 2>>> codes,
+        std::span<Coordinate> xs,
+        std::span<Coordinate> ys
+    ) noexcept
+    {
+        for(std::size_t i = 0; i < codes.size(); ++i)
+        {
+            auto [x, y] = mortonDecode2<Coordinate>(codes[i]);
+            xs[i] = x;
+            ys[i] = y;
+        }
+    }
+
+    /**
+     * @brief Decode 3D codes, `{xs[i], ys[i], zs[i]} = mortonDecode3(codes[i])`.
+     *
+     * @tparam Coordinate coordinate type.
+     * @param[in] codes codes.
+     * @param[out] xs first coordinates, requires `xs.size() >= codes.size()`.
+     * @param[out] ys second coordinates, requires `ys.size() >= codes.size()`.
+     * @param[out] zs third coordinates, requires `zs.size() >= codes.size()`.
+     */
+    template<MortonCoordinate Coordinate>
+    inline void mortonDecode3(
+        std::type_identity_t<std::span<const MortonCode<Coordinate, 3>>> codes,
+        std::span<Coordinate> xs,
+        std::span<Coordinate> ys,
+        std::span<Coordinate> zs
+    ) noexcept
+    {
+        for(std::size_t i = 0; i < codes.size(); ++i)
+        {
+            auto [x, y, z] = mortonDecode3<Coordinate>(codes[i]);
+            xs[i] = x;
+            ys[i] = y;
+            zs[i] = z;
+        }
+    }
+}
+
+#endif // INCLUDE_EASYMATHLIB_MORTON_H_INCLUDED
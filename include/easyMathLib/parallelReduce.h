@@ -0,0 +1,681 @@
+/**
+ * @file parallelReduce.h
+ * @author Harith Manoj
+ * @brief Multi threaded overflow checked sum and prefix sums (inclusive / exclusive scan) of integers.
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (C) Harith Manoj
+ *
+ *
+ *                      APACHE LICENSE 2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef INCLUDE_EASYMATHLIB_PARALLELREDUCE_H_INCLUDED
+
+/// @brief include\easyMathLib\parallelReduce.h Header Guard
+#define INCLUDE_EASYMATHLIB_PARALLELREDUCE_H_INCLUDED
+
+#include <span>
+#include <thread>
+#include <vector>
+#include <compare>
+#include <cstdint>
+#include <algorithm>
+#include <type_traits>
+
+#include <easyMathLib/easyMath.h>
+#include <easyMathLib/simdSupport.h>
+#include <easyMathLib/Checked.h>
+
+namespace easyMath
+{
+    /// @brief Parallel reduction configuration.
+    struct ReduceOptions
+    {
+        /// @brief Number of threads used (0: `std::thread::hardware_concurrency()`).
+        std::size_t threadCount = 1;
+    };
+
+    namespace impl_detail_
+    {
+        /// @brief Minimum number of elements per thread before another thread is used.
+        constexpr std::size_t PARALLEL_CHUNK_MIN_ = std::size_t{1} << 16;
+
+        /**
+         * @brief Run `function(i)` for i in `[0, count)`, each on its own thread (0 on the calling thread).
+         *
+         * @param[in] count number of invocations.
+         * @param[in] function callable taking `std::size_t`.
+         */
+        template<class Function>
+        inline void parallelFor_(std::size_t count, Function&& function)
+        {
+            std::vector<std::thread> threads;
+            threads.reserve(count - 1);
+
+            for(std::size_t i = 1; i < count; ++i)
+                threads.emplace_back([&function, i]() { function(i); });
+
+            function(0);
+
+            for(auto& thread : threads)
+                thread.join();
+        }
+
+#if defined(EASY_MATH_DISPATCH_AVX2)
+
+        /**
+         * @brief AVX2 part of `prefixSum_` for 32 / 64 bit values, whole vectors only.
+         *
+         * @param[inout] start value preceding `values[0]`, updated to the last running sum written.
+         * @return std::size_t number of values processed.
+         */
+        template<bool isExclusive, class Integer>
+        EASY_MATH_TARGET_AVX2 inline std::size_t avx2PrefixSum_(std::span<const Integer> values, std::span<Integer> result, Integer& start, Integer step) noexcept
+        {
+            std::size_t i = 0;
+
+            if constexpr (sizeof(Integer) == 4)
+            {
+                auto carry = _mm256_set1_epi32(static_cast<int>(start));
+                auto steps = _mm256_set1_epi32(static_cast<int>(step));
+
+                for(; i + 8 <= values.size(); i += 8)
+                {
+                    auto deltas = _mm256_add_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(values.data() + i)), steps);
+                    auto x = _mm256_add_epi32(deltas, _mm256_slli_si256(deltas, 4));
+                    x = _mm256_add_epi32(x, _mm256_slli_si256(x, 8));
+                    // carry the low half total into the high half.
+                    x = _mm256_add_epi32(x, _mm256_shuffle_epi32(_mm256_permute2x128_si256(x, x, 0x08), 0xff));
+                    x = _mm256_add_epi32(x, carry);
+
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(result.data() + i), isExclusive ? _mm256_sub_epi32(x, deltas) : x);
+                    carry = _mm256_permutevar8x32_epi32(x, _mm256_set1_epi32(7));
+                }
+
+                start = static_cast<Integer>(_mm256_cvtsi256_si32(carry));
+            }
+            else if constexpr (sizeof(Integer) == 8)
+            {
+                auto carry = _mm256_set1_epi64x(static_cast<long long>(start));
+                auto steps = _mm256_set1_epi64x(static_cast<long long>(step));
+
+                for(; i + 4 <= values.size(); i += 4)
+                {
+                    auto deltas = _mm256_add_epi64(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(values.data() + i)), steps);
+                    auto x = _mm256_add_epi64(deltas, _mm256_slli_si256(deltas, 8));
+                    auto low = _mm256_permute2x128_si256(x, x, 0x08);
+                    x = _mm256_add_epi64(x, _mm256_unpackhi_epi64(low, low));
+                    x = _mm256_add_epi64(x, carry);
+
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(result.data() + i), isExclusive ? _mm256_sub_epi64(x, deltas) : x);
+                    carry = _mm256_permute4x64_epi64(x, 0xff);
+                }
+
+                start = static_cast<Integer>(_mm_cvtsi128_si64(_mm256_castsi256_si128(carry)));
+            }
+
+            return i;
+        }
+
+#endif
+
+#if defined(EASY_MATH_HAS_SSE2) && (defined(__x86_64__) || defined(_M_X64))
+
+        /**
+         * @brief SSE2 part of `prefixSum_` for 32 / 64 bit values, whole vectors only.
+         *
+         * @param[inout] start value preceding `values[0]`, updated to the last running sum written.
+         * @return std::size_t number of values processed.
+         */
+        template<bool isExclusive, class Integer>
+        inline std::size_t sse2PrefixSum_(std::span<const Integer> values, std::span<Integer> result, Integer& start, Integer step) noexcept
+        {
+            std::size_t i = 0;
+
+            if constexpr (sizeof(Integer) == 4)
+            {
+                auto carry = _mm_set1_epi32(static_cast<int>(start));
+                auto steps = _mm_set1_epi32(static_cast<int>(step));
+
+                for(; i + 4 <= values.size(); i += 4)
+                {
+                    auto deltas = _mm_add_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(values.data() + i)), steps);
+                    auto x = _mm_add_epi32(deltas, _mm_slli_si128(deltas, 4));
+                    x = _mm_add_epi32(x, _mm_slli_si128(x, 8));
+                    x = _mm_add_epi32(x, carry);
+
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(result.data() + i), isExclusive ? _mm_sub_epi32(x, deltas) : x);
+                    carry = _mm_shuffle_epi32(x, 0xff);
+                }
+
+                start = static_cast<Integer>(_mm_cvtsi128_si32(carry));
+            }
+            else if constexpr (sizeof(Integer) == 8)
+            {
+                auto carry = _mm_set1_epi64x(static_cast<long long>(start));
+                auto steps = _mm_set1_epi64x(static_cast<long long>(step));
+
+                for(; i + 2 <= values.size(); i += 2)
+                {
+                    auto deltas = _mm_add_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(values.data() + i)), steps);
+                    auto x = _mm_add_epi64(deltas, _mm_slli_si128(deltas, 8));
+                    x = _mm_add_epi64(x, carry);
+
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(result.data() + i), isExclusive ? _mm_sub_epi64(x, deltas) : x);
+                    carry = _mm_unpackhi_epi64(x, x);
+                }
+
+                start = static_cast<Integer>(_mm_cvtsi128_si64(carry));
+            }
+
+            return i;
+        }
+
+#endif
+
+        /**
+         * @brief Running sum `result[i] = start + sum_{j <= i}(values[j] + step)` (modular), or the sum over
+         * `j < i` if `isExclusive`.
+         *
+         * Vectorised in register prefix sums for 32 / 64 bit values (SSE2, AVX2 if allowed by `easyLib::cpuTier()`).
+         *
+         * @tparam isExclusive exclude `values[i]` from `result[i]`.
+         * @tparam Integer value type.
+         * @param[in] values deltas.
+         * @param[out] result running sums, requires `result.size() >= values.size()`, may alias `values`.
+         * @param[in] start value preceding `values[0]`.
+         * @param[in] step constant added to every delta.
+         * @return Integer sum including the last value.
+         */
+        template<bool isExclusive, class Integer>
+        inline constexpr Integer prefixSum_(std::span<const Integer> values, std::span<Integer> result, Integer start, Integer step) noexcept
+        {
+            std::size_t i = 0;
+
+            if(!std::is_constant_evaluated())
+            {
+#if defined(EASY_MATH_DISPATCH_AVX2)
+                if(useAvx2_())
+                    i = avx2PrefixSum_<isExclusive, Integer>(values, result, start, step);
+#endif
+#if defined(EASY_MATH_HAS_SSE2) && (defined(__x86_64__) || defined(_M_X64))
+                if(useSse2_())
+                    i += sse2PrefixSum_<isExclusive, Integer>(values.subspan(i), result.subspan(i), start, step);
+#endif
+            }
+
+            using UInt = std::make_unsigned_t<Integer>;
+
+            for(; i < values.size(); ++i)
+            {
+                auto next = static_cast<Integer>(static_cast<UInt>(start) + static_cast<UInt>(values[i]) + static_cast<UInt>(step));
+                result[i] = isExclusive ? start : next;
+                start = next;
+            }
+
+            return start;
+        }
+
+        /// @brief Exact sum of 64 bit integers, `high * 2^64 + low` (two's complement 128 bit value).
+        struct ExactSum_
+        {
+            /// @brief Low 64 bits.
+            std::uint64_t low = 0;
+
+            /// @brief High 64 bits (signed).
+            std::int64_t high = 0;
+
+            /// @brief Add unsigned value.
+            inline constexpr void add(std::uint64_t value) noexcept
+            {
+                low += value;
+                high += (low < value);
+            }
+
+            /// @brief Add signed value.
+            inline constexpr void add(std::int64_t value) noexcept
+            {
+                add(static_cast<std::uint64_t>(value));
+                high -= (value < 0);
+            }
+
+            /// @brief Add builtin integer.
+            template<CheckableInteger Integer>
+            inline constexpr void addInteger(Integer value) noexcept
+            {
+                if constexpr (std::is_signed_v<Integer>)
+                    add(static_cast<std::int64_t>(value));
+                else
+                    add(static_cast<std::uint64_t>(value));
+            }
+
+            /// @brief Add exact sum.
+            inline constexpr ExactSum_& operator+=(const ExactSum_& rhs) noexcept
+            {
+                add(rhs.low);
+                high += rhs.high;
+                return *this;
+            }
+
+            /// @brief Sum of exact sums.
+            [[nodiscard]] inline friend constexpr ExactSum_ operator+(ExactSum_ lhs, const ExactSum_& rhs) noexcept { return lhs += rhs; }
+
+            /// @brief Numeric ordering.
+            [[nodiscard]] inline friend constexpr std::strong_ordering operator<=>(const ExactSum_& lhs, const ExactSum_& rhs) noexcept
+            {
+                if(lhs.high != rhs.high)
+                    return lhs.high <=> rhs.high;
+                return lhs.low <=> rhs.low;
+            }
+
+            /// @brief Equality.
+            [[nodiscard]] inline friend constexpr bool operator==(const ExactSum_&, const ExactSum_&) noexcept = default;
+        };
+
+        /**
+         * @brief Exact value of builtin integer.
+         *
+         * @tparam Integer builtin integer.
+         * @param[in] value value.
+         * @return ExactSum_ exact value.
+         */
+        template<CheckableInteger Integer>
+        [[nodiscard]] inline constexpr ExactSum_ exactValue_(Integer value) noexcept
+        {
+            ExactSum_ ret{};
+            ret.addInteger(value);
+            return ret;
+        }
+
+        /// @brief Exact sums of one chunk, bounding every partial sum of the chunk to `[negative, positive]`.
+        struct ChunkSummary_
+        {
+            /// @brief Sum of all values.
+            ExactSum_ total;
+
+            /// @brief Sum of positive values.
+            ExactSum_ positive;
+
+            /// @brief Sum of negative values.
+            ExactSum_ negative;
+        };
+
+#if defined(EASY_MATH_DISPATCH_AVX2)
+
+        /**
+         * @brief Sign or zero extend 4 values at `bytes` to 64 bit lanes.
+         *
+         * @tparam Integer builtin integer of at most 32 bits.
+         * @param[in] bytes source, requires `4 * sizeof(Integer)` readable bytes.
+         * @return __m256i extended values.
+         */
+        template<CheckableInteger Integer>
+        [[nodiscard]] EASY_MATH_TARGET_AVX2 inline __m256i extendTo64_(__m128i bytes) noexcept
+        {
+            if constexpr (sizeof(Integer) == 1)
+                return std::is_signed_v<Integer> ? _mm256_cvtepi8_epi64(bytes) : _mm256_cvtepu8_epi64(bytes);
+            else if constexpr (sizeof(Integer) == 2)
+                return std::is_signed_v<Integer> ? _mm256_cvtepi16_epi64(bytes) : _mm256_cvtepu16_epi64(bytes);
+            else
+                return std::is_signed_v<Integer> ? _mm256_cvtepi32_epi64(bytes) : _mm256_cvtepu32_epi64(bytes);
+        }
+
+        /// @brief Horizontal exact sum of 4 lanes given low words and (signed) high words.
+        [[nodiscard]] EASY_MATH_TARGET_AVX2 inline ExactSum_ foldLanes_(__m256i low, __m256i high) noexcept
+        {
+            alignas(32) std::uint64_t lows[4];
+            alignas(32) std::int64_t highs[4];
+            _mm256_store_si256(reinterpret_cast<__m256i*>(lows), low);
+            _mm256_store_si256(reinterpret_cast<__m256i*>(highs), high);
+
+            ExactSum_ ret{};
+            for(std::size_t lane = 0; lane < 4; ++lane)
+                ret += ExactSum_{lows[lane], highs[lane]};
+            return ret;
+        }
+
+        /**
+         * @brief AVX2 chunk summary, 64 bit lane accumulators. Values of up to 32 bits are widened (no carries
+         * within a flush period), 64 bit values count unsigned carries and negative values.
+         *
+         * @tparam Integer builtin integer.
+         * @param[inout] values values, the summarised prefix is removed.
+         * @param[inout] summary summary to add to.
+         */
+        template<CheckableInteger Integer>
+        EASY_MATH_TARGET_AVX2 inline void avx2SummarizeChunk_(std::span<const Integer>& values, ChunkSummary_& summary) noexcept
+        {
+            constexpr bool IS_SIGNED = std::is_signed_v<Integer>;
+
+            // 16 bytes (32 for 64 bit values) per iteration, 4 values per lane group.
+            constexpr std::size_t VALUES_PER_STEP = (sizeof(Integer) == 8) ? 4 : 16 / sizeof(Integer);
+
+            // lane sums of up to 32 bit values stay below 2^56 between flushes.
+            constexpr std::size_t FLUSH_STEPS = std::size_t{1} << 22;
+
+            auto zero = _mm256_setzero_si256();
+            auto signBit = _mm256_set1_epi64x(static_cast<long long>(std::uint64_t{1} << 63));
+
+            std::size_t i = 0;
+            while(i + VALUES_PER_STEP <= values.size())
+            {
+                std::size_t end = std::min(values.size() - values.size() % VALUES_PER_STEP, i + FLUSH_STEPS * VALUES_PER_STEP);
+
+                auto total = zero, positive = zero, negative = zero;
+                auto totalCarry = zero, positiveCarry = zero, negativeCarry = zero, negativeCount = zero;
+
+                for(; i < end; i += VALUES_PER_STEP)
+                {
+                    auto bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values.data() + i));
+
+                    if constexpr (sizeof(Integer) == 8)
+                    {
+                        auto value = _mm256_castsi128_si256(bytes);
+                        value = _mm256_inserti128_si256(value, _mm_loadu_si128(reinterpret_cast<const __m128i*>(values.data() + i + 2)), 1);
+
+                        // unsigned carry out of `sum += addend` is `sum < addend` after the add.
+                        auto accumulate = [&](__m256i& sum, __m256i& carry, __m256i addend) EASY_MATH_TARGET_AVX2
+                        {
+                            sum = _mm256_add_epi64(sum, addend);
+                            carry = _mm256_sub_epi64(carry, _mm256_cmpgt_epi64(_mm256_xor_si256(addend, signBit), _mm256_xor_si256(sum, signBit)));
+                        };
+
+                        accumulate(total, totalCarry, value);
+
+                        if constexpr (IS_SIGNED)
+                        {
+                            auto isNegative = _mm256_cmpgt_epi64(zero, value);
+                            negativeCount = _mm256_sub_epi64(negativeCount, isNegative);
+                            accumulate(positive, positiveCarry, _mm256_andnot_si256(isNegative, value));
+                            accumulate(negative, negativeCarry, _mm256_and_si256(isNegative, value));
+                        }
+                    }
+                    else
+                    {
+                        for(std::size_t group = 0; group < VALUES_PER_STEP / 4; ++group)
+                        {
+                            auto value = extendTo64_<Integer>(bytes);
+                            bytes = _mm_srli_si128(bytes, 4 * sizeof(Integer));
+
+                            total = _mm256_add_epi64(total, value);
+
+                            if constexpr (IS_SIGNED)
+                            {
+                                auto isNegative = _mm256_cmpgt_epi64(zero, value);
+                                positive = _mm256_add_epi64(positive, _mm256_andnot_si256(isNegative, value));
+                                negative = _mm256_add_epi64(negative, _mm256_and_si256(isNegative, value));
+                            }
+                        }
+                    }
+                }
+
+                if constexpr (sizeof(Integer) == 8)
+                {
+                    // high word: carries, less 1 per negative value (its unsigned image is 2^64 too large).
+                    summary.total += foldLanes_(total, _mm256_sub_epi64(totalCarry, negativeCount));
+                    if constexpr (IS_SIGNED)
+                    {
+                        summary.positive += foldLanes_(positive, positiveCarry);
+                        summary.negative += foldLanes_(negative, _mm256_sub_epi64(negativeCarry, negativeCount));
+                    }
+                }
+                else
+                {
+                    // lane sums are small, sign extend into the high word.
+                    summary.total += foldLanes_(total, IS_SIGNED ? _mm256_cmpgt_epi64(zero, total) : zero);
+                    if constexpr (IS_SIGNED)
+                    {
+                        summary.positive += foldLanes_(positive, zero);
+                        summary.negative += foldLanes_(negative, _mm256_cmpgt_epi64(zero, negative));
+                    }
+                }
+            }
+
+            if constexpr (!IS_SIGNED)
+                summary.positive = summary.total;
+
+            values = values.subspan(i);
+        }
+
+#endif
+
+        /**
+         * @brief Exact sum, positive sum and negative sum of `values`.
+         *
+         * @tparam Integer builtin integer.
+         * @param[in] values values.
+         * @return ChunkSummary_ summary.
+         */
+        template<CheckableInteger Integer>
+        [[nodiscard]] inline ChunkSummary_ summarizeChunk_(std::span<const Integer> values) noexcept
+        {
+            ChunkSummary_ summary{};
+
+#if defined(EASY_MATH_DISPATCH_AVX2)
+            if(useAvx2_())
+                avx2SummarizeChunk_<Integer>(values, summary);
+#endif
+
+            for(auto value : values)
+            {
+                summary.total.addInteger(value);
+
+                if constexpr (std::is_signed_v<Integer>)
+                {
+                    if(value < 0)
+                        summary.negative.addInteger(value);
+                    else
+                        summary.positive.addInteger(value);
+                }
+                else
+                    summary.positive.addInteger(value);
+            }
+
+            return summary;
+        }
+
+        /// @brief Output of `checkedPrefixSums_`.
+        enum class PrefixOutput_
+        {
+            /// @brief Only the total.
+            NONE,
+
+            /// @brief Inclusive prefix sums.
+            INCLUSIVE,
+
+            /// @brief Exclusive prefix sums.
+            EXCLUSIVE
+        };
+
+        /**
+         * @brief Sequential running sum from `start` recording overflow of the first `checkedCount` additions.
+         * Exact when `start` is the in range value of the preceding partial sum.
+         *
+         * @tparam Output prefix sums written.
+         * @tparam Integer builtin integer.
+         * @param[in] values values.
+         * @param[out] result prefix sums (unused if `Output == NONE`), may alias `values`.
+         * @param[in] start running sum before `values[0]`.
+         * @param[in] checkedCount number of leading additions checked.
+         * @return Checked<Integer> running sum after the last value, overflowed if a checked addition overflowed.
+         */
+        template<PrefixOutput_ Output, CheckableInteger Integer>
+        [[nodiscard]] inline Checked<Integer> checkedRunningSum_(
+            std::span<const Integer> values, std::span<Integer> result, Integer start, std::size_t checkedCount
+        ) noexcept
+        {
+            bool hasOverflowed = false;
+
+            for(std::size_t i = 0; i < values.size(); ++i)
+            {
+                auto value = values[i];
+
+                if constexpr (Output == PrefixOutput_::EXCLUSIVE)
+                    result[i] = start;
+
+                hasOverflowed |= overflowingOperation_<CheckedOperation_::ADD>(start, value, start) & (i < checkedCount);
+
+                if constexpr (Output == PrefixOutput_::INCLUSIVE)
+                    result[i] = start;
+            }
+
+            return Checked<Integer>(start, hasOverflowed);
+        }
+
+        /**
+         * @brief Parallel running sum reporting whether any partial sum (in sequential order) lies outside
+         * `Integer`, identical to a sequential `addAndCheckOverflow` loop for any thread count.
+         *
+         * Pass 1 summarises each chunk (exact total and sums of positive / negative values) with memory bound
+         * SIMD kernels. The summaries are combined in order into exact chunk starts, a chunk whose start plus
+         * positive or negative sum leaves the range is re-run with per element overflow checks, any other
+         * chunk cannot overflow and is written by the vectorised `prefixSum_`.
+         *
+         * @tparam Output prefix sums written.
+         * @tparam Integer builtin integer.
+         * @param[in] values values.
+         * @param[out] result prefix sums (unused if `Output == NONE`), may alias `values`.
+         * @param[in] options thread count.
+         * @return Checked<Integer> wrapped sum of all values and overflow flag.
+         */
+        template<PrefixOutput_ Output, CheckableInteger Integer>
+        [[nodiscard]] inline Checked<Integer> checkedPrefixSums_(std::span<const Integer> values, std::span<Integer> result, const ReduceOptions& options)
+        {
+            if(values.empty())
+                return {};
+
+            // exclusive scans never output the sum including the last value.
+            std::size_t checkedCount = (Output == PrefixOutput_::EXCLUSIVE) ? values.size() - 1 : values.size();
+
+            std::size_t chunks = options.threadCount;
+            if(chunks == 0)
+                chunks = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+
+            chunks = std::clamp<std::size_t>(values.size() / PARALLEL_CHUNK_MIN_, 1, chunks);
+
+            // one pass suffices without other threads, the summary pass only pays off for the total alone.
+            if((chunks == 1) && (Output != PrefixOutput_::NONE))
+                return checkedRunningSum_<Output, Integer>(values, result, 0, checkedCount);
+
+            auto chunkBegin = [&](std::size_t chunk)
+            {
+                return values.size() / chunks * chunk + std::min(chunk, values.size() % chunks);
+            };
+
+            std::vector<ChunkSummary_> summaries(chunks);
+            parallelFor_(chunks, [&](std::size_t chunk)
+            {
+                auto begin = std::min(chunkBegin(chunk), checkedCount);
+                summaries[chunk] = summarizeChunk_<Integer>(values.subspan(begin, std::min(chunkBegin(chunk + 1), checkedCount) - begin));
+            });
+
+            const auto max = exactValue_(NumericTraits<Integer>::max()), lowest = exactValue_(NumericTraits<Integer>::lowest());
+
+            std::vector<Integer> starts(chunks);
+            std::vector<char> mayOverflow(chunks), hasOverflowed(chunks, 0);
+
+            ExactSum_ start{};
+            for(std::size_t chunk = 0; chunk < chunks; ++chunk)
+            {
+                starts[chunk] = static_cast<Integer>(start.low);
+                mayOverflow[chunk] = (start + summaries[chunk].positive > max) || (start + summaries[chunk].negative < lowest);
+                start += summaries[chunk].total;
+            }
+
+            auto runChunk = [&](std::size_t chunk)
+            {
+                auto begin = chunkBegin(chunk);
+                auto size = chunkBegin(chunk + 1) - begin;
+                auto chunkValues = values.subspan(begin, size);
+                auto chunkResult = (Output == PrefixOutput_::NONE) ? result : result.subspan(begin, size);
+
+                if(mayOverflow[chunk])
+                    hasOverflowed[chunk] = checkedRunningSum_<Output, Integer>(chunkValues, chunkResult, starts[chunk], checkedCount - begin).hasOverflowed();
+                else if constexpr (Output != PrefixOutput_::NONE)
+                    static_cast<void>(prefixSum_<Output == PrefixOutput_::EXCLUSIVE, Integer>(chunkValues, chunkResult, starts[chunk], 0));
+            };
+
+            if constexpr (Output == PrefixOutput_::NONE)
+            {
+                if(std::find(mayOverflow.begin(), mayOverflow.end(), 1) != mayOverflow.end())
+                    parallelFor_(chunks, runChunk);
+            }
+            else
+                parallelFor_(chunks, runChunk);
+
+            // the exclusive total skipped the last value.
+            if constexpr (Output == PrefixOutput_::EXCLUSIVE)
+                start.addInteger(values.back());
+
+            return Checked<Integer>(
+                static_cast<Integer>(start.low), std::find(hasOverflowed.begin(), hasOverflowed.end(), 1) != hasOverflowed.end()
+            );
+        }
+    }
+
+    /**
+     * @brief Sum of `values` (wrapping) split across threads, flags overflow exactly when a sequential
+     * `addAndCheckOverflow` loop would (some partial sum outside `Integer`), independent of the thread count.
+     *
+     * @tparam Integer builtin integer.
+     * @param[in] values values.
+     * @param[in] options thread count.
+     * @return Checked<Integer> sum and overflow flag.
+     */
+    template<CheckableInteger Integer>
+    [[nodiscard]] inline Checked<Integer> reduceChecked(std::type_identity_t<std::span<const Integer>> values, ReduceOptions options = {})
+    {
+        return impl_detail_::checkedPrefixSums_<impl_detail_::PrefixOutput_::NONE, Integer>(values, {}, options);
+    }
+
+    /**
+     * @brief Inclusive prefix sums `result[i] = values[0] + ... + values[i]` (wrapping) split across threads.
+     *
+     * @tparam Integer builtin integer.
+     * @param[in] values values.
+     * @param[out] result prefix sums, requires `result.size() >= values.size()`, may alias `values`.
+     * @param[in] options thread count.
+     * @return true if any prefix sum overflowed, independent of the thread count.
+     */
+    template<CheckableInteger Integer>
+    [[nodiscard]] inline bool inclusiveScanChecked(
+        std::type_identity_t<std::span<const Integer>> values, std::type_identity_t<std::span<Integer>> result, ReduceOptions options = {}
+    )
+    {
+        return impl_detail_::checkedPrefixSums_<impl_detail_::PrefixOutput_::INCLUSIVE, Integer>(values, result, options).hasOverflowed();
+    }
+
+    /**
+     * @brief Exclusive prefix sums `result[i] = values[0] + ... + values[i - 1]` (`result[0] = 0`, wrapping)
+     * split across threads.
+     *
+     * @tparam Integer builtin integer.
+     * @param[in] values values.
+     * @param[out] result prefix sums, requires `result.size() >= values.size()`, may alias `values`.
+     * @param[in] options thread count.
+     * @return true if any written prefix sum overflowed, independent of the thread count.
+     */
+    template<CheckableInteger Integer>
+    [[nodiscard]] inline bool exclusiveScanChecked(
+        std::type_identity_t<std::span<const Integer>> values, std::type_identity_t<std::span<Integer>> result, ReduceOptions options = {}
+    )
+    {
+        return impl_detail_::checkedPrefixSums_<impl_detail_::PrefixOutput_::EXCLUSIVE, Integer>(values, result, options).hasOverflowed();
+    }
+}
+
+#endif // INCLUDE_EASYMATHLIB_PARALLELREDUCE_H_INCLUDED
@@ -0,0 +1,525 @@
+/**
+ * @file radixSort.h
+ * @author Harith Manoj
+ * @brief LSD / MSD radix sort of integral keys and key / value pairs, optionally multi threaded.
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (C) Harith Manoj
+ *
+ *
+ *                      APACHE LICENSE 2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef INCLUDE_EASYMATHLIB_RADIXSORT_H_INCLUDED
+
+/// @brief include\easyMathLib\radixSort.h Header Guard
+#define INCLUDE_EASYMATHLIB_RADIXSORT_H_INCLUDED
+
+#include <span>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <utility>
+#include <concepts>
+#include <cstdint>
+#include <algorithm>
+#include <type_traits>
+
+#include <easyMathLib/easyMath.h>
+#include <easyMathLib/parallelReduce.h>
+
+namespace easyMath
+{
+    /**
+     * @brief Key types sortable by `radixSort`, unsigned integrals (including custom sized types admitted by
+     * `NumericTraits`, eg: `WideUInt`) and builtin signed integers.
+     *
+     * @tparam Key type to check.
+     */
+    template<class Key>
+    concept RadixSortable = (UnsignedIntegral<Key> || std::signed_integral<Key>) && !std::same_as<Key, bool>;
+
+    /// @brief Digit order of radix sort.
+    enum class RadixSortOrder
+    {
+        /// @brief Least significant digit first, one stable scatter per non trivial digit.
+        LSD,
+
+        /// @brief Most significant digit first, recursive buckets finished by insertion sort (suits wide keys).
+        MSD
+    };
+
+    /// @brief Radix sort configuration.
+    struct RadixSortOptions
+    {
+        /// @brief Number of threads used (0: `std::thread::hardware_concurrency()`).
+        std::size_t threadCount = 1;
+
+        /// @brief Digit order.
+        RadixSortOrder order = RadixSortOrder::LSD;
+    };
+
+    namespace impl_detail_
+    {
+        /// @brief Buckets at or below this size are finished by insertion sort (MSD and tiny inputs).
+        constexpr std::size_t RADIX_INSERTION_SORT_SIZE_ = 32;
+
+        /// @brief Minimum number of elements per thread before another thread is used.
+        constexpr std::size_t RADIX_PARALLEL_CHUNK_MIN_ = std::size_t{1} << 16;
+
+        /// @brief Size of each per bucket write combining buffer, one cache line.
+        constexpr std::size_t RADIX_WRITE_COMBINE_BYTES_ = 64;
+
+        /// @brief Placeholder value type for key only sorts.
+        struct RadixNoValue_ {};
+
+        /**
+         * @brief Digit of `key` starting at bit `shift`, signed keys are biased so digits order like unsigned.
+         *
+         * @tparam DigitBits digit width.
+         * @tparam Key key type.
+         * @param[in] key key.
+         * @param[in] shift bit offset of digit.
+         * @return std::size_t digit (bucket index).
+         */
+        template<std::size_t DigitBits, class Key>
+        [[nodiscard]] inline std::size_t radixDigit_(const Key& key, std::size_t shift) noexcept
+        {
+            if constexpr (std::is_integral_v<Key>)
+            {
+                using UInt = std::make_unsigned_t<Key>;
+
+                auto value = static_cast<UInt>(key);
+                if constexpr (std::is_signed_v<Key>)
+                    value = static_cast<UInt>(value ^ static_cast<UInt>(UInt{1} << (bitSize<Key>() - 1)));
+
+                return static_cast<std::size_t>(value >> shift) & nBitMask<std::size_t>(DigitBits);
+            }
+            else
+                return static_cast<std::size_t>(extractBits<Key>(key, shift, DigitBits));
+        }
+
+        /**
+         * @brief Radix sort engine for one key / value combination.
+         *
+         * @tparam DigitBits digit width, histograms hold `2^DigitBits` counters.
+         * @tparam Key key type.
+         * @tparam Value value type (`RadixNoValue_` for key only sorts).
+         */
+        template<std::size_t DigitBits, class Key, class Value>
+        class RadixSorter_
+        {
+            /// @brief True if values are moved along with keys.
+            static constexpr bool HAS_VALUES = !std::is_same_v<Value, RadixNoValue_>;
+
+            /// @brief Number of buckets per digit.
+            static constexpr std::size_t BUCKETS = std::size_t{1} << DigitBits;
+
+            /// @brief Number of digits in key.
+            static constexpr std::size_t PASSES = (bitSize<Key>() + DigitBits - 1) / DigitBits;
+
+            /// @brief Keys per write combining buffer.
+            static constexpr std::size_t LINE = std::max<std::size_t>(1, RADIX_WRITE_COMBINE_BYTES_ / sizeof(Key));
+
+            /// @brief True if scatter can be staged through write combining buffers.
+            static constexpr bool CAN_COMBINE = (LINE > 1) && std::is_trivially_copyable_v<Key>
+                && (!HAS_VALUES || std::is_trivially_copyable_v<Value>);
+
+            /// @brief Keys.
+            Key* keys_;
+
+            /// @brief Values (unused if `!HAS_VALUES`).
+            Value* values_;
+
+            /// @brief Element count.
+            std::size_t size_;
+
+            /// @brief Number of threads.
+            std::size_t threadCount_;
+
+            /// @brief Scratch keys.
+            std::vector<Key> scratchKeys_;
+
+            /// @brief Scratch values.
+            std::vector<Value> scratchValues_;
+
+            /// @brief Value pointer advanced by `offset` (left null for key only sorts).
+            [[nodiscard]] static inline Value* advance_(Value* values, std::size_t offset) noexcept
+            {
+                if constexpr (HAS_VALUES)
+                    return values + offset;
+                else
+                    return values;
+            }
+
+            /// @brief Stable insertion sort of `size` elements.
+            static inline void insertionSort_(Key* keys, Value* values, std::size_t size)
+            {
+                for(std::size_t i = 1; i < size; ++i)
+                {
+                    Key key = std::move(keys[i]);
+                    Value value{};
+                    if constexpr (HAS_VALUES)
+                        value = std::move(values[i]);
+
+                    std::size_t j = i;
+                    for(; (j > 0) && (key < keys[j - 1]); --j)
+                    {
+                        keys[j] = std::move(keys[j - 1]);
+                        if constexpr (HAS_VALUES)
+                            values[j] = std::move(values[j - 1]);
+                    }
+
+                    keys[j] = std::move(key);
+                    if constexpr (HAS_VALUES)
+                        values[j] = std::move(value);
+                }
+            }
+
+            /// @brief Count digits at `shift` of `[begin, end)` into `histogram` (`BUCKETS` counters, accumulated).
+            static inline void count_(const Key* keys, std::size_t begin, std::size_t end, std::size_t shift, std::size_t* histogram) noexcept
+            {
+                for(std::size_t i = begin; i < end; ++i)
+                    ++histogram[radixDigit_<DigitBits>(keys[i], shift)];
+            }
+
+            /**
+             * @brief Stable scatter of `[begin, end)` by digit at `shift`.
+             *
+             * Large ranges are staged through one cache line buffer per bucket so each destination line
+             * is written in full at once (software write combining).
+             *
+             * @param[inout] offsets next destination index of each bucket, advanced.
+             */
+            static inline void scatter_(
+                Key* keys, Value* values, std::size_t begin, std::size_t end, std::size_t shift,
+                std::size_t* offsets, Key* outKeys, Value* outValues
+            )
+            {
+                if constexpr (CAN_COMBINE)
+                {
+                    if(end - begin >= BUCKETS * LINE * 4)
+                    {
+                        std::vector<Key> keyBuffer(BUCKETS * LINE);
+                        std::vector<Value> valueBuffer(HAS_VALUES ? BUCKETS * LINE : 0);
+                        std::vector<std::uint32_t> fill(BUCKETS, 0);
+
+                        for(std::size_t i = begin; i < end; ++i)
+                        {
+                            std::size_t digit = radixDigit_<DigitBits>(keys[i], shift);
+                            std::size_t slot = digit * LINE + fill[digit];
+
+                            keyBuffer[slot] = keys[i];
+                            if constexpr (HAS_VALUES)
+                                valueBuffer[slot] = values[i];
+
+                            if(++fill[digit] == LINE)
+                            {
+                                std::copy_n(keyBuffer.data() + digit * LINE, LINE, outKeys + offsets[digit]);
+                                if constexpr (HAS_VALUES)
+                                    std::copy_n(valueBuffer.data() + digit * LINE, LINE, outValues + offsets[digit]);
+
+                                offsets[digit] += LINE;
+                                fill[digit] = 0;
+                            }
+                        }
+
+                        for(std::size_t digit = 0; digit < BUCKETS; ++digit)
+                        {
+                            std::copy_n(keyBuffer.data() + digit * LINE, fill[digit], outKeys + offsets[digit]);
+                            if constexpr (HAS_VALUES)
+                                std::copy_n(valueBuffer.data() + digit * LINE, fill[digit], outValues + offsets[digit]);
+
+                            offsets[digit] += fill[digit];
+                        }
+
+                        return;
+                    }
+                }
+
+                for(std::size_t i = begin; i < end; ++i)
+                {
+                    std::size_t& offset = offsets[radixDigit_<DigitBits>(keys[i], shift)];
+
+                    outKeys[offset] = std::move(keys[i]);
+                    if constexpr (HAS_VALUES)
+                        outValues[offset] = std::move(values[i]);
+
+                    ++offset;
+                }
+            }
+
+            /// @brief Start of chunk `chunk` of `count` equal chunks.
+            [[nodiscard]] inline std::size_t chunkBegin_(std::size_t chunk, std::size_t count) const noexcept
+            {
+                return size_ / count * chunk + std::min(chunk, size_ % count);
+            }
+
+            /// @brief LSD sort, ping pong between data and scratch skipping digits shared by all keys.
+            inline void lsd_()
+            {
+                std::size_t threads = threadCount_;
+
+                // histograms of every digit in one read pass, used to detect trivial digits.
+                std::vector<std::size_t> histograms(threads * PASSES * BUCKETS, 0);
+                parallelFor_(threads, [&](std::size_t chunk)
+                {
+                    auto* histogram = histograms.data() + chunk * PASSES * BUCKETS;
+                    auto end = chunkBegin_(chunk + 1, threads);
+
+                    for(std::size_t i = chunkBegin_(chunk, threads); i < end; ++i)
+                        for(std::size_t pass = 0; pass < PASSES; ++pass)
+                            ++histogram[pass * BUCKETS + radixDigit_<DigitBits>(keys_[i], pass * DigitBits)];
+                });
+
+                for(std::size_t chunk = 1; chunk < threads; ++chunk)
+                    for(std::size_t i = 0; i < PASSES * BUCKETS; ++i)
+                        histograms[i] += histograms[chunk * PASSES * BUCKETS + i];
+
+                Key* sourceKeys = keys_;
+                Key* destinationKeys = scratchKeys_.data();
+                Value* sourceValues = values_;
+                Value* destinationValues = scratchValues_.data();
+
+                std::vector<std::size_t> offsets(threads * BUCKETS);
+
+                for(std::size_t pass = 0; pass < PASSES; ++pass)
+                {
+                    const auto* histogram = histograms.data() + pass * BUCKETS;
+                    if(std::find(histogram, histogram + BUCKETS, size_) != histogram + BUCKETS)
+                        continue;
+
+                    std::size_t shift = pass * DigitBits;
+
+                    if(threads == 1)
+                    {
+                        for(std::size_t digit = 0, running = 0; digit < BUCKETS; ++digit)
+                        {
+                            offsets[digit] = running;
+                            running += histogram[digit];
+                        }
+                    }
+                    else
+                    {
+                        std::fill(offsets.begin(), offsets.end(), 0);
+                        parallelFor_(threads, [&](std::size_t chunk)
+                        {
+                            count_(sourceKeys, chunkBegin_(chunk, threads), chunkBegin_(chunk + 1, threads), shift, offsets.data() + chunk * BUCKETS);
+                        });
+
+                        // bucket major, chunk minor prefix sum keeps the scatter stable.
+                        std::size_t running = 0;
+                        for(std::size_t digit = 0; digit < BUCKETS; ++digit)
+                            for(std::size_t chunk = 0; chunk < threads; ++chunk)
+                            {
+                                auto count = offsets[chunk * BUCKETS + digit];
+                                offsets[chunk * BUCKETS + digit] = running;
+                                running += count;
+                            }
+                    }
+
+                    parallelFor_(threads, [&](std::size_t chunk)
+                    {
+                        scatter_(
+                            sourceKeys, sourceValues, chunkBegin_(chunk, threads), chunkBegin_(chunk + 1, threads), shift,
+                            offsets.data() + chunk * BUCKETS, destinationKeys, destinationValues
+                        );
+                    });
+
+                    std::swap(sourceKeys, destinationKeys);
+                    std::swap(sourceValues, destinationValues);
+                }
+
+                if(sourceKeys != keys_)
+                {
+                    std::move(sourceKeys, sourceKeys + size_, keys_);
+                    if constexpr (HAS_VALUES)
+                        std::move(sourceValues, sourceValues + size_, values_);
+                }
+            }
+
+            /**
+             * @brief MSD sort of `size` elements at `keys` on digits `pass` and below (pass 0 most significant).
+             *
+             * @param[in] scratchKeys scratch of `size` keys.
+             * @param[in] scratchValues scratch of `size` values.
+             */
+            static inline void msd_(Key* keys, Value* values, Key* scratchKeys, Value* scratchValues, std::size_t size, std::size_t pass)
+            {
+                std::vector<std::size_t> histogram(BUCKETS);
+
+                for(; pass < PASSES; ++pass)
+                {
+                    if(size <= RADIX_INSERTION_SORT_SIZE_)
+                        break;
+
+                    std::size_t shift = (PASSES - 1 - pass) * DigitBits;
+
+                    std::fill(histogram.begin(), histogram.end(), 0);
+                    count_(keys, 0, size, shift, histogram.data());
+
+                    // all keys share this digit, continue with the next one in place.
+                    if(std::find(histogram.begin(), histogram.end(), size) != histogram.end())
+                        continue;
+
+                    std::vector<std::size_t> offsets(BUCKETS);
+                    for(std::size_t digit = 0, running = 0; digit < BUCKETS; ++digit)
+                    {
+                        offsets[digit] = running;
+                        running += histogram[digit];
+                    }
+
+                    scatter_(keys, values, 0, size, shift, offsets.data(), scratchKeys, scratchValues);
+                    std::move(scratchKeys, scratchKeys + size, keys);
+                    if constexpr (HAS_VALUES)
+                        std::move(scratchValues, scratchValues + size, values);
+
+                    for(std::size_t digit = 0, begin = 0; digit < BUCKETS; begin += histogram[digit], ++digit)
+                        if(histogram[digit] > 1)
+                            msd_(
+                                keys + begin, advance_(values, begin), scratchKeys + begin, advance_(scratchValues, begin),
+                                histogram[digit], pass + 1
+                            );
+
+                    return;
+                }
+
+                if(pass < PASSES)
+                    insertionSort_(keys, values, size);
+            }
+
+            /// @brief MSD sort, top level buckets are distributed over threads.
+            inline void msdParallel_()
+            {
+                std::size_t shift = (PASSES - 1) * DigitBits;
+
+                std::vector<std::size_t> histogram(BUCKETS, 0);
+                count_(keys_, 0, size_, shift, histogram.data());
+
+                std::vector<std::size_t> offsets(BUCKETS);
+                for(std::size_t digit = 0, running = 0; digit < BUCKETS; ++digit)
+                {
+                    offsets[digit] = running;
+                    running += histogram[digit];
+                }
+
+                std::vector<std::size_t> begins = offsets;
+
+                scatter_(keys_, values_, 0, size_, shift, offsets.data(), scratchKeys_.data(), scratchValues_.data());
+                std::move(scratchKeys_.begin(), scratchKeys_.end(), keys_);
+                if constexpr (HAS_VALUES)
+                    std::move(scratchValues_.begin(), scratchValues_.end(), values_);
+
+                std::atomic<std::size_t> next = 0;
+                parallelFor_(threadCount_, [&](std::size_t)
+                {
+                    for(std::size_t digit = next++; digit < BUCKETS; digit = next++)
+                    {
+                        auto begin = begins[digit];
+                        if(histogram[digit] > 1)
+                            msd_(
+                                keys_ + begin, advance_(values_, begin), scratchKeys_.data() + begin,
+                                advance_(scratchValues_.data(), begin), histogram[digit], 1
+                            );
+                    }
+                });
+            }
+
+        public:
+
+            /**
+             * @brief Prepare to sort `size` keys (and values).
+             *
+             * @param[inout] keys keys.
+             * @param[inout] values values, may be null if `!HAS_VALUES`.
+             * @param[in] size element count.
+             * @param[in] options sort options.
+             */
+            inline RadixSorter_(Key* keys, Value* values, std::size_t size, const RadixSortOptions& options) :
+                keys_(keys), values_(values), size_(size), threadCount_(options.threadCount)
+            {
+                if(threadCount_ == 0)
+                    threadCount_ = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+
+                threadCount_ = std::clamp<std::size_t>(size_ / RADIX_PARALLEL_CHUNK_MIN_, 1, threadCount_);
+            }
+
+            /// @brief Sort.
+            inline void sort(RadixSortOrder order)
+            {
+                if(size_ <= RADIX_INSERTION_SORT_SIZE_)
+                {
+                    insertionSort_(keys_, values_, size_);
+                    return;
+                }
+
+                scratchKeys_.resize(size_);
+                if constexpr (HAS_VALUES)
+                    scratchValues_.resize(size_);
+
+                if(order == RadixSortOrder::LSD)
+                    lsd_();
+                else if(threadCount_ > 1)
+                    msdParallel_();
+                else
+                    msd_(keys_, values_, scratchKeys_.data(), scratchValues_.data(), size_, 0);
+            }
+        };
+    }
+
+    /**
+     * @brief Sort keys in ascending order by radix sort.
+     *
+     * LSD order performs one stable scatter per digit that is not shared by every key, MSD order recursively
+     * partitions on the most significant digit. Custom sized keys use `extractBits` for digit extraction.
+     *
+     * @tparam Key key type.
+     * @tparam DigitBits digit width in bits (8: 256 counter histograms, fits L1).
+     * @param[inout] keys keys to sort.
+     * @param[in] options thread count and digit order.
+     */
+    template<RadixSortable Key, std::size_t DigitBits = 8>
+        requires ((DigitBits > 0) && (DigitBits <= 16))
+    inline void radixSort(std::type_identity_t<std::span<Key>> keys, RadixSortOptions options = {})
+    {
+        impl_detail_::RadixSorter_<DigitBits, Key, impl_detail_::RadixNoValue_>(keys.data(), nullptr, keys.size(), options)
+            .sort(options.order);
+    }
+
+    /**
+     * @brief Sort key / value pairs by key in ascending order, stable (equal keys keep value order).
+     *
+     * @tparam Key key type.
+     * @tparam Value value type, default constructible and movable.
+     * @tparam DigitBits digit width in bits.
+     * @param[inout] keys keys to sort.
+     * @param[inout] values values moved along with keys, requires `values.size() == keys.size()`.
+     * @param[in] options thread count and digit order.
+     */
+    template<RadixSortable Key, class Value, std::size_t DigitBits = 8>
+        requires ((DigitBits > 0) && (DigitBits <= 16) && std::default_initializable<Value> && std::movable<Value>)
+    inline void radixSort(
+        std::type_identity_t<std::span<Key>> keys,
+        std::type_identity_t<std::span<Value>> values,
+        RadixSortOptions options = {}
+    )
+    {
+        impl_detail_::RadixSorter_<DigitBits, Key, Value>(keys.data(), values.data(), keys.size(), options)
+            .sort(options.order);
+    }
+}
+
+#endif // INCLUDE_EASYMATHLIB_RADIXSORT_H_INCLUDED
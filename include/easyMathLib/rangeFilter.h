@@ -0,0 +1,759 @@
+/**
+ * @file rangeFilter.h
+ * @author Harith Manoj
+ * @brief Vectorised batch range filters built on `valueBetween` and `valueBetweenInclusive`.
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (C) Harith Manoj
+ *
+ *
+ *                      APACHE LICENSE 2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef INCLUDE_EASYMATHLIB_RANGEFILTER_H_INCLUDED
+
+/// @brief include\easyMathLib\rangeFilter.h Header Guard
+#define INCLUDE_EASYMATHLIB_RANGEFILTER_H_INCLUDED
+
+#include <span>
+#include <bit>
+#include <cstdint>
+#include <type_traits>
+
+#include <easyMathLib/easyMath.h>
+#include <easyMathLib/simdSupport.h>
+
+namespace easyMath
+{
+    namespace impl_detail_
+    {
+        /// @brief Number of values evaluated per mask word.
+        constexpr std::size_t FILTER_BLOCK_SIZE_ = 64;
+
+        /**
+         * @brief Check if type maps to a native SIMD lane type (integers other than bool, float, double).
+         *
+         * @tparam T type to check.
+         */
+        template<class T>
+        constexpr bool isSimdLane_ = (std::is_integral_v<T> && !std::is_same_v<T, bool>)
+            || std::is_same_v<T, float>
+            || std::is_same_v<T, double>;
+
+        /**
+         * @brief Scalar reference, evaluate range check for `count` values and pack the results.
+         *
+         * @tparam inclusive use `valueBetweenInclusive` if true, else `valueBetween`.
+         * @tparam T value type.
+         * @param[in] data pointer to first value.
+         * @param[in] count number of values to evaluate, `count <= 64`.
+         * @param[in] begin range begin.
+         * @param[in] end range end.
+         * @return std::uint64_t bit i set if `data[i]` is in range.
+         */
+        template<bool inclusive, class T>
+        [[nodiscard]] inline std::uint64_t scalarBlockMask_(const T* data, std::size_t count, T begin, T end) noexcept
+        {
+            std::uint64_t mask = 0;
+
+            for(std::size_t i = 0; i < count; ++i)
+            {
+                bool isIn;
+
+                if constexpr (inclusive)
+                    isIn = valueBetweenInclusive<T>(data[i], begin, end);
+                else
+                    isIn = valueBetween<T>(data[i], begin, end);
+
+                mask |= static_cast<std::uint64_t>(isIn) << i;
+            }
+
+            return mask;
+        }
+
+#if defined(EASY_MATH_HAS_SSE2)
+
+        /**
+         * @brief Broadcast integer to all lanes of a 128 bit vector.
+         *
+         * @tparam T integer lane type.
+         * @param[in] value value to broadcast.
+         * @return __m128i broadcasted vector.
+         */
+        template<class T>
+        [[nodiscard]] EASY_MATH_TARGET_SSE4_2 inline __m128i sse2Splat_(T value) noexcept
+        {
+            if constexpr (sizeof(T) == 1)
+                return _mm_set1_epi8(static_cast<char>(value));
+            else if constexpr (sizeof(T) == 2)
+                return _mm_set1_epi16(static_cast<short>(value));
+            else if constexpr (sizeof(T) == 4)
+                return _mm_set1_epi32(static_cast<int>(value));
+            else
+                return _mm_set1_epi64x(static_cast<long long>(value));
+        }
+
+        /**
+         * @brief Signed lane wise greater than comparison.
+         *
+         * @tparam width lane size in bytes.
+         */
+        template<std::size_t width>
+        [[nodiscard]] EASY_MATH_TARGET_SSE4_2 inline __m128i sse2CompareGreater_(__m128i lhs, __m128i rhs) noexcept
+        {
+            if constexpr (width == 1)
+                return _mm_cmpgt_epi8(lhs, rhs);
+            else if constexpr (width == 2)
+                return _mm_cmpgt_epi16(lhs, rhs);
+            else if constexpr (width == 4)
+                return _mm_cmpgt_epi32(lhs, rhs);
+            else
+                return _mm_cmpgt_epi64(lhs, rhs);
+        }
+
+        /**
+         * @brief Collect one bit per lane from a comparison result.
+         *
+         * @tparam width lane size in bytes.
+         */
+        template<std::size_t width>
+        [[nodiscard]] EASY_MATH_TARGET_SSE4_2 inline std::uint32_t sse2MoveMask_(__m128i compare) noexcept
+        {
+            if constexpr (width == 1)
+                return static_cast<std::uint32_t>(_mm_movemask_epi8(compare));
+            else if constexpr (width == 2)
+                return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_packs_epi16(compare, compare))) & 0xffu;
+            else if constexpr (width == 4)
+                return static_cast<std::uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(compare)));
+            else
+                return static_cast<std::uint32_t>(_mm_movemask_pd(_mm_castsi128_pd(compare)));
+        }
+
+        /**
+         * @brief SSE2 range check over one block of 64 values.
+         *
+         * Unsigned lanes are biased by the sign bit so that signed compares can be used.
+         * 64 bit integer lanes require SSE4.2.
+         */
+        template<bool inclusive, class T>
+        [[nodiscard]] EASY_MATH_TARGET_SSE4_2 inline std::uint64_t sse2BlockMask_(const T* data, T begin, T end) noexcept
+        {
+            constexpr std::size_t lanes = 16 / sizeof(T);
+            std::uint64_t mask = 0;
+
+            if constexpr (std::is_same_v<T, float>)
+            {
+                auto low = _mm_set1_ps(begin);
+                auto high = _mm_set1_ps(end);
+
+                for(std::size_t i = 0; i < FILTER_BLOCK_SIZE_; i += lanes)
+                {
+                    auto value = _mm_loadu_ps(data + i);
+                    __m128 isIn;
+
+                    if constexpr (inclusive)
+                        isIn = _mm_and_ps(_mm_cmpge_ps(value, low), _mm_cmple_ps(value, high));
+                    else
+                        isIn = _mm_and_ps(_mm_cmpgt_ps(value, low), _mm_cmplt_ps(value, high));
+
+                    mask |= static_cast<std::uint64_t>(_mm_movemask_ps(isIn)) << i;
+                }
+            }
+            else if constexpr (std::is_same_v<T, double>)
+            {
+                auto low = _mm_set1_pd(begin);
+                auto high = _mm_set1_pd(end);
+
+                for(std::size_t i = 0; i < FILTER_BLOCK_SIZE_; i += lanes)
+                {
+                    auto value = _mm_loadu_pd(data + i);
+                    __m128d isIn;
+
+                    if constexpr (inclusive)
+                        isIn = _mm_and_pd(_mm_cmpge_pd(value, low), _mm_cmple_pd(value, high));
+                    else
+                        isIn = _mm_and_pd(_mm_cmpgt_pd(value, low), _mm_cmplt_pd(value, high));
+
+                    mask |= static_cast<std::uint64_t>(_mm_movemask_pd(isIn)) << i;
+                }
+            }
+            else
+            {
+                using Signed = std::make_signed_t<T>;
+                auto bias = std::is_signed_v<T> ? _mm_setzero_si128() : sse2Splat_<Signed>(NumericTraits<Signed>::min());
+                auto low = _mm_xor_si128(sse2Splat_<T>(begin), bias);
+                auto high = _mm_xor_si128(sse2Splat_<T>(end), bias);
+
+                for(std::size_t i = 0; i < FILTER_BLOCK_SIZE_; i += lanes)
+                {
+                    auto value = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)), bias);
+                    std::uint32_t bits;
+
+                    if constexpr (inclusive)
+                    {
+                        auto isOut = _mm_or_si128(
+                            sse2CompareGreater_<sizeof(T)>(low, value),
+                            sse2CompareGreater_<sizeof(T)>(value, high)
+                        );
+                        bits = ~sse2MoveMask_<sizeof(T)>(isOut) & ((1u << lanes) - 1);
+                    }
+                    else
+                    {
+                        auto isIn = _mm_and_si128(
+                            sse2CompareGreater_<sizeof(T)>(value, low),
+                            sse2CompareGreater_<sizeof(T)>(high, value)
+                        );
+                        bits = sse2MoveMask_<sizeof(T)>(isIn);
+                    }
+
+                    mask |= static_cast<std::uint64_t>(bits) << i;
+                }
+            }
+
+            return mask;
+        }
+
+#endif // defined(EASY_MATH_HAS_SSE2)
+
+#if defined(EASY_MATH_DISPATCH_AVX2)
+
+        /**
+         * @brief Broadcast integer to all lanes of a 256 bit vector.
+         *
+         * @tparam T integer lane type.
+         * @param[in] value value to broadcast.
+         * @return __m256i broadcasted vector.
+         */
+        template<class T>
+        [[nodiscard]] EASY_MATH_TARGET_AVX2 inline __m256i avx2Splat_(T value) noexcept
+        {
+            if constexpr (sizeof(T) == 1)
+                return _mm256_set1_epi8(static_cast<char>(value));
+            else if constexpr (sizeof(T) == 2)
+                return _mm256_set1_epi16(static_cast<short>(value));
+            else if constexpr (sizeof(T) == 4)
+                return _mm256_set1_epi32(static_cast<int>(value));
+            else
+                return _mm256_set1_epi64x(static_cast<long long>(value));
+        }
+
+        /**
+         * @brief Signed lane wise greater than comparison.
+         *
+         * @tparam width lane size in bytes.
+         */
+        template<std::size_t width>
+        [[nodiscard]] EASY_MATH_TARGET_AVX2 inline __m256i avx2CompareGreater_(__m256i lhs, __m256i rhs) noexcept
+        {
+            if constexpr (width == 1)
+                return _mm256_cmpgt_epi8(lhs, rhs);
+            else if constexpr (width == 2)
+                return _mm256_cmpgt_epi16(lhs, rhs);
+            else if constexpr (width == 4)
+                return _mm256_cmpgt_epi32(lhs, rhs);
+            else
+                return _mm256_cmpgt_epi64(lhs, rhs);
+        }
+
+        /**
+         * @brief Collect one bit per lane from a comparison result.
+         *
+         * @tparam width lane size in bytes.
+         */
+        template<std::size_t width>
+        [[nodiscard]] EASY_MATH_TARGET_AVX2 inline std::uint32_t avx2MoveMask_(__m256i compare) noexcept
+        {
+            if constexpr (width == 1)
+                return static_cast<std::uint32_t>(_mm256_movemask_epi8(compare));
+            else if constexpr (width == 2)
+                return static_cast<std::uint32_t>(_mm_movemask_epi8(
+                    _mm_packs_epi16(_mm256_castsi256_si128(compare), _mm256_extracti128_si256(compare, 1))
+                ));
+            else if constexpr (width == 4)
+                return static_cast<std::uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(compare)));
+            else
+                return static_cast<std::uint32_t>(_mm256_movemask_pd(_mm256_castsi256_pd(compare)));
+        }
+
+        /**
+         * @brief AVX2 range check over one block of 64 values.
+         *
+         * Unsigned lanes are biased by the sign bit so that signed compares can be used.
+         */
+        template<bool inclusive, class T>
+        [[nodiscard]] EASY_MATH_TARGET_AVX2 inline std::uint64_t avx2BlockMask_(const T* data, T begin, T end) noexcept
+        {
+            constexpr std::size_t lanes = 32 / sizeof(T);
+            std::uint64_t mask = 0;
+
+            if constexpr (std::is_same_v<T, float>)
+            {
+                auto low = _mm256_set1_ps(begin);
+                auto high = _mm256_set1_ps(end);
+
+                for(std::size_t i = 0; i < FILTER_BLOCK_SIZE_; i += lanes)
+                {
+                    auto value = _mm256_loadu_ps(data + i);
+                    __m256 isIn;
+
+                    if constexpr (inclusive)
+                        isIn = _mm256_and_ps(_mm256_cmp_ps(value, low, _CMP_GE_OQ), _mm256_cmp_ps(value, high, _CMP_LE_OQ));
+                    else
+                        isIn = _mm256_and_ps(_mm256_cmp_ps(value, low, _CMP_GT_OQ), _mm256_cmp_ps(value, high, _CMP_LT_OQ));
+
+                    mask |= static_cast<std::uint64_t>(_mm256_movemask_ps(isIn)) << i;
+                }
+            }
+            else if constexpr (std::is_same_v<T, double>)
+            {
+                auto low = _mm256_set1_pd(begin);
+                auto high = _mm256_set1_pd(end);
+
+                for(std::size_t i = 0; i < FILTER_BLOCK_SIZE_; i += lanes)
+                {
+                    auto value = _mm256_loadu_pd(data + i);
+                    __m256d isIn;
+
+                    if constexpr (inclusive)
+                        isIn = _mm256_and_pd(_mm256_cmp_pd(value, low, _CMP_GE_OQ), _mm256_cmp_pd(value, high, _CMP_LE_OQ));
+                    else
+                        isIn = _mm256_and_pd(_mm256_cmp_pd(value, low, _CMP_GT_OQ), _mm256_cmp_pd(value, high, _CMP_LT_OQ));
+
+                    mask |= static_cast<std::uint64_t>(_mm256_movemask_pd(isIn)) << i;
+                }
+            }
+            else
+            {
+                using Signed = std::make_signed_t<T>;
+                auto bias = std::is_signed_v<T> ? _mm256_setzero_si256() : avx2Splat_<Signed>(NumericTraits<Signed>::min());
+                auto low = _mm256_xor_si256(avx2Splat_<T>(begin), bias);
+                auto high = _mm256_xor_si256(avx2Splat_<T>(end), bias);
+
+                for(std::size_t i = 0; i < FILTER_BLOCK_SIZE_; i += lanes)
+                {
+                    auto value = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)), bias);
+                    std::uint64_t bits;
+
+                    if constexpr (inclusive)
+                    {
+                        auto isOut = _mm256_or_si256(
+                            avx2CompareGreater_<sizeof(T)>(low, value),
+                            avx2CompareGreater_<sizeof(T)>(value, high)
+                        );
+                        bits = ~static_cast<std::uint64_t>(avx2MoveMask_<sizeof(T)>(isOut)) & nBitMask<std::uint64_t>(lanes);
+                    }
+                    else
+                    {
+                        auto isIn = _mm256_and_si256(
+                            avx2CompareGreater_<sizeof(T)>(value, low),
+                            avx2CompareGreater_<sizeof(T)>(high, value)
+                        );
+                        bits = avx2MoveMask_<sizeof(T)>(isIn);
+                    }
+
+                    mask |= bits << i;
+                }
+            }
+
+            return mask;
+        }
+
+#endif // defined(EASY_MATH_DISPATCH_AVX2)
+
+#if defined(EASY_MATH_DISPATCH_AVX512BW)
+
+        /**
+         * @brief AVX-512 range check over one block of 64 values, comparisons produce mask registers directly.
+         */
+        template<bool inclusive, class T>
+        [[nodiscard]] EASY_MATH_TARGET_AVX512BW inline std::uint64_t avx512BlockMask_(const T* data, T begin, T end) noexcept
+        {
+            constexpr std::size_t lanes = 64 / sizeof(T);
+            constexpr int lowCompare = inclusive ? _MM_CMPINT_NLT : _MM_CMPINT_NLE;
+            constexpr int highCompare = inclusive ? _MM_CMPINT_LE : _MM_CMPINT_LT;
+
+            std::uint64_t mask = 0;
+
+            for(std::size_t i = 0; i < FILTER_BLOCK_SIZE_; i += lanes)
+            {
+                std::uint64_t bits;
+
+                if constexpr (std::is_same_v<T, float>)
+                {
+                    auto value = _mm512_loadu_ps(data + i);
+                    auto isAbove = _mm512_cmp_ps_mask(value, _mm512_set1_ps(begin), inclusive ? _CMP_GE_OQ : _CMP_GT_OQ);
+                    bits = _mm512_mask_cmp_ps_mask(isAbove, value, _mm512_set1_ps(end), inclusive ? _CMP_LE_OQ : _CMP_LT_OQ);
+                }
+                else if constexpr (std::is_same_v<T, double>)
+                {
+                    auto value = _mm512_loadu_pd(data + i);
+                    auto isAbove = _mm512_cmp_pd_mask(value, _mm512_set1_pd(begin), inclusive ? _CMP_GE_OQ : _CMP_GT_OQ);
+                    bits = _mm512_mask_cmp_pd_mask(isAbove, value, _mm512_set1_pd(end), inclusive ? _CMP_LE_OQ : _CMP_LT_OQ);
+                }
+                else
+                {
+                    auto value = _mm512_loadu_si512(data + i);
+
+                    if constexpr (sizeof(T) == 1)
+                    {
+                        auto low = _mm512_set1_epi8(static_cast<char>(begin));
+                        auto high = _mm512_set1_epi8(static_cast<char>(end));
+                        if constexpr (std::is_signed_v<T>)
+                            bits = _mm512_mask_cmp_epi8_mask(_mm512_cmp_epi8_mask(value, low, lowCompare), value, high, highCompare);
+                        else
+                            bits = _mm512_mask_cmp_epu8_mask(_mm512_cmp_epu8_mask(value, low, lowCompare), value, high, highCompare);
+                    }
+                    else if constexpr (sizeof(T) == 2)
+                    {
+                        auto low = _mm512_set1_epi16(static_cast<short>(begin));
+                        auto high = _mm512_set1_epi16(static_cast<short>(end));
+                        if constexpr (std::is_signed_v<T>)
+                            bits = _mm512_mask_cmp_epi16_mask(_mm512_cmp_epi16_mask(value, low, lowCompare), value, high, highCompare);
+                        else
+                            bits = _mm512_mask_cmp_epu16_mask(_mm512_cmp_epu16_mask(value, low, lowCompare), value, high, highCompare);
+                    }
+                    else if constexpr (sizeof(T) == 4)
+                    {
+                        auto low = _mm512_set1_epi32(static_cast<int>(begin));
+                        auto high = _mm512_set1_epi32(static_cast<int>(end));
+                        if constexpr (std::is_signed_v<T>)
+                            bits = _mm512_mask_cmp_epi32_mask(_mm512_cmp_epi32_mask(value, low, lowCompare), value, high, highCompare);
+                        else
+                            bits = _mm512_mask_cmp_epu32_mask(_mm512_cmp_epu32_mask(value, low, lowCompare), value, high, highCompare);
+                    }
+                    else
+                    {
+                        auto low = _mm512_set1_epi64(static_cast<long long>(begin));
+                        auto high = _mm512_set1_epi64(static_cast<long long>(end));
+                        if constexpr (std::is_signed_v<T>)
+                            bits = _mm512_mask_cmp_epi64_mask(_mm512_cmp_epi64_mask(value, low, lowCompare), value, high, highCompare);
+                        else
+                            bits = _mm512_mask_cmp_epu64_mask(_mm512_cmp_epu64_mask(value, low, lowCompare), value, high, highCompare);
+                    }
+                }
+
+                if constexpr (lanes == FILTER_BLOCK_SIZE_)
+                    mask = bits;
+                else
+                    mask |= bits << i;
+            }
+
+            return mask;
+        }
+
+#endif // defined(EASY_MATH_DISPATCH_AVX512BW)
+
+#if defined(EASY_MATH_HAS_SSE2)
+
+        /// @brief `consumer` with SSE masks of every full block, updates `count`, returns values consumed.
+        template<bool inclusive, class T, class Consumer>
+        EASY_MATH_TARGET_SSE4_2 inline std::size_t sse2FullBlocks_(std::span<const T> values, T begin, T end, Consumer& consumer, std::size_t& count) noexcept
+        {
+            std::size_t i = 0, total = count;
+            for(; i + FILTER_BLOCK_SIZE_ <= values.size(); i += FILTER_BLOCK_SIZE_)
+                total = consumer(i, sse2BlockMask_<inclusive, T>(values.data() + i, begin, end), total);
+
+            count = total;
+            return i;
+        }
+
+#endif
+
+#if defined(EASY_MATH_DISPATCH_AVX2)
+
+        /// @brief `consumer` with AVX2 masks of every full block, updates `count`, returns values consumed.
+        template<bool inclusive, class T, class Consumer>
+        EASY_MATH_TARGET_AVX2 inline std::size_t avx2FullBlocks_(std::span<const T> values, T begin, T end, Consumer& consumer, std::size_t& count) noexcept
+        {
+            std::size_t i = 0, total = count;
+            for(; i + FILTER_BLOCK_SIZE_ <= values.size(); i += FILTER_BLOCK_SIZE_)
+                total = consumer(i, avx2BlockMask_<inclusive, T>(values.data() + i, begin, end), total);
+
+            count = total;
+            return i;
+        }
+
+#endif
+
+#if defined(EASY_MATH_DISPATCH_AVX512BW)
+
+        /// @brief `consumer` with AVX-512 masks of every full block, updates `count`, returns values consumed.
+        template<bool inclusive, class T, class Consumer>
+        EASY_MATH_TARGET_AVX512BW inline std::size_t avx512FullBlocks_(std::span<const T> values, T begin, T end, Consumer& consumer, std::size_t& count) noexcept
+        {
+            std::size_t i = 0, total = count;
+            for(; i + FILTER_BLOCK_SIZE_ <= values.size(); i += FILTER_BLOCK_SIZE_)
+                total = consumer(i, avx512BlockMask_<inclusive, T>(values.data() + i, begin, end), total);
+
+            count = total;
+            return i;
+        }
+
+#endif
+
+        /**
+         * @brief Range check of the full blocks with the widest instruction set allowed by `easyLib::cpuTier()`.
+         *
+         * Selects the kernel once per call, SSE kernels run at the SSE4.2 tier (or SSE2 if not dispatching).
+         *
+         * @return std::size_t number of values consumed, 0 if no SIMD kernel applies.
+         */
+        template<bool inclusive, class T, class Consumer>
+        inline std::size_t simdFullBlocks_(
+            [[maybe_unused]] std::span<const T> values,
+            [[maybe_unused]] T begin,
+            [[maybe_unused]] T end,
+            [[maybe_unused]] Consumer& consumer,
+            [[maybe_unused]] std::size_t& count
+        ) noexcept
+        {
+#if defined(EASY_MATH_DISPATCH_AVX512BW)
+            if(useAvx512_())
+                return avx512FullBlocks_<inclusive, T>(values, begin, end, consumer, count);
+#endif
+#if defined(EASY_MATH_DISPATCH_AVX2)
+            if(useAvx2_())
+                return avx2FullBlocks_<inclusive, T>(values, begin, end, consumer, count);
+#endif
+#if defined(EASY_MATH_DISPATCH_SSE4_2)
+            if(useSse42_())
+                return sse2FullBlocks_<inclusive, T>(values, begin, end, consumer, count);
+#elif defined(EASY_MATH_HAS_SSE2)
+            if constexpr ((sizeof(T) < 8) || std::is_floating_point_v<T>)
+                if(useSse2_())
+                    return sse2FullBlocks_<inclusive, T>(values, begin, end, consumer, count);
+#endif
+            return 0;
+        }
+
+        /**
+         * @brief Evaluate range check over all values, one 64 value block at a time.
+         *
+         * @tparam inclusive use `valueBetweenInclusive` semantics if true, else `valueBetween`.
+         * @tparam T value type.
+         * @tparam Consumer callable of signature `std::size_t(std::size_t blockOffset, std::uint64_t mask, std::size_t count)`,
+         * returns the updated count (kept in a register rather than through a captured reference).
+         * @param[in] values values to evaluate.
+         * @param[in] begin range begin.
+         * @param[in] end range end.
+         * @param[in] consumer called once for each block in order.
+         * @return std::size_t final count, starting from 0.
+         */
+        template<bool inclusive, class T, class Consumer>
+        [[nodiscard]] inline std::size_t forEachBlockMask_(std::span<const T> values, T begin, T end, Consumer&& consumer) noexcept
+        {
+            std::size_t i = 0, count = 0;
+
+            if constexpr (isSimdLane_<T>)
+                i = simdFullBlocks_<inclusive, T>(values, begin, end, consumer, count);
+
+            for(; i + FILTER_BLOCK_SIZE_ <= values.size(); i += FILTER_BLOCK_SIZE_)
+                count = consumer(i, scalarBlockMask_<inclusive, T>(values.data() + i, FILTER_BLOCK_SIZE_, begin, end), count);
+
+            if(i < values.size())
+                count = consumer(i, scalarBlockMask_<inclusive, T>(values.data() + i, values.size() - i, begin, end), count);
+
+            return count;
+        }
+
+        /// @brief Implementation of `valueBetweenMask` and `valueBetweenInclusiveMask`.
+        template<bool inclusive, class T>
+        [[nodiscard]] inline std::size_t rangeMask_(std::span<const T> values, T begin, T end, std::span<std::uint64_t> mask) noexcept
+        {
+            return forEachBlockMask_<inclusive, T>(values, begin, end, [&](std::size_t offset, std::uint64_t bits, std::size_t count)
+            {
+                mask[offset / FILTER_BLOCK_SIZE_] = bits;
+                return count + static_cast<std::size_t>(std::popcount(bits));
+            });
+        }
+
+        /// @brief Implementation of `valueBetweenSelect` and `valueBetweenInclusiveSelect`.
+        template<bool inclusive, class T>
+        [[nodiscard]] inline std::size_t rangeSelect_(std::span<const T> values, T begin, T end, std::span<std::size_t> indices) noexcept
+        {
+            return forEachBlockMask_<inclusive, T>(values, begin, end, [&](std::size_t offset, std::uint64_t bits, std::size_t count)
+            {
+                while(bits != 0)
+                {
+                    indices[count++] = offset + static_cast<std::size_t>(std::countr_zero(bits));
+                    bits &= bits - 1;
+                }
+
+                return count;
+            });
+        }
+
+        /// @brief Implementation of `valueBetweenCompact` and `valueBetweenInclusiveCompact`.
+        template<bool inclusive, class T>
+        [[nodiscard]] inline std::size_t rangeCompact_(std::span<const T> values, T begin, T end, std::span<T> output) noexcept
+        {
+            return forEachBlockMask_<inclusive, T>(values, begin, end, [&](std::size_t offset, std::uint64_t bits, std::size_t count)
+            {
+                while(bits != 0)
+                {
+                    output[count++] = values[offset + static_cast<std::size_t>(std::countr_zero(bits))];
+                    bits &= bits - 1;
+                }
+
+                return count;
+            });
+        }
+    }
+
+    /**
+     * @brief Evaluate `valueBetween` for each value, store results as a bitmask.
+     *
+     * Bit `i % 64` of `mask[i / 64]` is set if `begin < values[i] < end`, unused bits of last word are cleared.
+     *
+     * Requires `mask.size() >= divideRoundUp(values.size(), 64)`.
+     *
+     * @tparam T Type of value to check.
+     * @param[in] values values to evaluate.
+     * @param[in] begin range begin.
+     * @param[in] end range end.
+     * @param[out] mask destination of bitmask.
+     * @return std::size_t number of values in range.
+     */
+    template<class T>
+    inline std::size_t valueBetweenMask(
+        std::type_identity_t<std::span<const T>> values,
+        T begin,
+        T end,
+        std::span<std::uint64_t> mask
+    ) noexcept
+    {
+        return impl_detail_::rangeMask_<false, T>(values, begin, end, mask);
+    }
+
+    /**
+     * @brief Evaluate `valueBetweenInclusive` for each value, store results as a bitmask.
+     *
+     * Bit `i % 64` of `mask[i / 64]` is set if `begin <= values[i] <= end`, unused bits of last word are cleared.
+     *
+     * Requires `mask.size() >= divideRoundUp(values.size(), 64)`.
+     *
+     * @tparam T Type of value to check.
+     * @param[in] values values to evaluate.
+     * @param[in] begin range begin.
+     * @param[in] end range end.
+     * @param[out] mask destination of bitmask.
+     * @return std::size_t number of values in range.
+     */
+    template<class T>
+    inline std::size_t valueBetweenInclusiveMask(
+        std::type_identity_t<std::span<const T>> values,
+        T begin,
+        T end,
+        std::span<std::uint64_t> mask
+    ) noexcept
+    {
+        return impl_detail_::rangeMask_<true, T>(values, begin, end, mask);
+    }
+
+    /**
+     * @brief Store indices of values for which `valueBetween` holds, in ascending order.
+     *
+     * Requires `indices.size()` to be at least the number of values in range (`values.size()` is always enough).
+     *
+     * @tparam T Type of value to check.
+     * @param[in] values values to evaluate.
+     * @param[in] begin range begin.
+     * @param[in] end range end.
+     * @param[out] indices destination of selected indices.
+     * @return std::size_t number of indices written.
+     */
+    template<class T>
+    inline std::size_t valueBetweenSelect(
+        std::type_identity_t<std::span<const T>> values,
+        T begin,
+        T end,
+        std::span<std::size_t> indices
+    ) noexcept
+    {
+        return impl_detail_::rangeSelect_<false, T>(values, begin, end, indices);
+    }
+
+    /**
+     * @brief Store indices of values for which `valueBetweenInclusive` holds, in ascending order.
+     *
+     * Requires `indices.size()` to be at least the number of values in range (`values.size()` is always enough).
+     *
+     * @tparam T Type of value to check.
+     * @param[in] values values to evaluate.
+     * @param[in] begin range begin.
+     * @param[in] end range end.
+     * @param[out] indices destination of selected indices.
+     * @return std::size_t number of indices written.
+     */
+    template<class T>
+    inline std::size_t valueBetweenInclusiveSelect(
+        std::type_identity_t<std::span<const T>> values,
+        T begin,
+        T end,
+        std::span<std::size_t> indices
+    ) noexcept
+    {
+        return impl_detail_::rangeSelect_<true, T>(values, begin, end, indices);
+    }
+
+    /**
+     * @brief Copy values for which `valueBetween` holds, preserving order.
+     *
+     * Requires `output.size()` to be at least the number of values in range (`values.size()` is always enough).
+     *
+     * @tparam T Type of value to check.
+     * @param[in] values values to evaluate.
+     * @param[in] begin range begin.
+     * @param[in] end range end.
+     * @param[out] output destination of values in range.
+     * @return std::size_t number of values written.
+     */
+    template<class T>
+    inline std::size_t valueBetweenCompact(
+        std::type_identity_t<std::span<const T>> values,
+        T begin,
+        T end,
+        std::span<T> output
+    ) noexcept
+    {
+        return impl_detail_::rangeCompact_<false, T>(values, begin, end, output);
+    }
+
+    /**
+     * @brief Copy values for which `valueBetweenInclusive` holds, preserving order.
+     *
+     * Requires `output.size()` to be at least the number of values in range (`values.size()` is always enough).
+     *
+     * @tparam T Type of value to check.
+     * @param[in] values values to evaluate.
+     * @param[in] begin range begin.
+     * @param[in] end range end.
+     * @param[out] output destination of values in range.
+     * @return std::size_t number of values written.
+     */
+    template<class T>
+    inline std::size_t valueBetweenInclusiveCompact(
+        std::type_identity_t<std::span<const T>> values,
+        T begin,
+        T end,
+        std::span<T> output
+    ) noexcept
+    {
+        return impl_detail_::rangeCompact_<true, T>(values, begin, end, output);
+    }
+}
+
+#endif // INCLUDE_EASYMATHLIB_RANGEFILTER_H_INCLUDED
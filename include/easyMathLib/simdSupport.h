@@ -0,0 +1,202 @@
+/**
+ * @file simdSupport.h
+ * @author Harith Manoj
+ * @brief Compile time instruction set detection for vectorised easyMath kernels.
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (C) Harith Manoj
+ *
+ *
+ *                      APACHE LICENSE 2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef INCLUDE_EASYMATHLIB_SIMDSUPPORT_H_INCLUDED
+
+/// @brief include\easyMathLib\simdSupport.h Header Guard
+#define INCLUDE_EASYMATHLIB_SIMDSUPPORT_H_INCLUDED
+
+/*
+ * Instruction set macros, defined to 1 when the compiler is targeting the
+ * instruction set (eg: `-mavx2`, `-march=native`, `/arch:AVX2`).
+ *
+ * Define `EASY_MATH_NO_SIMD` before including any easyMath header to force
+ * every kernel to its scalar reference implementation.
+ */
+
+#if !defined(EASY_MATH_NO_SIMD)
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+/// @brief SSE2 instructions available.
+#define EASY_MATH_HAS_SSE2 1
+#endif
+
+#if defined(__SSE4_2__) || (defined(_MSC_VER) && defined(__AVX__))
+/// @brief SSE4.2 instructions available.
+#define EASY_MATH_HAS_SSE4_2 1
+#endif
+
+#if defined(__AVX2__)
+/// @brief AVX2 instructions available.
+#define EASY_MATH_HAS_AVX2 1
+#endif
+
+#if defined(__AVX512F__) && defined(__AVX512BW__)
+/// @brief AVX-512 Foundation and Byte-Word instructions available.
+#define EASY_MATH_HAS_AVX512BW 1
+#endif
+
+#if defined(__POPCNT__) || (defined(_MSC_VER) && defined(__AVX__))
+/// @brief Hardware population count (`popcnt`) available.
+#define EASY_MATH_HAS_POPCNT 1
+#endif
+
+#if defined(__BMI2__)
+/// @brief BMI2 (`pdep`, `pext`, `bzhi`) instructions available.
+#define EASY_MATH_HAS_BMI2 1
+#endif
+
+#if defined(__GFNI__)
+/// @brief Galois field affine byte transforms (`gf2p8affineqb`) available.
+#define EASY_MATH_HAS_GFNI 1
+#endif
+
+/*
+ * Runtime dispatched kernels, `EASY_MATH_DISPATCH_X` is defined to 1 when kernels of
+ * instruction set X are compiled in, either because the compiler targets it or through
+ * `EASY_MATH_TARGET_X` function attributes. Such kernels are selected at runtime by
+ * `easyLib::cpuTier()` (see easyLib/cpuDispatch.h) so a generic build still runs the
+ * fastest path of each host.
+ *
+ * Define `EASY_MATH_NO_DISPATCH` to compile only the targeted instruction sets.
+ */
+
+#if (defined(__x86_64__) || defined(_M_X64)) && !defined(EASY_MATH_NO_DISPATCH)
+
+#if defined(__GNUC__) || defined(__clang__)
+/// @brief Attribute compiling a function for the SSE4.2 tier.
+#define EASY_MATH_TARGET_SSE4_2 __attribute__((target("sse4.2,popcnt")))
+
+/// @brief Attribute compiling a function for the AVX2 tier.
+#define EASY_MATH_TARGET_AVX2 __attribute__((target("avx2,bmi,bmi2,popcnt,sse4.2")))
+
+/// @brief Attribute compiling a function for the AVX-512 tier.
+#define EASY_MATH_TARGET_AVX512BW __attribute__((target("avx512f,avx512bw,avx2,bmi,bmi2,popcnt,sse4.2")))
+#elif defined(_MSC_VER)
+#define EASY_MATH_TARGET_SSE4_2
+#define EASY_MATH_TARGET_AVX2
+#define EASY_MATH_TARGET_AVX512BW
+#endif
+
+#if defined(EASY_MATH_TARGET_AVX2)
+/// @brief SSE4.2 kernels compiled, run if `easyLib::cpuTier()` allows.
+#define EASY_MATH_DISPATCH_SSE4_2 1
+
+/// @brief AVX2 kernels compiled, run if `easyLib::cpuTier()` allows.
+#define EASY_MATH_DISPATCH_AVX2 1
+
+/// @brief AVX-512 BW kernels compiled, run if `easyLib::cpuTier()` allows.
+#define EASY_MATH_DISPATCH_AVX512BW 1
+#endif
+
+#else
+
+#if defined(EASY_MATH_HAS_SSE4_2)
+#define EASY_MATH_DISPATCH_SSE4_2 1
+#endif
+
+#if defined(EASY_MATH_HAS_AVX2)
+#define EASY_MATH_DISPATCH_AVX2 1
+#endif
+
+#if defined(EASY_MATH_HAS_AVX512BW)
+#define EASY_MATH_DISPATCH_AVX512BW 1
+#endif
+
+#endif
+
+#endif // !defined(EASY_MATH_NO_SIMD)
+
+#if !defined(EASY_MATH_TARGET_AVX2)
+#define EASY_MATH_TARGET_SSE4_2
+#define EASY_MATH_TARGET_AVX2
+#define EASY_MATH_TARGET_AVX512BW
+#endif
+
+#if defined(EASY_MATH_HAS_SSE2)
+#include <immintrin.h>
+#endif
+
+#include <easyLib/cpuDispatch.h>
+
+namespace easyMath
+{
+    namespace impl_detail_
+    {
+        /// @brief Whether SSE2 kernels may run (baseline of the build and allowed by `easyLib::cpuTier()`).
+        [[nodiscard]] inline bool useSse2_() noexcept
+        {
+#if defined(EASY_MATH_HAS_SSE2)
+            return easyLib::isCpuTierActive(easyLib::CpuTier::SSE2);
+#else
+            return false;
+#endif
+        }
+
+        /// @brief Whether SSE4.2 kernels may run (compiled in and allowed by `easyLib::cpuTier()`).
+        [[nodiscard]] inline bool useSse42_() noexcept
+        {
+#if defined(EASY_MATH_DISPATCH_SSE4_2)
+            return easyLib::isCpuTierActive(easyLib::CpuTier::SSE4_2);
+#else
+            return false;
+#endif
+        }
+
+        /// @brief Whether AVX2 kernels may run (compiled in and allowed by `easyLib::cpuTier()`).
+        [[nodiscard]] inline bool useAvx2_() noexcept
+        {
+#if defined(EASY_MATH_DISPATCH_AVX2)
+            return easyLib::isCpuTierActive(easyLib::CpuTier::AVX2);
+#else
+            return false;
+#endif
+        }
+
+        /// @brief Whether AVX-512 BW kernels may run (compiled in and allowed by `easyLib::cpuTier()`).
+        [[nodiscard]] inline bool useAvx512_() noexcept
+        {
+#if defined(EASY_MATH_DISPATCH_AVX512BW)
+            return easyLib::isCpuTierActive(easyLib::CpuTier::AVX512);
+#else
+            return false;
+#endif
+        }
+
+        /// @brief Hint a read of the cache line holding `address` into all cache levels, no effect if unsupported.
+        inline void prefetch_(const void* address) noexcept
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            __builtin_prefetch(address, 0, 3);
+#elif defined(_MSC_VER) && defined(EASY_MATH_HAS_SSE2)
+            _mm_prefetch(static_cast<const char*>(address), _MM_HINT_T0);
+#else
+            static_cast<void>(address);
+#endif
+        }
+    }
+}
+
+#endif // INCLUDE_EASYMATHLIB_SIMDSUPPORT_H_INCLUDED
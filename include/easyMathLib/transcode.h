@@ -0,0 +1,502 @@
+/**
+ * @file transcode.h
+ * @author Harith Manoj
+ * @brief Range checked narrowing and widening of integer spans, required width scan.
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (C) Harith Manoj
+ *
+ *
+ *                      APACHE LICENSE 2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef INCLUDE_EASYMATHLIB_TRANSCODE_H_INCLUDED
+
+/// @brief include\easyMathLib\transcode.h Header Guard
+#define INCLUDE_EASYMATHLIB_TRANSCODE_H_INCLUDED
+
+#include <span>
+#include <bit>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <concepts>
+#include <type_traits>
+
+#include <easyMathLib/easyMath.h>
+#include <easyMathLib/simdSupport.h>
+
+namespace easyMath
+{
+    /**
+     * @brief Builtin integer (8 to 64 bits, not `bool`) accepted by transcoding kernels.
+     *
+     * @tparam Integer type to check.
+     */
+    template<class Integer>
+    concept TranscodeInteger = std::integral<Integer> && !std::same_as<Integer, bool>;
+
+    namespace impl_detail_
+    {
+        /**
+         * @brief Repeat the low `size` bytes of `value` over 64 bits.
+         *
+         * @tparam size lane size in bytes.
+         * @param[in] value lane value.
+         * @return std::uint64_t replicated lanes.
+         */
+        template<std::size_t size>
+        [[nodiscard]] inline constexpr std::uint64_t replicateLane_(std::uint64_t value) noexcept
+        {
+            if constexpr (size == 8)
+                return value;
+            else
+                return (value & nBitMask<std::uint64_t>(size * 8)) * (~std::uint64_t{0} / nBitMask<std::uint64_t>(size * 8));
+        }
+
+        /**
+         * @brief Range check constants of `Source` to `Destination` narrowing: a value fits iff
+         * `(value + bias) & highMask == 0` (lane wise, unsigned wrap around).
+         *
+         * @tparam Destination narrow type.
+         * @tparam Source wide type.
+         */
+        template<class Destination, class Source>
+        struct NarrowRange_
+        {
+            /// @brief Bits that may be set after biasing.
+            static constexpr std::size_t LIMIT_BITS = bitSize<Destination>() - ((std::is_signed_v<Destination> && !std::is_signed_v<Source>) ? 1 : 0);
+
+            /// @brief Bias moving signed ranges to start at 0, replicated to 64 bits.
+            static constexpr std::uint64_t BIAS = replicateLane_<sizeof(Source)>(
+                (std::is_signed_v<Destination> && std::is_signed_v<Source>) ? (std::uint64_t{1} << (bitSize<Destination>() - 1)) : 0
+            );
+
+            /// @brief Bits that must be clear after biasing, replicated to 64 bits.
+            static constexpr std::uint64_t HIGH_MASK = replicateLane_<sizeof(Source)>(~nBitMask<std::uint64_t>(LIMIT_BITS));
+        };
+
+#if defined(EASY_MATH_DISPATCH_AVX2)
+
+        /// @brief Lane wise add of `size` byte lanes.
+        template<std::size_t size>
+        [[nodiscard]] EASY_MATH_TARGET_AVX2 inline __m256i avx2AddLanes_(__m256i lhs, __m256i rhs) noexcept
+        {
+            if constexpr (size == 2)
+                return _mm256_add_epi16(lhs, rhs);
+            else if constexpr (size == 4)
+                return _mm256_add_epi32(lhs, rhs);
+            else
+                return _mm256_add_epi64(lhs, rhs);
+        }
+
+        /**
+         * @brief `pshufb` control gathering the low `destination` bytes of each `source` byte lane to the start of
+         * each 16 byte half.
+         *
+         * @tparam source wide lane size.
+         * @tparam destination narrow lane size.
+         */
+        template<std::size_t source, std::size_t destination>
+        alignas(32) inline constexpr std::array<std::uint8_t, 32> NARROW_SHUFFLE_ = []()
+        {
+            std::array<std::uint8_t, 32> shuffle{};
+            for(std::size_t i = 0; i < 32; ++i)
+            {
+                std::size_t lane = i % 16 / destination, byte = i % 16 % destination;
+                shuffle[i] = (lane < 16 / source) ? static_cast<std::uint8_t>(lane * source + byte) : 0x80;
+            }
+            return shuffle;
+        }();
+
+        /**
+         * @brief AVX2 range checked narrowing, stops before the first block holding an out of range value.
+         *
+         * @tparam Destination narrow type.
+         * @tparam Source wide type.
+         * @param[in] values source values.
+         * @param[out] result narrowed values.
+         * @return std::size_t number of values narrowed (whole blocks in range).
+         */
+        template<class Destination, class Source>
+        EASY_MATH_TARGET_AVX2 inline std::size_t avx2Narrow_(std::span<const Source> values, std::span<Destination> result) noexcept
+        {
+            using Range = NarrowRange_<Destination, Source>;
+            constexpr std::size_t RATIO = sizeof(Source) / sizeof(Destination);
+            constexpr std::size_t LANES = 32 / sizeof(Source);
+
+            const __m256i bias = _mm256_set1_epi64x(static_cast<std::int64_t>(Range::BIAS));
+            const __m256i highMask = _mm256_set1_epi64x(static_cast<std::int64_t>(Range::HIGH_MASK));
+            const __m256i shuffle = _mm256_load_si256(reinterpret_cast<const __m256i*>(NARROW_SHUFFLE_<sizeof(Source), sizeof(Destination)>.data()));
+
+            std::size_t i = 0;
+            for(; i + LANES <= values.size(); i += LANES)
+            {
+                __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values.data() + i));
+
+                __m256i biased = (Range::BIAS != 0) ? avx2AddLanes_<sizeof(Source)>(block, bias) : block;
+                if(!_mm256_testz_si256(biased, highMask))
+                    break;
+
+                // low bytes of each lane to the start of each half, then join the halves.
+                block = _mm256_shuffle_epi8(block, shuffle);
+                __m128i low = _mm256_castsi256_si128(block), high = _mm256_extracti128_si256(block, 1);
+
+                if constexpr (RATIO == 2)
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(result.data() + i), _mm_unpacklo_epi64(low, high));
+                else if constexpr (RATIO == 4)
+                    _mm_storel_epi64(reinterpret_cast<__m128i*>(result.data() + i), _mm_unpacklo_epi32(low, high));
+                else
+                {
+                    auto packed = static_cast<std::uint32_t>(_mm_cvtsi128_si32(_mm_unpacklo_epi16(low, high)));
+                    std::memcpy(result.data() + i, &packed, sizeof(packed));
+                }
+            }
+
+            return i;
+        }
+
+        /// @brief Sign or zero extend the low lanes of `block` from `source` to `destination` byte lanes.
+        template<std::size_t source, std::size_t destination, bool isSigned>
+        [[nodiscard]] EASY_MATH_TARGET_AVX2 inline __m256i avx2Extend_(__m128i block) noexcept
+        {
+            if constexpr ((source == 1) && (destination == 2))
+                return isSigned ? _mm256_cvtepi8_epi16(block) : _mm256_cvtepu8_epi16(block);
+            else if constexpr ((source == 1) && (destination == 4))
+                return isSigned ? _mm256_cvtepi8_epi32(block) : _mm256_cvtepu8_epi32(block);
+            else if constexpr (source == 1)
+                return isSigned ? _mm256_cvtepi8_epi64(block) : _mm256_cvtepu8_epi64(block);
+            else if constexpr ((source == 2) && (destination == 4))
+                return isSigned ? _mm256_cvtepi16_epi32(block) : _mm256_cvtepu16_epi32(block);
+            else if constexpr (source == 2)
+                return isSigned ? _mm256_cvtepi16_epi64(block) : _mm256_cvtepu16_epi64(block);
+            else
+                return isSigned ? _mm256_cvtepi32_epi64(block) : _mm256_cvtepu32_epi64(block);
+        }
+
+        /**
+         * @brief AVX2 widening (`vpmovsx` / `vpmovzx`).
+         *
+         * @tparam Destination wide type.
+         * @tparam Source narrow type.
+         * @param[in] values source values.
+         * @param[out] result widened values.
+         * @return std::size_t number of values widened (whole blocks).
+         */
+        template<class Destination, class Source>
+        EASY_MATH_TARGET_AVX2 inline std::size_t avx2Widen_(std::span<const Source> values, std::span<Destination> result) noexcept
+        {
+            constexpr std::size_t LANES = 32 / sizeof(Destination);
+            constexpr std::size_t SOURCE_BYTES = LANES * sizeof(Source);
+
+            std::size_t i = 0;
+            for(; i + LANES <= values.size(); i += LANES)
+            {
+                __m128i block;
+                if constexpr (SOURCE_BYTES == 16)
+                    block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values.data() + i));
+                else if constexpr (SOURCE_BYTES == 8)
+                    block = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(values.data() + i));
+                else
+                {
+                    std::int32_t bytes;
+                    std::memcpy(&bytes, values.data() + i, sizeof(bytes));
+                    block = _mm_cvtsi32_si128(bytes);
+                }
+
+                _mm256_storeu_si256(
+                    reinterpret_cast<__m256i*>(result.data() + i),
+                    avx2Extend_<sizeof(Source), sizeof(Destination), std::is_signed_v<Source>>(block)
+                );
+            }
+
+            return i;
+        }
+
+        /**
+         * @brief AVX2 bitwise or of all values.
+         *
+         * @tparam UInt builtin unsigned type.
+         * @param[in] values values.
+         * @param[out] accumulated or of the values processed.
+         * @return std::size_t number of values processed (whole blocks).
+         */
+        template<class UInt>
+        EASY_MATH_TARGET_AVX2 inline std::size_t avx2OrReduce_(std::span<const UInt> values, UInt& accumulated) noexcept
+        {
+            constexpr std::size_t LANES = 32 / sizeof(UInt);
+
+            __m256i sums[4] = {_mm256_setzero_si256(), _mm256_setzero_si256(), _mm256_setzero_si256(), _mm256_setzero_si256()};
+
+            std::size_t i = 0;
+            for(; i + 4 * LANES <= values.size(); i += 4 * LANES)
+                for(std::size_t j = 0; j < 4; ++j)
+                    sums[j] = _mm256_or_si256(sums[j], _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values.data() + i + j * LANES)));
+
+            __m256i sum = _mm256_or_si256(_mm256_or_si256(sums[0], sums[1]), _mm256_or_si256(sums[2], sums[3]));
+            __m128i half = _mm_or_si128(_mm256_castsi256_si128(sum), _mm256_extracti128_si256(sum, 1));
+            half = _mm_or_si128(half, _mm_unpackhi_epi64(half, half));
+
+            auto word = static_cast<std::uint64_t>(_mm_cvtsi128_si64(half));
+            if constexpr (sizeof(UInt) < 8)
+                word |= word >> 32;
+            if constexpr (sizeof(UInt) < 4)
+                word |= word >> 16;
+            if constexpr (sizeof(UInt) < 2)
+                word |= word >> 8;
+
+            accumulated = static_cast<UInt>(accumulated | static_cast<UInt>(word));
+            return i;
+        }
+
+#endif
+
+#if defined(EASY_MATH_DISPATCH_AVX512BW)
+
+        /// @brief Lane wise add of `size` byte lanes.
+        template<std::size_t size>
+        [[nodiscard]] EASY_MATH_TARGET_AVX512BW inline __m512i avx512AddLanes_(__m512i lhs, __m512i rhs) noexcept
+        {
+            if constexpr (size == 2)
+                return _mm512_add_epi16(lhs, rhs);
+            else if constexpr (size == 4)
+                return _mm512_add_epi32(lhs, rhs);
+            else
+                return _mm512_add_epi64(lhs, rhs);
+        }
+
+        /**
+         * @brief AVX-512 range checked narrowing (`vpmov` truncation), see `avx2Narrow_`.
+         *
+         * @tparam Destination narrow type.
+         * @tparam Source wide type.
+         * @param[in] values source values.
+         * @param[out] result narrowed values.
+         * @return std::size_t number of values narrowed (whole blocks in range).
+         */
+        template<class Destination, class Source>
+        EASY_MATH_TARGET_AVX512BW inline std::size_t avx512Narrow_(std::span<const Source> values, std::span<Destination> result) noexcept
+        {
+            using Range = NarrowRange_<Destination, Source>;
+            constexpr std::size_t LANES = 64 / sizeof(Source);
+
+            const __m512i bias = _mm512_set1_epi64(static_cast<std::int64_t>(Range::BIAS));
+            const __m512i highMask = _mm512_set1_epi64(static_cast<std::int64_t>(Range::HIGH_MASK));
+
+            std::size_t i = 0;
+            for(; i + LANES <= values.size(); i += LANES)
+            {
+                __m512i block = _mm512_loadu_si512(values.data() + i);
+
+                __m512i biased = (Range::BIAS != 0) ? avx512AddLanes_<sizeof(Source)>(block, bias) : block;
+                if(_mm512_test_epi32_mask(biased, highMask) != 0)
+                    break;
+
+                auto destination = result.data() + i;
+
+                // full mask zeroing forms, the unmasked ones merge into an undefined register (-Wmaybe-uninitialized).
+                if constexpr (sizeof(Source) == 8 && sizeof(Destination) == 4)
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination), _mm512_maskz_cvtepi64_epi32(0xff, block));
+                else if constexpr (sizeof(Source) == 8 && sizeof(Destination) == 2)
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(destination), _mm512_maskz_cvtepi64_epi16(0xff, block));
+                else if constexpr (sizeof(Source) == 8)
+                    _mm_storel_epi64(reinterpret_cast<__m128i*>(destination), _mm512_maskz_cvtepi64_epi8(0xff, block));
+                else if constexpr (sizeof(Source) == 4 && sizeof(Destination) == 2)
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination), _mm512_maskz_cvtepi32_epi16(0xffff, block));
+                else if constexpr (sizeof(Source) == 4)
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(destination), _mm512_maskz_cvtepi32_epi8(0xffff, block));
+                else
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination), _mm512_maskz_cvtepi16_epi8(0xffffffff, block));
+            }
+
+            return i;
+        }
+
+        /**
+         * @brief AVX-512 widening, see `avx2Widen_`.
+         *
+         * @tparam Destination wide type.
+         * @tparam Source narrow type.
+         * @param[in] values source values.
+         * @param[out] result widened values.
+         * @return std::size_t number of values widened (whole blocks).
+         */
+        template<class Destination, class Source>
+        EASY_MATH_TARGET_AVX512BW inline std::size_t avx512Widen_(std::span<const Source> values, std::span<Destination> result) noexcept
+        {
+            constexpr std::size_t LANES = 64 / sizeof(Destination);
+            constexpr bool IS_SIGNED = std::is_signed_v<Source>;
+
+            std::size_t i = 0;
+            for(; i + LANES <= values.size(); i += LANES)
+            {
+                auto source = values.data() + i;
+                __m512i block;
+
+                if constexpr (sizeof(Source) == 1 && sizeof(Destination) == 2)
+                {
+                    __m256i narrow = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source));
+                    block = IS_SIGNED ? _mm512_maskz_cvtepi8_epi16(0xffffffff, narrow) : _mm512_maskz_cvtepu8_epi16(0xffffffff, narrow);
+                }
+                else if constexpr (sizeof(Source) == 1 && sizeof(Destination) == 4)
+                {
+                    __m128i narrow = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source));
+                    block = IS_SIGNED ? _mm512_maskz_cvtepi8_epi32(0xffff, narrow) : _mm512_maskz_cvtepu8_epi32(0xffff, narrow);
+                }
+                else if constexpr (sizeof(Source) == 1)
+                {
+                    __m128i narrow = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(source));
+                    block = IS_SIGNED ? _mm512_maskz_cvtepi8_epi64(0xff, narrow) : _mm512_maskz_cvtepu8_epi64(0xff, narrow);
+                }
+                else if constexpr (sizeof(Source) == 2 && sizeof(Destination) == 4)
+                {
+                    __m256i narrow = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source));
+                    block = IS_SIGNED ? _mm512_maskz_cvtepi16_epi32(0xffff, narrow) : _mm512_maskz_cvtepu16_epi32(0xffff, narrow);
+                }
+                else if constexpr (sizeof(Source) == 2)
+                {
+                    __m128i narrow = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source));
+                    block = IS_SIGNED ? _mm512_maskz_cvtepi16_epi64(0xff, narrow) : _mm512_maskz_cvtepu16_epi64(0xff, narrow);
+                }
+                else
+                {
+                    __m256i narrow = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source));
+                    block = IS_SIGNED ? _mm512_maskz_cvtepi32_epi64(0xff, narrow) : _mm512_maskz_cvtepu32_epi64(0xff, narrow);
+                }
+
+                _mm512_storeu_si512(result.data() + i, block);
+            }
+
+            return i;
+        }
+
+#endif
+    }
+
+    /**
+     * @brief Narrow each value to `Destination`, stopping at the first value out of its range instead of truncating.
+     *
+     * AVX2 / AVX-512 (`vpmov`) kernels at runtime check a block with one biased mask test and narrow it with
+     * byte shuffles, the block holding an out of range value is redone scalar to find its index.
+     *
+     * @tparam Destination narrower builtin integer (eg: `SizeCapableUint<bits>`), any signedness.
+     * @tparam Source wider builtin integer.
+     * @param[in] values source values.
+     * @param[out] result narrowed values, requires at least `values.size()` entries.
+     * @return std::size_t `values.size()` if every value fits, else index of the first value that does not, values
+     * before it are written.
+     */
+    template<TranscodeInteger Destination, TranscodeInteger Source>
+        requires (sizeof(Destination) < sizeof(Source))
+    inline constexpr std::size_t narrow(std::span<const Source> values, std::span<Destination> result) noexcept
+    {
+        std::size_t i = 0;
+
+        if(!std::is_constant_evaluated())
+        {
+#if defined(EASY_MATH_DISPATCH_AVX512BW)
+            if(impl_detail_::useAvx512_())
+                i = impl_detail_::avx512Narrow_<Destination, Source>(values, result);
+            else
+#endif
+#if defined(EASY_MATH_DISPATCH_AVX2)
+            if(impl_detail_::useAvx2_())
+                i = impl_detail_::avx2Narrow_<Destination, Source>(values, result);
+#endif
+        }
+
+        for(; i < values.size(); ++i)
+        {
+            if(!std::in_range<Destination>(values[i]))
+                return i;
+            result[i] = static_cast<Destination>(values[i]);
+        }
+
+        return values.size();
+    }
+
+    /**
+     * @brief Widen each value to `Destination` (sign extension of signed sources), `vpmovsx` / `vpmovzx` at runtime.
+     *
+     * @tparam Destination wider builtin integer, signed if `Source` is signed.
+     * @tparam Source narrower builtin integer.
+     * @param[in] values source values.
+     * @param[out] result widened values, requires at least `values.size()` entries.
+     */
+    template<TranscodeInteger Destination, TranscodeInteger Source>
+        requires (sizeof(Destination) > sizeof(Source)) && (std::is_signed_v<Destination> || !std::is_signed_v<Source>)
+    inline constexpr void widen(std::span<const Source> values, std::span<Destination> result) noexcept
+    {
+        std::size_t i = 0;
+
+        if(!std::is_constant_evaluated())
+        {
+#if defined(EASY_MATH_DISPATCH_AVX512BW)
+            if(impl_detail_::useAvx512_())
+                i = impl_detail_::avx512Widen_<Destination, Source>(values, result);
+            else
+#endif
+#if defined(EASY_MATH_DISPATCH_AVX2)
+            if(impl_detail_::useAvx2_())
+                i = impl_detail_::avx2Widen_<Destination, Source>(values, result);
+#endif
+        }
+
+        for(; i < values.size(); ++i)
+            result[i] = static_cast<Destination>(values[i]);
+    }
+
+    /**
+     * @brief Bits needed to store every value, choose the narrow type with `SizeCapableUint` (or the runtime
+     * `narrowedSize`) then `narrow`.
+     *
+     * @tparam UInt builtin unsigned type.
+     * @param[in] values values.
+     * @return std::size_t `std::bit_width` of the maximum value (0 if all zero or empty).
+     */
+    template<TranscodeInteger UInt>
+        requires std::is_unsigned_v<UInt>
+    [[nodiscard]] inline constexpr std::size_t requiredBitWidth(std::span<const UInt> values) noexcept
+    {
+        // bit width of the or of all values equals that of the maximum.
+        UInt accumulated = 0;
+        std::size_t i = 0;
+
+#if defined(EASY_MATH_DISPATCH_AVX2)
+        if(!std::is_constant_evaluated() && impl_detail_::useAvx2_())
+            i = impl_detail_::avx2OrReduce_<UInt>(values, accumulated);
+#endif
+
+        for(; i < values.size(); ++i)
+            accumulated = static_cast<UInt>(accumulated | values[i]);
+
+        return static_cast<std::size_t>(std::bit_width(accumulated));
+    }
+
+    /**
+     * @brief Byte size of the smallest builtin unsigned type holding `bitWidth` bits (same choice as `SizeCapableUint`).
+     *
+     * @param[in] bitWidth required bits (eg: from `requiredBitWidth`), at most 64.
+     * @return std::size_t 1, 2, 4 or 8.
+     */
+    [[nodiscard]] inline constexpr std::size_t narrowedSize(std::size_t bitWidth) noexcept
+    {
+        return (bitWidth <= 8) ? 1 : std::bit_ceil(divideRoundUp<std::size_t>(bitWidth, 8));
+    }
+}
+
+#endif // INCLUDE_EASYMATHLIB_TRANSCODE_H_INCLUDED
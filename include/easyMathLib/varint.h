@@ -0,0 +1,672 @@
+/**
+ * @file varint.h
+ * @author Harith Manoj
+ * @brief Varint (unsigned LEB128) codec with zigzag mapping of signed integers.
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (C) Harith Manoj
+ *
+ *
+ *                      APACHE LICENSE 2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef INCLUDE_EASYMATHLIB_VARINT_H_INCLUDED
+
+/// @brief include\easyMathLib\varint.h Header Guard
+#define INCLUDE_EASYMATHLIB_VARINT_H_INCLUDED
+
+#include <span>
+#include <bit>
+#include <array>
+#include <vector>
+#include <cstdint>
+#include <concepts>
+#include <algorithm>
+#include <type_traits>
+
+#include <easyMathLib/easyMath.h>
+#include <easyMathLib/simdSupport.h>
+#include <easyMathLib/bitPacking.h>
+
+namespace easyMath
+{
+    /**
+     * @brief Integer type accepted by the varint codec, any `UnsignedIntegral` or builtin signed integer
+     * (zigzag mapped).
+     *
+     * @tparam Integer type to check.
+     */
+    template<class Integer>
+    concept VarintEncodable = !std::same_as<Integer, bool>
+        && (UnsignedIntegral<Integer> || (SignedIntegral<Integer> && std::is_integral_v<Integer>));
+
+    /**
+     * @brief Result of a bulk varint encode / decode.
+     *
+     * `valueCount` below the requested count signals an undersized destination (encode) or truncated /
+     * malformed input (decode), both counts then cover the values processed before the failure.
+     */
+    struct VarintResult
+    {
+        /// @brief Number of values encoded / decoded.
+        std::size_t valueCount;
+
+        /// @brief Number of bytes written / consumed.
+        std::size_t byteCount;
+    };
+
+    /**
+     * @brief Map signed to unsigned so that values of small magnitude stay small (0, -1, 1, -2 -> 0, 1, 2, 3).
+     *
+     * @tparam SInt builtin signed integer.
+     * @param[in] value value to map.
+     * @return std::make_unsigned_t<SInt> zigzag value.
+     */
+    template<std::signed_integral SInt>
+    [[nodiscard]] inline constexpr std::make_unsigned_t<SInt> zigZagEncode(SInt value) noexcept
+    {
+        using UInt = std::make_unsigned_t<SInt>;
+        return static_cast<UInt>((static_cast<UInt>(value) << 1) ^ static_cast<UInt>(value >> (bitSize<SInt>() - 1)));
+    }
+
+    /**
+     * @brief Inverse of `zigZagEncode`.
+     *
+     * @tparam UInt builtin unsigned integer.
+     * @param[in] value zigzag value.
+     * @return std::make_signed_t<UInt> signed value.
+     */
+    template<std::unsigned_integral UInt>
+        requires (!std::same_as<UInt, bool>)
+    [[nodiscard]] inline constexpr std::make_signed_t<UInt> zigZagDecode(UInt value) noexcept
+    {
+        return static_cast<std::make_signed_t<UInt>>(static_cast<UInt>((value >> 1) ^ static_cast<UInt>(0u - (value & 1u))));
+    }
+
+    namespace impl_detail_
+    {
+        /**
+         * @brief Unsigned type carried on the wire for `Integer`.
+         *
+         * @tparam Integer encoded type.
+         */
+        template<class Integer>
+        using VarintUnsigned_ = typename std::conditional_t<
+            std::is_integral_v<Integer> && std::is_signed_v<Integer>,
+            std::make_unsigned<Integer>,
+            std::type_identity<Integer>
+        >::type;
+
+        /// @brief Continuation bit of every byte.
+        constexpr std::uint64_t VARINT_CONTINUATION_BITS_ = 0x8080808080808080ull;
+
+        /// @brief Payload bits of every byte.
+        constexpr std::uint64_t VARINT_PAYLOAD_BITS_ = 0x7f7f7f7f7f7f7f7full;
+
+        /// @brief Builtin unsigned wire type handled by the word at a time paths.
+        template<class UInt>
+        constexpr bool IS_WORD_VARINT_ = std::is_integral_v<UInt> && (sizeof(UInt) <= 8);
+
+        /**
+         * @brief Gather the 7 bit payloads of up to 8 bytes into one integer (`pext` with BMI2).
+         *
+         * @param[in] word little endian bytes, continuation bits must already be clear.
+         * @return std::uint64_t payload.
+         */
+        [[nodiscard]] inline constexpr std::uint64_t compact7_(std::uint64_t word) noexcept
+        {
+#if defined(EASY_MATH_HAS_BMI2) && (defined(__x86_64__) || defined(_M_X64))
+            if(!std::is_constant_evaluated())
+                return _pext_u64(word, VARINT_PAYLOAD_BITS_);
+#endif
+            word = (word & 0x007f007f007f007full) | ((word & 0x7f007f007f007f00ull) >> 1);
+            word = (word & 0x00003fff00003fffull) | ((word & 0x3fff00003fff0000ull) >> 2);
+            return (word & 0x000000000fffffffull) | ((word & 0x0fffffff00000000ull) >> 4);
+        }
+
+        /**
+         * @brief Spread lower 56 bits of `value` into 7 bit payloads of 8 bytes (`pdep` with BMI2).
+         *
+         * @param[in] value value, requires `value < 2^56`.
+         * @return std::uint64_t little endian bytes with clear continuation bits.
+         */
+        [[nodiscard]] inline constexpr std::uint64_t spread7_(std::uint64_t value) noexcept
+        {
+#if defined(EASY_MATH_HAS_BMI2) && (defined(__x86_64__) || defined(_M_X64))
+            if(!std::is_constant_evaluated())
+                return _pdep_u64(value, VARINT_PAYLOAD_BITS_);
+#endif
+            value = (value & 0x000000000fffffffull) | ((value & 0x00fffffff0000000ull) << 4);
+            value = (value & 0x00003fff00003fffull) | ((value & 0x0fffc0000fffc000ull) << 2);
+            return (value & 0x007f007f007f007full) | ((value & 0x3f803f803f803f80ull) << 1);
+        }
+
+        /**
+         * @brief Encode unsigned value byte by byte.
+         *
+         * @tparam UInt unsigned type.
+         * @param[in] value value.
+         * @param[out] bytes destination.
+         * @return std::size_t bytes written, 0 if `bytes` is too small.
+         */
+        template<class UInt>
+        [[nodiscard]] inline constexpr std::size_t varintEncodeUnsigned_(UInt value, std::span<std::uint8_t> bytes) noexcept
+        {
+            if constexpr (IS_WORD_VARINT_<UInt>)
+            {
+                if(!std::is_constant_evaluated() && (bytes.size() >= 8) && (static_cast<std::uint64_t>(value) >> 56) == 0)
+                {
+                    auto wide = static_cast<std::uint64_t>(value);
+                    std::size_t length = std::max<std::size_t>(1, divideRoundUp<std::size_t>(std::bit_width(wide), 7));
+
+                    storeLittle64_(bytes.data(), spread7_(wide) | (VARINT_CONTINUATION_BITS_ & nBitMask<std::uint64_t>((length - 1) * 8)));
+                    return length;
+                }
+            }
+
+            for(std::size_t i = 0; i < bytes.size(); ++i)
+            {
+                auto payload = static_cast<std::uint8_t>(value & UInt(0x7fu));
+                value >>= 7u;
+
+                if(value == UInt(0u))
+                {
+                    bytes[i] = payload;
+                    return i + 1;
+                }
+
+                bytes[i] = static_cast<std::uint8_t>(payload | 0x80u);
+            }
+
+            return 0;
+        }
+
+        /**
+         * @brief Decode unsigned value byte by byte, rejecting values that do not fit `UInt`.
+         *
+         * @tparam UInt unsigned type.
+         * @param[in] bytes source.
+         * @param[out] value decoded value, unchanged on failure.
+         * @return std::size_t bytes consumed, 0 if truncated or out of range.
+         */
+        template<class UInt>
+        [[nodiscard]] inline constexpr std::size_t varintDecodeBytes_(std::span<const std::uint8_t> bytes, UInt& value) noexcept
+        {
+            constexpr std::size_t bits = bitSize<UInt>();
+
+            UInt result(0u);
+
+            for(std::size_t i = 0; (i < bytes.size()) && (i * 7 < bits); ++i)
+            {
+                std::uint8_t payload = bytes[i] & 0x7fu;
+
+                if((i * 7 + 7 > bits) && ((payload >> (bits - i * 7)) != 0))
+                    return 0;
+
+                result = static_cast<UInt>(result | (static_cast<UInt>(payload) << (i * 7)));
+
+                if((bytes[i] & 0x80u) == 0)
+                {
+                    value = result;
+                    return i + 1;
+                }
+            }
+
+            return 0;
+        }
+
+        /**
+         * @brief Decode unsigned value, one unaligned 8 byte load for values up to 56 bits when possible.
+         *
+         * @tparam UInt unsigned type.
+         * @param[in] bytes source.
+         * @param[out] value decoded value, unchanged on failure.
+         * @return std::size_t bytes consumed, 0 if truncated or out of range.
+         */
+        template<class UInt>
+        [[nodiscard]] inline constexpr std::size_t varintDecodeUnsigned_(std::span<const std::uint8_t> bytes, UInt& value) noexcept
+        {
+            if constexpr (IS_WORD_VARINT_<UInt>)
+            {
+                if(!std::is_constant_evaluated() && (bytes.size() >= 8))
+                {
+                    auto word = loadLittle64_(bytes.data());
+                    auto stops = ~word & VARINT_CONTINUATION_BITS_;
+
+                    if(stops != 0)
+                    {
+                        std::size_t length = static_cast<std::size_t>(std::countr_zero(stops)) / 8 + 1;
+                        auto decoded = compact7_(word & (VARINT_PAYLOAD_BITS_ >> (64 - length * 8)));
+
+                        if((length * 7 > bitSize<UInt>() + 6) || ((bitSize<UInt>() < 64) && (decoded >> (bitSize<UInt>() % 64)) != 0))
+                            return 0;
+
+                        value = static_cast<UInt>(decoded);
+                        return length;
+                    }
+                }
+            }
+
+            return varintDecodeBytes_<UInt>(bytes, value);
+        }
+
+        /// @brief Masked VByte lookup entry for one 12 bit continuation mask.
+        struct MaskedVByteEntry_
+        {
+            /// @brief Values decoded: 6 as 16 bit lanes, 1 to 4 as 32 bit lanes, 0 for the scalar fallback.
+            std::uint8_t count;
+
+            /// @brief Bytes consumed.
+            std::uint8_t byteCount;
+
+            /// @brief Index into the shuffle table of the lane width.
+            std::uint8_t shuffle;
+        };
+
+        /// @brief pshufb patterns gathering six 1 / 2 byte varints into 16 bit lanes, bit j set if varint j is 2 bytes.
+        constexpr auto MASKED_VBYTE_SHUFFLE16_ = []()
+        {
+            std::array<std::array<std::uint8_t, 16>, 64> table{};
+
+            for(std::size_t lengths = 0; lengths < table.size(); ++lengths)
+            {
+                table[lengths].fill(0x80);
+
+                std::uint8_t start = 0;
+                for(std::size_t j = 0; j < 6; ++j)
+                {
+                    bool isLong = (lengths >> j) & 1;
+                    table[lengths][2 * j] = start;
+                    if(isLong)
+                        table[lengths][2 * j + 1] = static_cast<std::uint8_t>(start + 1);
+
+                    start = static_cast<std::uint8_t>(start + (isLong ? 2 : 1));
+                }
+            }
+
+            return table;
+        }();
+
+        /// @brief pshufb patterns gathering four 1 to 4 byte varints into 32 bit lanes, bits 2j holding length j - 1.
+        constexpr auto MASKED_VBYTE_SHUFFLE32_ = []()
+        {
+            std::array<std::array<std::uint8_t, 16>, 256> table{};
+
+            for(std::size_t lengths = 0; lengths < table.size(); ++lengths)
+            {
+                table[lengths].fill(0x80);
+
+                std::uint8_t start = 0;
+                for(std::size_t j = 0; j < 4; ++j)
+                {
+                    std::size_t length = ((lengths >> (2 * j)) & 3) + 1;
+                    for(std::size_t k = 0; k < length; ++k)
+                        table[lengths][4 * j + k] = static_cast<std::uint8_t>(start + k);
+
+                    start = static_cast<std::uint8_t>(start + length);
+                }
+            }
+
+            return table;
+        }();
+
+        /// @brief Decode step for every continuation mask of the first 12 bytes of a block.
+        constexpr auto MASKED_VBYTE_TABLE_ = []()
+        {
+            std::array<MaskedVByteEntry_, 4096> table{};
+
+            for(std::size_t mask = 0; mask < table.size(); ++mask)
+            {
+                std::array<std::size_t, 12> lengths{};
+                std::size_t complete = 0;
+
+                for(std::size_t start = 0, end = 0; end < 12; ++end)
+                {
+                    if(((mask >> end) & 1) == 0)
+                    {
+                        lengths[complete++] = end - start + 1;
+                        start = end + 1;
+                    }
+                }
+
+                auto& entry = table[mask];
+
+                if((complete >= 6) && std::all_of(lengths.begin(), lengths.begin() + 6, [](std::size_t length) { return length <= 2; }))
+                {
+                    entry.count = 6;
+                    for(std::size_t j = 0; j < 6; ++j)
+                    {
+                        entry.byteCount = static_cast<std::uint8_t>(entry.byteCount + lengths[j]);
+                        entry.shuffle = static_cast<std::uint8_t>(entry.shuffle | ((lengths[j] - 1) << j));
+                    }
+                }
+                else
+                {
+                    for(std::size_t j = 0; (j < 4) && (j < complete) && (lengths[j] <= 4); ++j)
+                    {
+                        ++entry.count;
+                        entry.byteCount = static_cast<std::uint8_t>(entry.byteCount + lengths[j]);
+                        entry.shuffle = static_cast<std::uint8_t>(entry.shuffle | ((lengths[j] - 1) << (2 * j)));
+                    }
+                }
+            }
+
+            return table;
+        }();
+
+#if defined(EASY_MATH_DISPATCH_SSE4_2)
+
+        /**
+         * @brief Store four decoded 32 bit lanes, zigzag decoding them for signed destinations.
+         *
+         * @tparam Integer 4 byte destination type.
+         * @param[out] destination destination of four values.
+         * @param[in] lanes decoded unsigned values.
+         */
+        template<class Integer>
+        EASY_MATH_TARGET_SSE4_2 inline void maskedVByteStore_(Integer* destination, __m128i lanes) noexcept
+        {
+            if constexpr (std::is_signed_v<Integer>)
+                lanes = _mm_xor_si128(_mm_srli_epi32(lanes, 1), _mm_sub_epi32(_mm_setzero_si128(), _mm_and_si128(lanes, _mm_set1_epi32(1))));
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(destination), lanes);
+        }
+
+#if defined(EASY_MATH_DISPATCH_AVX2)
+
+        /**
+         * @brief Widen 32 single byte values, zigzag decoding them for signed destinations.
+         *
+         * @tparam Integer 4 byte destination type.
+         * @param[in] bytes 32 bytes without continuation bits.
+         * @param[out] destination destination of 32 values.
+         */
+        template<class Integer>
+        EASY_MATH_TARGET_AVX2 inline void avx2SingleByteRun_(const std::uint8_t* bytes, Integer* destination) noexcept
+        {
+            for(std::size_t j = 0; j < 4; ++j)
+            {
+                auto lanes = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(bytes + 8 * j)));
+
+                if constexpr (std::is_signed_v<Integer>)
+                    lanes = _mm256_xor_si256(_mm256_srli_epi32(lanes, 1), _mm256_sub_epi32(_mm256_setzero_si256(), _mm256_and_si256(lanes, _mm256_set1_epi32(1))));
+
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + 8 * j), lanes);
+            }
+        }
+
+#endif
+
+        /**
+         * @brief Masked VByte bulk decode of 32 bit values (Plaisance, Kurz, Lemire), consumes whole 16 byte
+         * windows while at least 16 bytes and 32 destination slots remain.
+         *
+         * @tparam Integer 4 byte destination type.
+         * @param[in] bytes source.
+         * @param[out] values destination.
+         * @param[in] isAvx2 widen runs of 32 single byte values with `avx2SingleByteRun_`.
+         * @return VarintResult values and bytes decoded (a prefix of the input).
+         */
+        template<class Integer>
+        [[nodiscard]] EASY_MATH_TARGET_SSE4_2 inline VarintResult maskedVByteDecode_(
+            std::span<const std::uint8_t> bytes,
+            std::span<Integer> values,
+            [[maybe_unused]] bool isAvx2
+        ) noexcept
+        {
+            std::size_t in = 0, out = 0;
+
+            while((in + 16 <= bytes.size()) && (out + 32 <= values.size()))
+            {
+                auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes.data() + in));
+                auto mask = static_cast<unsigned int>(_mm_movemask_epi8(block));
+
+                if(mask == 0)
+                {
+#if defined(EASY_MATH_DISPATCH_AVX2)
+                    if(isAvx2 && (in + 32 <= bytes.size()) && (_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes.data() + in + 16))) == 0))
+                    {
+                        avx2SingleByteRun_(bytes.data() + in, values.data() + out);
+                        in += 32;
+                        out += 32;
+                        continue;
+                    }
+#endif
+                    maskedVByteStore_(values.data() + out, _mm_cvtepu8_epi32(block));
+                    maskedVByteStore_(values.data() + out + 4, _mm_cvtepu8_epi32(_mm_srli_si128(block, 4)));
+                    maskedVByteStore_(values.data() + out + 8, _mm_cvtepu8_epi32(_mm_srli_si128(block, 8)));
+                    maskedVByteStore_(values.data() + out + 12, _mm_cvtepu8_epi32(_mm_srli_si128(block, 12)));
+                    in += 16;
+                    out += 16;
+                    continue;
+                }
+
+                const auto& entry = MASKED_VBYTE_TABLE_[mask & 0xfff];
+
+                if(entry.count == 6)
+                {
+                    auto lanes = _mm_shuffle_epi8(block, _mm_loadu_si128(reinterpret_cast<const __m128i*>(MASKED_VBYTE_SHUFFLE16_[entry.shuffle].data())));
+                    lanes = _mm_or_si128(
+                        _mm_and_si128(lanes, _mm_set1_epi16(0x007f)),
+                        _mm_srli_epi16(_mm_and_si128(lanes, _mm_set1_epi16(0x7f00)), 1)
+                    );
+
+                    maskedVByteStore_(values.data() + out, _mm_cvtepu16_epi32(lanes));
+                    maskedVByteStore_(values.data() + out + 4, _mm_cvtepu16_epi32(_mm_srli_si128(lanes, 8)));
+                }
+                else if(entry.count != 0)
+                {
+                    auto lanes = _mm_shuffle_epi8(block, _mm_loadu_si128(reinterpret_cast<const __m128i*>(MASKED_VBYTE_SHUFFLE32_[entry.shuffle].data())));
+                    lanes = _mm_or_si128(
+                        _mm_or_si128(
+                            _mm_and_si128(lanes, _mm_set1_epi32(0x0000007f)),
+                            _mm_srli_epi32(_mm_and_si128(lanes, _mm_set1_epi32(0x00007f00)), 1)
+                        ),
+                        _mm_or_si128(
+                            _mm_srli_epi32(_mm_and_si128(lanes, _mm_set1_epi32(0x007f0000)), 2),
+                            _mm_srli_epi32(_mm_and_si128(lanes, _mm_set1_epi32(0x7f000000)), 3)
+                        )
+                    );
+
+                    maskedVByteStore_(values.data() + out, lanes);
+                }
+                else
+                {
+                    // leading 5 byte value.
+                    VarintUnsigned_<Integer> value{};
+                    std::size_t length = varintDecodeUnsigned_(bytes.subspan(in), value);
+                    if(length == 0)
+                        break;
+
+                    values[out] = static_cast<Integer>(std::is_signed_v<Integer> ? zigZagDecode(value) : value);
+                    in += length;
+                    ++out;
+                    continue;
+                }
+
+                in += entry.byteCount;
+                out += entry.count;
+            }
+
+            return {out, in};
+        }
+
+#endif
+    }
+
+    /**
+     * @brief Maximum encoded size of an `Integer` in bytes.
+     *
+     * @tparam Integer encoded type.
+     * @return std::size_t `ceil(bits / 7)`.
+     */
+    template<VarintEncodable Integer>
+    [[nodiscard]] inline constexpr std::size_t varintMaxSize() noexcept
+    {
+        return divideRoundUp<std::size_t>(bitSize<Integer>(), 7);
+    }
+
+    /**
+     * @brief Encoded size of `value` in bytes.
+     *
+     * @tparam Integer encoded type.
+     * @param[in] value value (zigzag mapped if signed).
+     * @return std::size_t encoded size.
+     */
+    template<VarintEncodable Integer>
+    [[nodiscard]] inline constexpr std::size_t varintSize(Integer value) noexcept
+    {
+        using UInt = impl_detail_::VarintUnsigned_<Integer>;
+
+        UInt wire;
+        if constexpr (std::is_signed_v<Integer>)
+            wire = zigZagEncode(value);
+        else
+            wire = value;
+
+        std::size_t size = 1;
+        for(wire >>= 7u; wire != UInt(0u); wire >>= 7u)
+            ++size;
+
+        return size;
+    }
+
+    /**
+     * @brief Encode a single value.
+     *
+     * At runtime up to 8 bytes of `bytes` may be written even for shorter encodings.
+     *
+     * @tparam Integer encoded type.
+     * @param[in] value value (zigzag mapped if signed).
+     * @param[out] bytes destination.
+     * @return std::size_t bytes of the encoding, 0 if `bytes` is too small.
+     */
+    template<VarintEncodable Integer>
+    [[nodiscard]] inline constexpr std::size_t varintEncode(Integer value, std::span<std::uint8_t> bytes) noexcept
+    {
+        if constexpr (std::is_signed_v<Integer>)
+            return impl_detail_::varintEncodeUnsigned_(zigZagEncode(value), bytes);
+        else
+            return impl_detail_::varintEncodeUnsigned_(value, bytes);
+    }
+
+    /**
+     * @brief Decode a single value.
+     *
+     * @tparam Integer decoded type.
+     * @param[in] bytes source, never read past its end.
+     * @param[out] value decoded value, unchanged on failure.
+     * @return std::size_t bytes consumed, 0 if input is truncated or the value does not fit `Integer`.
+     */
+    template<VarintEncodable Integer>
+    [[nodiscard]] inline constexpr std::size_t varintDecode(std::span<const std::uint8_t> bytes, Integer& value) noexcept
+    {
+        impl_detail_::VarintUnsigned_<Integer> wire{};
+        std::size_t length = impl_detail_::varintDecodeUnsigned_(bytes, wire);
+
+        if(length != 0)
+        {
+            if constexpr (std::is_signed_v<Integer>)
+                value = zigZagDecode(wire);
+            else
+                value = wire;
+        }
+
+        return length;
+    }
+
+    /**
+     * @brief Encode values back to back.
+     *
+     * @tparam Integer encoded type.
+     * @param[in] values values.
+     * @param[out] bytes destination, `values.size() * varintMaxSize<Integer>()` bytes always suffice.
+     * @return VarintResult values and bytes written, stops at the first value that does not fit.
+     */
+    template<VarintEncodable Integer>
+    [[nodiscard]] inline constexpr VarintResult varintEncode(
+        std::type_identity_t<std::span<const Integer>> values,
+        std::span<std::uint8_t> bytes
+    ) noexcept
+    {
+        std::size_t out = 0;
+
+        for(std::size_t i = 0; i < values.size(); ++i)
+        {
+            std::size_t length = varintEncode<Integer>(values[i], bytes.subspan(out));
+            if(length == 0)
+                return {i, out};
+
+            out += length;
+        }
+
+        return {values.size(), out};
+    }
+
+    /**
+     * @brief Encode values back to back into a new buffer.
+     *
+     * @tparam Integer encoded type.
+     * @param[in] values values.
+     * @return std::vector<std::uint8_t> encoded bytes.
+     */
+    template<VarintEncodable Integer>
+    [[nodiscard]] inline std::vector<std::uint8_t> varintEncode(std::type_identity_t<std::span<const Integer>> values)
+    {
+        std::vector<std::uint8_t> bytes(values.size() * varintMaxSize<Integer>() + 8);
+        bytes.resize(varintEncode<Integer>(values, bytes).byteCount);
+        return bytes;
+    }
+
+    /**
+     * @brief Decode `values.size()` back to back values without allocating.
+     *
+     * 32 bit types use masked VByte decoding (SSE4 shuffle table, AVX2 for runs of single byte values) when
+     * allowed by `easyLib::cpuTier()`, other types decode one 8 byte load per value.
+     *
+     * @tparam Integer decoded type.
+     * @param[in] bytes source, never read past its end.
+     * @param[out] values destination.
+     * @return VarintResult values and bytes decoded, fewer values than requested if input is truncated or malformed.
+     */
+    template<VarintEncodable Integer>
+    [[nodiscard]] inline constexpr VarintResult varintDecode(
+        std::span<const std::uint8_t> bytes,
+        std::type_identity_t<std::span<Integer>> values
+    ) noexcept
+    {
+        VarintResult result{0, 0};
+
+#if defined(EASY_MATH_DISPATCH_SSE4_2)
+        if constexpr (std::is_integral_v<Integer> && (sizeof(Integer) == 4))
+            if(!std::is_constant_evaluated() && impl_detail_::useSse42_())
+                result = impl_detail_::maskedVByteDecode_<Integer>(bytes, values, impl_detail_::useAvx2_());
+#endif
+
+        for(; result.valueCount < values.size(); ++result.valueCount)
+        {
+            std::size_t length = varintDecode<Integer>(bytes.subspan(result.byteCount), values[result.valueCount]);
+            if(length == 0)
+                break;
+
+            result.byteCount += length;
+        }
+
+        return result;
+    }
+}
+
+#endif // INCLUDE_EASYMATHLIB_VARINT_H_INCLUDED
@@ -423,6 +423,22 @@ namespace easyParse
         /// @brief get arg[0], invoking command.
         inline std::string_view arg0() const noexcept { return argv_[0]; }
 
+        /**
+         * @brief Parse command line arguments set. and populate all switch state and positional argument list,
+         * without throwing.
+         * 
+         * Errors (offset is the index in `argv` of the offending argument):
+         * - `INVALID_SWITCH` : If only '-' is an argument.
+         * - `UNKNOWN_SWITCH` : If switch after `-` is not configured (added).
+         * - `MISSING_SWITCH_ARGUMENT` : If after long boolean or option switch an argument is not present.
+         * - `INVALID_SWITCH_ARGUMENT` : If after long boolean or option switch invalid value provided.
+         * 
+         * Arguments before the offending one are applied.
+         * 
+         * @return ParseResult<void> success or error.
+         */
+        [[nodiscard]] ParseResult<void> tryParse();
+
         /**
          * @brief Parse command line arguments set. and populate all switch state and positional argument list.
          * 
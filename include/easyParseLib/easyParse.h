@@ -33,9 +33,17 @@
 #include <cstdint>
 #include <string>
 #include <stdexcept>
+#include <optional>
+#include <cstring>
+#include <bit>
+#include <type_traits>
+#include <utility>
+#include <concepts>
 
 #include <easyLib/version.h>
 #include <easyMathLib/easyMath.h>
+#include <easyMathLib/simdSupport.h>
+#include <easyMathLib/byteOrder.h>
 
 /// @brief encapsulate parser library code.
 namespace easyParse
@@ -44,6 +52,187 @@ namespace easyParse
     /// @brief Namespace to store meta information, like version.
     namespace meta = easyLib::meta;
 
+    /// @brief Failure reported by the non throwing (`try*`) parse functions.
+    enum class ParseErrorCode : std::uint8_t
+    {
+        /// @brief Empty string, or nothing left to advance over.
+        EMPTY_STRING,
+
+        /// @brief Number string holding only '-'.
+        SIGN_ONLY,
+
+        /// @brief Character that is not a digit of the base in use.
+        INVALID_DIGIT,
+
+        /// @brief Value not representable in the destination type.
+        OUT_OF_RANGE,
+
+        /// @brief Escape sequence not starting with '\'.
+        NOT_ESCAPED,
+
+        /// @brief Escape sequence without a value (eg: "\x" at the end of a string).
+        MISSING_ESCAPE_VALUE,
+
+        /// @brief Argument '-' alone.
+        INVALID_SWITCH,
+
+        /// @brief Switch not configured.
+        UNKNOWN_SWITCH,
+
+        /// @brief Long switch expecting an argument is the last argument.
+        MISSING_SWITCH_ARGUMENT,
+
+        /// @brief Argument not accepted by the switch.
+        INVALID_SWITCH_ARGUMENT
+    };
+
+    /**
+     * @brief Description of `code`, message of the exceptions thrown by the throwing parse functions.
+     *
+     * @param[in] code error code.
+     * @return std::string_view description.
+     */
+    [[nodiscard]] constexpr inline std::string_view parseErrorMessage(ParseErrorCode code) noexcept
+    {
+        switch(code)
+        {
+        case ParseErrorCode::EMPTY_STRING:              return "empty string";
+        case ParseErrorCode::SIGN_ONLY:                 return "string with - only";
+        case ParseErrorCode::INVALID_DIGIT:             return "Invalid characters in number string";
+        case ParseErrorCode::OUT_OF_RANGE:              return "Number string out of range of type";
+        case ParseErrorCode::NOT_ESCAPED:               return "Expected escaped string starting with \\";
+        case ParseErrorCode::MISSING_ESCAPE_VALUE:      return "Expected value after escape sequence";
+        case ParseErrorCode::INVALID_SWITCH:            return "'-' is not a valid argument";
+        case ParseErrorCode::UNKNOWN_SWITCH:            return "Unknown Switch";
+        case ParseErrorCode::MISSING_SWITCH_ARGUMENT:   return "Long switch must have an argument";
+        case ParseErrorCode::INVALID_SWITCH_ARGUMENT:   return "Invalid argument to switch";
+        default:                                        return "Unknown parse error";
+        }
+    }
+
+    /// @brief Error code and location of a failed parse.
+    struct ParseError
+    {
+        /// @brief What failed.
+        ParseErrorCode code;
+
+        /// @brief Offset of the offending character in the input string (argument index for `ArgParser`).
+        std::size_t offset;
+
+        /// @brief Member wise equality.
+        [[nodiscard]] friend constexpr bool operator == (const ParseError&, const ParseError&) noexcept = default;
+
+        /**
+         * @brief Throw the exception the throwing parse functions report this error with.
+         *
+         * @throw (1) `std::out_of_range` : `OUT_OF_RANGE`.
+         * @throw (2) `std::invalid_argument` : any other code.
+         */
+        [[noreturn]] inline void raise() const
+        {
+            std::string message = std::string(parseErrorMessage(code)) + " at offset " + std::to_string(offset);
+
+            if(code == ParseErrorCode::OUT_OF_RANGE)
+                throw std::out_of_range(message);
+            else
+                throw std::invalid_argument(message);
+        }
+    };
+
+    /**
+     * @brief Value or `ParseError` returned by the non throwing parse functions (a `std::expected` subset).
+     *
+     * Errors are plain return values, malformed input costs the same as well formed input.
+     *
+     * @tparam T value type, default constructible.
+     */
+    template<class T>
+    class ParseResult
+    {
+        /// @brief Value, valid if `hasValue_`.
+        T value_{};
+
+        /// @brief Error, valid if `!hasValue_`.
+        ParseError error_{};
+
+        /// @brief Whether the parse succeeded.
+        bool hasValue_;
+
+    public:
+
+        /// @brief Successful result holding `value`.
+        constexpr ParseResult(T value) noexcept(std::is_nothrow_move_constructible_v<T>) : value_(std::move(value)), hasValue_(true) {}
+
+        /// @brief Failed result holding `error`.
+        constexpr ParseResult(ParseError error) noexcept(std::is_nothrow_default_constructible_v<T>) : error_(error), hasValue_(false) {}
+
+        /// @brief Whether the parse succeeded.
+        [[nodiscard]] constexpr bool hasValue() const noexcept { return hasValue_; }
+
+        /// @brief Whether the parse succeeded.
+        [[nodiscard]] constexpr explicit operator bool() const noexcept { return hasValue_; }
+
+        /// @brief Value, requires `hasValue()`.
+        [[nodiscard]] constexpr const T& operator * () const noexcept { return value_; }
+
+        /// @brief Value member access, requires `hasValue()`.
+        [[nodiscard]] constexpr const T* operator -> () const noexcept { return &value_; }
+
+        /// @brief Error, requires `!hasValue()`.
+        [[nodiscard]] constexpr const ParseError& error() const noexcept { return error_; }
+
+        /**
+         * @brief Value, or throw the error (see `ParseError::raise`).
+         *
+         * @return const T& value.
+         */
+        [[nodiscard]] constexpr const T& value() const
+        {
+            if(!hasValue_)
+                error_.raise();
+
+            return value_;
+        }
+
+        /// @brief Value, or `fallback` on failure.
+        [[nodiscard]] constexpr T valueOr(T fallback) const { return hasValue_ ? value_ : fallback; }
+    };
+
+    /// @brief Success or `ParseError` of a parse producing no value.
+    template<>
+    class ParseResult<void>
+    {
+        /// @brief Error, valid if `!hasValue_`.
+        ParseError error_{};
+
+        /// @brief Whether the parse succeeded.
+        bool hasValue_;
+
+    public:
+
+        /// @brief Successful result.
+        constexpr ParseResult() noexcept : hasValue_(true) {}
+
+        /// @brief Failed result holding `error`.
+        constexpr ParseResult(ParseError error) noexcept : error_(error), hasValue_(false) {}
+
+        /// @brief Whether the parse succeeded.
+        [[nodiscard]] constexpr bool hasValue() const noexcept { return hasValue_; }
+
+        /// @brief Whether the parse succeeded.
+        [[nodiscard]] constexpr explicit operator bool() const noexcept { return hasValue_; }
+
+        /// @brief Error, requires `!hasValue()`.
+        [[nodiscard]] constexpr const ParseError& error() const noexcept { return error_; }
+
+        /// @brief Throw the error if the parse failed (see `ParseError::raise`).
+        constexpr void value() const
+        {
+            if(!hasValue_)
+                error_.raise();
+        }
+    };
+
     /**
      * @brief Convert hex character to numeric value.
      * 
@@ -103,11 +292,598 @@ namespace easyParse
         return easyMath::valueBetweenInclusive<char>(ch, '0', '9');
     }
 
+    namespace impl_detail_
+    {
+        /**
+         * @brief Offset of the first character in `digits` that is not a digit of `base`,
+         * locates the failure once validation has failed.
+         *
+         * @tparam base 2, 8, 10 or 16.
+         * @param[in] digits digit string.
+         * @return std::size_t offset, `digits.size()` if every character is a digit.
+         */
+        template<unsigned base>
+        [[nodiscard]] constexpr inline std::size_t firstInvalidDigit_(std::string_view digits) noexcept
+        {
+            for(std::size_t i = 0; i < digits.size(); ++i)
+            {
+                bool isDigit = false;
+
+                if constexpr (base == 16)
+                    isDigit = isHexDigit(digits[i]);
+                else if constexpr (base == 10)
+                    isDigit = isDecDigit(digits[i]);
+                else if constexpr (base == 8)
+                    isDigit = isOctalDigit(digits[i]);
+                else
+                    isDigit = (digits[i] == '0') || (digits[i] == '1');
+
+                if(!isDigit)
+                    return i;
+            }
+
+            return digits.size();
+        }
+
+        /// @brief Shortest string validated by the vector kernels, shorter strings take the scalar loop.
+        inline constexpr std::size_t VECTOR_VALIDATE_MIN_SIZE_ = 16;
+
+#if defined(EASY_MATH_DISPATCH_SSE4_2)
+
+        /**
+         * @brief Mark digits of `base` in 16 characters, 0xff lanes are valid.
+         *
+         * Digits are classified with one unsigned range compare, `(ch - '0') <= base - 1`,
+         * hex letters fold case with `ch | 0x20` and compare `(ch - 'a') <= 5`.
+         *
+         * @tparam base 2, 8, 10 or 16.
+         * @param[in] block characters.
+         * @return __m128i byte mask of valid characters.
+         */
+        template<unsigned base>
+        [[nodiscard]] EASY_MATH_TARGET_SSE4_2 inline __m128i sse4DigitMask_(__m128i block) noexcept
+        {
+            const __m128i digit = _mm_sub_epi8(block, _mm_set1_epi8('0'));
+            __m128i valid = _mm_cmpeq_epi8(_mm_min_epu8(digit, _mm_set1_epi8(static_cast<char>(std::min(base, 10u) - 1))), digit);
+
+            if constexpr (base == 16)
+            {
+                const __m128i letter = _mm_sub_epi8(_mm_or_si128(block, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+                valid = _mm_or_si128(valid, _mm_cmpeq_epi8(_mm_min_epu8(letter, _mm_set1_epi8(5)), letter));
+            }
+
+            return valid;
+        }
+
+        /**
+         * @brief SSE4.2 digit validation, 16 characters per step.
+         *
+         * The last block is loaded at `size - 16`, overlapping already validated characters,
+         * so no byte outside the string is read.
+         *
+         * @tparam base 2, 8, 10 or 16.
+         * @param[in] digits characters, requires `size >= 16`.
+         * @param[in] size number of characters.
+         * @return bool true if every character is a digit of `base`.
+         */
+        template<unsigned base>
+        [[nodiscard]] EASY_MATH_TARGET_SSE4_2 inline bool sse4ValidDigits_(const char* digits, std::size_t size) noexcept
+        {
+            for(std::size_t i = 0; i < size; i += 16)
+            {
+                auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(digits + std::min(i, size - 16)));
+
+                if(_mm_movemask_epi8(sse4DigitMask_<base>(block)) != 0xffff)
+                    return false;
+            }
+
+            return true;
+        }
+
+#endif
+
+#if defined(EASY_MATH_DISPATCH_AVX2)
+
+        /**
+         * @brief Mark digits of `base` in 32 characters, see `sse4DigitMask_`.
+         *
+         * @tparam base 2, 8, 10 or 16.
+         * @param[in] block characters.
+         * @return __m256i byte mask of valid characters.
+         */
+        template<unsigned base>
+        [[nodiscard]] EASY_MATH_TARGET_AVX2 inline __m256i avx2DigitMask_(__m256i block) noexcept
+        {
+            const __m256i digit = _mm256_sub_epi8(block, _mm256_set1_epi8('0'));
+            __m256i valid = _mm256_cmpeq_epi8(_mm256_min_epu8(digit, _mm256_set1_epi8(static_cast<char>(std::min(base, 10u) - 1))), digit);
+
+            if constexpr (base == 16)
+            {
+                const __m256i letter = _mm256_sub_epi8(_mm256_or_si256(block, _mm256_set1_epi8(0x20)), _mm256_set1_epi8('a'));
+                valid = _mm256_or_si256(valid, _mm256_cmpeq_epi8(_mm256_min_epu8(letter, _mm256_set1_epi8(5)), letter));
+            }
+
+            return valid;
+        }
+
+        /**
+         * @brief AVX2 digit validation, 32 characters per step, last block overlaps (see `sse4ValidDigits_`).
+         *
+         * @tparam base 2, 8, 10 or 16.
+         * @param[in] digits characters, requires `size >= 32`.
+         * @param[in] size number of characters.
+         * @return bool true if every character is a digit of `base`.
+         */
+        template<unsigned base>
+        [[nodiscard]] EASY_MATH_TARGET_AVX2 inline bool avx2ValidDigits_(const char* digits, std::size_t size) noexcept
+        {
+            for(std::size_t i = 0; i < size; i += 32)
+            {
+                auto block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(digits + std::min(i, size - 32)));
+
+                if(_mm256_movemask_epi8(avx2DigitMask_<base>(block)) != -1)
+                    return false;
+            }
+
+            return true;
+        }
+
+#endif
+
+#if defined(EASY_MATH_DISPATCH_AVX512BW)
+
+        /**
+         * @brief AVX-512 BW digit validation, 64 characters per step.
+         *
+         * The tail is read with a masked load, masked off bytes are never accessed.
+         *
+         * @tparam base 2, 8, 10 or 16.
+         * @param[in] digits characters.
+         * @param[in] size number of characters.
+         * @return bool true if every character is a digit of `base`.
+         */
+        template<unsigned base>
+        [[nodiscard]] EASY_MATH_TARGET_AVX512BW inline bool avx512ValidDigits_(const char* digits, std::size_t size) noexcept
+        {
+            const __m512i zero = _mm512_set1_epi8('0');
+            const __m512i lastDigit = _mm512_set1_epi8(static_cast<char>(std::min(base, 10u) - 1));
+
+            for(std::size_t i = 0; i < size; i += 64)
+            {
+                __mmask64 load = (size - i >= 64) ? ~__mmask64{0} : ((__mmask64{1} << (size - i)) - 1);
+                __m512i block = _mm512_maskz_loadu_epi8(load, digits + i);
+
+                __mmask64 valid = _mm512_mask_cmple_epu8_mask(load, _mm512_sub_epi8(block, zero), lastDigit);
+
+                if constexpr (base == 16)
+                {
+                    const __m512i letter = _mm512_sub_epi8(_mm512_or_si512(block, _mm512_set1_epi8(0x20)), _mm512_set1_epi8('a'));
+                    valid |= _mm512_mask_cmple_epu8_mask(load, letter, _mm512_set1_epi8(5));
+                }
+
+                if(valid != load)
+                    return false;
+            }
+
+            return true;
+        }
+
+#endif
+
+        /**
+         * @brief Validate digits of `base` with the widest kernel the host runs.
+         *
+         * @tparam base 2, 8, 10 or 16.
+         * @param[in] numberString string to validate.
+         * @return std::optional<bool> validity, empty if no kernel applies (short string, scalar tier),
+         *      the caller then takes the scalar loop.
+         */
+        template<unsigned base>
+        [[nodiscard]] inline std::optional<bool> vectorValidateDigits_(std::string_view numberString) noexcept
+        {
+            if(numberString.size() < VECTOR_VALIDATE_MIN_SIZE_)
+                return std::nullopt;
+
+#if defined(EASY_MATH_DISPATCH_AVX512BW)
+            if(easyMath::impl_detail_::useAvx512_())
+                return avx512ValidDigits_<base>(numberString.data(), numberString.size());
+#endif
+#if defined(EASY_MATH_DISPATCH_AVX2)
+            if((numberString.size() >= 32) && easyMath::impl_detail_::useAvx2_())
+                return avx2ValidDigits_<base>(numberString.data(), numberString.size());
+#endif
+#if defined(EASY_MATH_DISPATCH_SSE4_2)
+            if(easyMath::impl_detail_::useSse42_())
+                return sse4ValidDigits_<base>(numberString.data(), numberString.size());
+#endif
+
+            return std::nullopt;
+        }
+
+        /**
+         * @brief `value * scale + block` in the wrapping arithmetic of `Integer`.
+         *
+         * Builtin types narrower than 64 bits are evaluated in `std::uint64_t` (avoids signed
+         * overflow after integer promotion), the truncation is the same modulo `2^bitSize`.
+         *
+         * @tparam Integer Type to store data.
+         * @param[in] value accumulated value.
+         * @param[in] scale power of 10 of the block.
+         * @param[in] block value of the block.
+         * @return Integer `value * scale + block`.
+         */
+        template<easyMath::UnsignedIntegral Integer>
+        [[nodiscard]] constexpr inline Integer decimalScaleAdd_(Integer value, std::uint64_t scale, std::uint64_t block) noexcept
+        {
+            if constexpr (std::unsigned_integral<Integer> && (sizeof(Integer) <= sizeof(std::uint64_t)))
+                return static_cast<Integer>(static_cast<std::uint64_t>(value) * scale + block);
+            else
+            {
+                value *= static_cast<Integer>(scale);
+                value += static_cast<Integer>(block);
+                return value;
+            }
+        }
+
+        /**
+         * @brief Load the first 8 characters of `digits` into a word, first character in the lowest byte.
+         *
+         * @param[in] digits string of at least 8 characters.
+         * @return std::uint64_t loaded word.
+         */
+        [[nodiscard]] constexpr inline std::uint64_t loadWord_(std::string_view digits) noexcept
+        {
+            std::uint64_t word = 0;
+
+            if(!std::is_constant_evaluated() && (std::endian::native == std::endian::little))
+                std::memcpy(&word, digits.data(), sizeof(word));
+            else
+            {
+                for(std::size_t i = 0; i < 8; ++i)
+                    word |= static_cast<std::uint64_t>(static_cast<unsigned char>(digits[i])) << (8 * i);
+            }
+
+            return word;
+        }
+
+        /**
+         * @brief SWAR conversion of 8 decimal digits held in one 64 bit word.
+         *
+         * Checks all 8 characters are '0' - '9' (a non digit byte sets the high bit of
+         * `byte + 0x46` or of `byte - 0x30`), then combines digit pairs, quads and the two
+         * halves with 3 multiplies.
+         *
+         * @param[in] digits string of at least 8 characters, first 8 are converted.
+         * @param[out] value converted value, if the characters are digits.
+         * @return bool true if the 8 characters are decimal digits.
+         */
+        [[nodiscard]] constexpr inline bool swarDecimal8_(std::string_view digits, std::uint64_t& value) noexcept
+        {
+            std::uint64_t word = loadWord_(digits);
+
+            if((((word + 0x4646464646464646ull) | (word - 0x3030303030303030ull)) & 0x8080808080808080ull) != 0)
+                return false;
+
+            word -= 0x3030303030303030ull;
+            word = (word * 10) + (word >> 8);
+            value = (((word & 0x000000ff000000ffull) * (100 + (1000000ull << 32)))
+                + (((word >> 16) & 0x000000ff000000ffull) * (1 + (10000ull << 32)))) >> 32;
+
+            return true;
+        }
+
+#if defined(EASY_MATH_DISPATCH_SSE4_2)
+
+        /**
+         * @brief SSE4.2 conversion of 16 decimal digits.
+         *
+         * `pmaddubsw` combines digit pairs, `pmaddwd` pairs into quads, and after packing
+         * to 16 bits `pmaddwd` quads into two 8 digit halves.
+         *
+         * @param[in] digits at least 16 characters, first 16 are converted.
+         * @param[out] value converted value, if the characters are digits.
+         * @return bool true if the 16 characters are decimal digits.
+         */
+        [[nodiscard]] EASY_MATH_TARGET_SSE4_2 inline bool sse4Decimal16_(const char* digits, std::uint64_t& value) noexcept
+        {
+            const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(digits));
+
+            if(_mm_movemask_epi8(sse4DigitMask_<10>(block)) != 0xffff)
+                return false;
+
+            const __m128i pairs = _mm_maddubs_epi16(_mm_sub_epi8(block, _mm_set1_epi8('0')), _mm_set1_epi16(0x010a));
+            const __m128i quads = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00010064));
+            const __m128i halves = _mm_madd_epi16(_mm_packus_epi32(quads, quads), _mm_set1_epi32(0x00012710));
+
+            value = static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm_cvtsi128_si32(halves))) * 100000000ull
+                + static_cast<std::uint32_t>(_mm_extract_epi32(halves, 1));
+
+            return true;
+        }
+
+#endif
+
+        /**
+         * @brief Convert the leading whole blocks of decimal digits, 16 (SSE4.2) or 8 (SWAR) at a time.
+         *
+         * Stops at the first block holding a non digit, the caller converts the rest one digit at a time.
+         *
+         * @tparam Integer Type to store data.
+         * @param[in] numberString decimal string.
+         * @param[inout] value accumulated value, blocks are folded in.
+         * @return std::size_t number of characters converted.
+         */
+        template<easyMath::UnsignedIntegral Integer>
+        [[nodiscard]] constexpr inline std::size_t convertDecimalBlocks_(std::string_view numberString, Integer& value) noexcept
+        {
+            std::size_t i = 0;
+            std::uint64_t block = 0;
+
+#if defined(EASY_MATH_DISPATCH_SSE4_2)
+            if(!std::is_constant_evaluated() && (numberString.size() >= 16) && easyMath::impl_detail_::useSse42_())
+            {
+                for(; (i + 16 <= numberString.size()) && sse4Decimal16_(numberString.data() + i, block); i += 16)
+                    value = decimalScaleAdd_(value, 10000000000000000ull, block);
+            }
+#endif
+
+            for(; (i + 8 <= numberString.size()) && swarDecimal8_(numberString.substr(i), block); i += 8)
+                value = decimalScaleAdd_(value, 100000000ull, block);
+
+            return i;
+        }
+
+        /**
+         * @brief `(value << bits) + block` in the wrapping arithmetic of `Integer`, no shift by the full width.
+         *
+         * @tparam Integer Type to store data.
+         * @param[in] value accumulated value.
+         * @param[in] bits bit size of the block.
+         * @param[in] block value of the block.
+         * @return Integer `(value << bits) + block`.
+         */
+        template<easyMath::UnsignedIntegral Integer>
+        [[nodiscard]] constexpr inline Integer shiftInBlock_(Integer value, std::size_t bits, std::uint64_t block) noexcept
+        {
+            if(bits >= easyMath::bitSize<Integer>())
+                return static_cast<Integer>(block);
+
+            value = value << bits;
+            value += static_cast<Integer>(block);
+            return value;
+        }
+
+        /**
+         * @brief SWAR conversion of 8 base `2^perBitSize` digits held in one 64 bit word.
+         *
+         * - Binary: bytes equal to '1' are flagged exactly, a multiply gathers the 8 flags.
+         * - Octal: checked like `swarDecimal8_` against '0' - '7'.
+         * - Hex: each byte is range checked against '0' - '9', 'A' - 'F', 'a' - 'f'
+         *   (on the low 7 bits, no carry crosses bytes), letters are `(ch & 0xf) + 9`.
+         *
+         * Digits are then merged pairwise, first digit most significant, in 3 shift / or / mask steps.
+         *
+         * @tparam perBitSize 1 (binary, any character, '1' is one), 3 (octal) or 4 (hex).
+         * @tparam strictBinary binary characters other than '0' / '1' are rejected.
+         * @param[in] digits string of at least 8 characters, first 8 are converted.
+         * @param[out] value converted value, if the characters are digits.
+         * @return bool true if the 8 characters are digits of the base.
+         */
+        template<std::size_t perBitSize, bool strictBinary = false>
+        [[nodiscard]] constexpr inline bool swarPowerOfTwoDigits8_(std::string_view digits, std::uint64_t& value) noexcept
+        {
+            constexpr std::uint64_t ONES = 0x0101010101010101ull;
+            constexpr std::uint64_t HIGH = 0x8080808080808080ull;
+            constexpr std::uint64_t LOW_7 = 0x7f7f7f7f7f7f7f7full;
+
+            // first character in the highest byte.
+            std::uint64_t word = easyMath::byteSwap(loadWord_(digits));
+
+            if constexpr (perBitSize == 1)
+            {
+                if constexpr (strictBinary)
+                    if((word & ~ONES) != (ONES * '0'))
+                        return false;
+
+                std::uint64_t other = word ^ (ONES * '1');
+                std::uint64_t isOne = ~(((other & LOW_7) + LOW_7) | other) & HIGH;
+                value = ((isOne >> 7) * 0x0102040810204080ull) >> 56;
+                return true;
+            }
+            else
+            {
+                if constexpr (perBitSize == 3)
+                {
+                    if((((word + ONES * 0x48) | (word - ONES * '0')) & HIGH) != 0)
+                        return false;
+
+                    word -= ONES * '0';
+                }
+                else
+                {
+                    // high bit of byte set if the low 7 bits are at least `bound`.
+                    auto atLeast = [low = word & LOW_7](std::uint64_t bound) constexpr noexcept
+                    {
+                        return (low + ONES * (0x80 - bound)) & HIGH;
+                    };
+
+                    std::uint64_t valid = (atLeast('0') & ~atLeast('9' + 1))
+                        | (atLeast('A') & ~atLeast('F' + 1))
+                        | (atLeast('a') & ~atLeast('f' + 1));
+
+                    if((valid & ~word) != HIGH)
+                        return false;
+
+                    word = (word & (ONES * 0x0f)) + ((word >> 6) & ONES) * 9;
+                }
+
+                constexpr std::uint64_t PAIR_MASK = ONES * ((1ull << (2 * perBitSize)) - 1) & 0x00ff00ff00ff00ffull;
+                constexpr std::uint64_t QUAD_MASK = (1ull << (4 * perBitSize)) - 1;
+
+                word = (word | (word >> (8 - perBitSize))) & PAIR_MASK;
+                word = (word | (word >> (16 - 2 * perBitSize))) & (QUAD_MASK | (QUAD_MASK << 32));
+                value = (word | (word >> (32 - 4 * perBitSize))) & ((1ull << (8 * perBitSize)) - 1);
+                return true;
+            }
+        }
+
+#if defined(EASY_MATH_DISPATCH_SSE4_2)
+
+        /**
+         * @brief SSE4.2 conversion of 16 base `2^perBitSize` digits.
+         *
+         * - Binary: `pcmpeqb` with '1' on the byte reversed block, `pmovmskb` is the value.
+         * - Octal: `pmaddubsw` / `pmaddwd` / `packusdw` / `pmaddwd` merge 2, 4, 8 digits like `sse4Decimal16_`.
+         * - Hex: `pmaddubsw` merges digit pairs into bytes, `pshufb` gathers the bytes most significant first.
+         *
+         * @tparam perBitSize 1 (binary, any character), 3 (octal) or 4 (hex).
+         * @tparam strictBinary binary characters other than '0' / '1' are rejected.
+         * @param[in] digits at least 16 characters, first 16 are converted.
+         * @param[out] value converted value, if the characters are digits.
+         * @return bool true if the 16 characters are digits of the base.
+         */
+        template<std::size_t perBitSize, bool strictBinary = false>
+        [[nodiscard]] EASY_MATH_TARGET_SSE4_2 inline bool sse4PowerOfTwoDigits16_(const char* digits, std::uint64_t& value) noexcept
+        {
+            const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(digits));
+
+            if constexpr (perBitSize == 1)
+            {
+                if constexpr (strictBinary)
+                    if(_mm_movemask_epi8(sse4DigitMask_<2>(block)) != 0xffff)
+                        return false;
+
+                const __m128i reversed = _mm_shuffle_epi8(block,
+                    _mm_load_si128(reinterpret_cast<const __m128i*>(easyMath::impl_detail_::BYTE_REVERSE_SHUFFLE_<16>.data())));
+                value = static_cast<std::uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(reversed, _mm_set1_epi8('1'))));
+                return true;
+            }
+            else
+            {
+                if(_mm_movemask_epi8(sse4DigitMask_<(1u << perBitSize)>(block)) != 0xffff)
+                    return false;
+
+                if constexpr (perBitSize == 3)
+                {
+                    const __m128i pairs = _mm_maddubs_epi16(_mm_sub_epi8(block, _mm_set1_epi8('0')), _mm_set1_epi16(0x0108));
+                    const __m128i quads = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00010040));
+                    const __m128i halves = _mm_madd_epi16(_mm_packus_epi32(quads, quads), _mm_set1_epi32(0x00011000));
+
+                    value = (static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm_cvtsi128_si32(halves))) << 24)
+                        | static_cast<std::uint32_t>(_mm_extract_epi32(halves, 1));
+                }
+                else
+                {
+                    // letters ('A' - 'F', 'a' - 'f' are above '9') are (ch & 0xf) + 9.
+                    const __m128i letters = _mm_and_si128(_mm_cmpgt_epi8(block, _mm_set1_epi8('9')), _mm_set1_epi8(9));
+                    const __m128i nibbles = _mm_add_epi8(_mm_and_si128(block, _mm_set1_epi8(0x0f)), letters);
+                    const __m128i pairs = _mm_maddubs_epi16(nibbles, _mm_set1_epi16(0x0110));
+                    const __m128i bytes = _mm_shuffle_epi8(pairs, _mm_set_epi8(-1, -1, -1, -1, -1, -1, -1, -1, 0, 2, 4, 6, 8, 10, 12, 14));
+
+                    value = static_cast<std::uint64_t>(_mm_cvtsi128_si64(bytes));
+                }
+
+                return true;
+            }
+        }
+
+#endif
+
+#if defined(EASY_MATH_DISPATCH_AVX2)
+
+        /**
+         * @brief AVX2 conversion of 32 binary digits ('1' is one, any other character zero).
+         *
+         * @param[in] digits at least 32 characters, first 32 are converted.
+         * @return std::uint64_t converted value, first character most significant.
+         */
+        [[nodiscard]] EASY_MATH_TARGET_AVX2 inline std::uint64_t avx2Binary32_(const char* digits) noexcept
+        {
+            __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(digits));
+            block = _mm256_shuffle_epi8(block,
+                _mm256_load_si256(reinterpret_cast<const __m256i*>(easyMath::impl_detail_::BYTE_REVERSE_SHUFFLE_<16>.data())));
+            block = _mm256_permute4x64_epi64(block, 0x4e);
+
+            return static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, _mm256_set1_epi8('1'))));
+        }
+
+#endif
+
+#if defined(EASY_MATH_DISPATCH_AVX512BW)
+
+        /**
+         * @brief AVX-512 BW conversion of 64 binary digits ('1' is one, any other character zero).
+         *
+         * @param[in] digits at least 64 characters, first 64 are converted.
+         * @return std::uint64_t converted value, first character most significant.
+         */
+        [[nodiscard]] EASY_MATH_TARGET_AVX512BW inline std::uint64_t avx512Binary64_(const char* digits) noexcept
+        {
+            __m512i block = _mm512_loadu_si512(digits);
+            block = _mm512_shuffle_epi8(block, _mm512_load_si512(easyMath::impl_detail_::BYTE_REVERSE_SHUFFLE_<16>.data()));
+            // full mask zeroing form, the unmasked one merges into an undefined register (-Wmaybe-uninitialized).
+            block = _mm512_maskz_shuffle_i64x2(0xff, block, block, 0x1b);
+
+            return _mm512_cmpeq_epi8_mask(block, _mm512_set1_epi8('1'));
+        }
+
+#endif
+
+        /**
+         * @brief Convert the leading whole blocks of base `2^perBitSize` digits, with the widest kernel the host runs.
+         *
+         * Stops at the first block holding a non digit, the caller converts the rest one digit at a time.
+         *
+         * @tparam Integer Type to store data.
+         * @tparam perBitSize 1 (binary), 3 (octal) or 4 (hex).
+         * @tparam strictBinary binary blocks holding characters other than '0' / '1' also stop the conversion.
+         * @param[in] numberString number string.
+         * @param[inout] value accumulated value, blocks are shifted in.
+         * @return std::size_t number of characters converted.
+         */
+        template<easyMath::UnsignedIntegral Integer, std::size_t perBitSize, bool strictBinary = false>
+        [[nodiscard]] constexpr inline std::size_t convertPowerOfTwoBlocks_(std::string_view numberString, Integer& value) noexcept
+        {
+            std::size_t i = 0;
+            std::uint64_t block = 0;
+
+            if(!std::is_constant_evaluated() && (numberString.size() >= 16))
+            {
+#if defined(EASY_MATH_DISPATCH_AVX512BW)
+                if constexpr ((perBitSize == 1) && !strictBinary)
+                    if(easyMath::impl_detail_::useAvx512_())
+                        for(; i + 64 <= numberString.size(); i += 64)
+                            value = shiftInBlock_(value, 64, avx512Binary64_(numberString.data() + i));
+#endif
+#if defined(EASY_MATH_DISPATCH_AVX2)
+                if constexpr ((perBitSize == 1) && !strictBinary)
+                    if(easyMath::impl_detail_::useAvx2_())
+                        for(; i + 32 <= numberString.size(); i += 32)
+                            value = shiftInBlock_(value, 32, avx2Binary32_(numberString.data() + i));
+#endif
+#if defined(EASY_MATH_DISPATCH_SSE4_2)
+                if(easyMath::impl_detail_::useSse42_())
+                {
+                    for(; (i + 16 <= numberString.size()) && sse4PowerOfTwoDigits16_<perBitSize, strictBinary>(numberString.data() + i, block); i += 16)
+                        value = shiftInBlock_(value, 16 * perBitSize, block);
+                }
+#endif
+            }
+
+            for(; (i + 8 <= numberString.size()) && swarPowerOfTwoDigits8_<perBitSize, strictBinary>(numberString.substr(i), block); i += 8)
+                value = shiftInBlock_(value, 8 * perBitSize, block);
+
+            return i;
+        }
+    }
+
     /**
      * @brief Convert binary number stream to unsigned integer.
      * 
      * Convert `min(bitSize(Integer), numberString.size())` number of digits to unsigned integer.
      * 
+     * Converts 8 digits per step (SWAR), 16 / 32 / 64 per step at runtime on SSE4.2 / AVX2 / AVX-512 hosts.
+     * 
      * @tparam Integer Return type.
      * @param[in] numberString number string.
      * @return Integer Converted integer
@@ -125,8 +901,9 @@ namespace easyParse
         Integer ret = 0ull;
 
         auto size = std::min(easyMath::bitSize<Integer>(), numberString.size());
+        numberString = numberString.substr(numberString.size() - size);
 
-        for(std::size_t i = (numberString.size() - size); i < numberString.size(); ++i)
+        for(std::size_t i = impl_detail_::convertPowerOfTwoBlocks_<Integer, 1>(numberString, ret); i < numberString.size(); ++i)
         {
             ret = ret << 1;
             ret |= (numberString[i] == '1' ? 1 : 0);
@@ -177,6 +954,9 @@ namespace easyParse
         /**
          * @brief Convert Digits of number string composed of digits of base 2^n where n is an integer.
          * 
+         * Leading blocks of valid octal / hex digits are converted 8 (SWAR) or 16 (SSE4.2) at a time,
+         * see `convertPowerOfTwoBlocks_`.
+         * 
          * @tparam Integer Type to store data.
          * @tparam perBitSize size of each digit in bits.
          * @param[inout] numberString number string, consumed digits are erased from string.
@@ -194,7 +974,7 @@ namespace easyParse
         {
             Integer ret = 0ull;
 
-            for(auto digit : numberString)
+            for(auto digit : numberString.substr(convertPowerOfTwoBlocks_<Integer, perBitSize>(numberString, ret)))
             {
                 ret = ret << perBitSize;
                 ret += convertDigit_<perBitSize>(digit);
@@ -251,6 +1031,9 @@ namespace easyParse
     /**
      * @brief Convert a decimal number string to unsigned integral format.
      * 
+     * Converts 8 digits per step with SWAR multiply-adds (16 per step with SSE4.2 at runtime),
+     * the remaining digits one at a time. Wraps modulo `2^bitSize<Integer>()` like the digit loop.
+     * 
      * @tparam Integer Type to store data.
      * @param[in] numberString decimal string.
      * @return Integer Converted Integer.
@@ -267,7 +1050,7 @@ namespace easyParse
     {
         Integer ret = 0ull;
 
-        for(auto digit : numberString)
+        for(auto digit : numberString.substr(impl_detail_::convertDecimalBlocks_(numberString, ret)))
         {
             ret *= 10;
             ret += digitConverter(digit);
@@ -391,10 +1174,17 @@ namespace easyParse
      * 
      * Allows: '0' - '9', 'a' - 'f', 'A' - 'F'.
      * 
+     * Strings of 16 or more characters are classified 16 / 32 / 64 at a time at runtime
+     * on SSE4.2 / AVX2 / AVX-512 hosts (see easyLib/cpuDispatch.h), same result as the scalar loop.
+     * 
      * @param[in] numberString string to validate.
      */
     [[nodiscard]] constexpr inline bool validateHexString(std::string_view numberString) noexcept
     {
+        if(!std::is_constant_evaluated())
+            if(auto valid = impl_detail_::vectorValidateDigits_<16>(numberString))
+                return *valid;
+
         for(auto digit : numberString)
         {
             auto isDigit = easyMath::valueBetweenInclusive(digit, '0', '9')
@@ -413,10 +1203,16 @@ namespace easyParse
      * 
      * Allows: '0' - '7'.
      * 
+     * Vectorised like `validateHexString`.
+     * 
      * @param[in] numberString string to validate.
      */
     [[nodiscard]] constexpr inline bool validateOctString(std::string_view numberString) noexcept
     {
+        if(!std::is_constant_evaluated())
+            if(auto valid = impl_detail_::vectorValidateDigits_<8>(numberString))
+                return *valid;
+
         for(auto digit : numberString)
         {
             auto isDigit = easyMath::valueBetweenInclusive(digit, '0', '7');
@@ -433,10 +1229,16 @@ namespace easyParse
      * 
      * Allows: '0' - '9'.
      * 
+     * Vectorised like `validateHexString`.
+     * 
      * @param[in] numberString string to validate.
      */
     [[nodiscard]] constexpr inline bool validateDecString(std::string_view numberString) noexcept
     {
+        if(!std::is_constant_evaluated())
+            if(auto valid = impl_detail_::vectorValidateDigits_<10>(numberString))
+                return *valid;
+
         for(auto digit : numberString)
         {
             auto isDigit = easyMath::valueBetweenInclusive(digit, '0', '9');
@@ -453,10 +1255,16 @@ namespace easyParse
      * 
      * Allows: '0', '1'.
      * 
+     * Vectorised like `validateHexString`.
+     * 
      * @param[in] numberString string to validate.
      */
     [[nodiscard]] constexpr inline bool validateBinString(std::string_view numberString) noexcept
     {
+        if(!std::is_constant_evaluated())
+            if(auto valid = impl_detail_::vectorValidateDigits_<2>(numberString))
+                return *valid;
+
         for(auto digit : numberString)
         {
             auto isDigit = (digit == '0') || (digit == '1');
@@ -471,24 +1279,32 @@ namespace easyParse
     
 
     /**
-     * @brief Convert escaped string to ascii characters.
+     * @brief Convert escaped string to ascii characters, without throwing.
      * 
-     * @throw (1) `std::invalid_argument`: If `escapedString` not begining with `'\'`.
-     * @throw (2) `std::invalid_argument`: If `escapedString` starts with \[x|X] and 
+     * Errors (offset in `escapedString`):
+     * - `EMPTY_STRING` : `escapedString` is empty.
+     * - `NOT_ESCAPED` : `escapedString` not begining with `'\'`.
+     * - `MISSING_ESCAPE_VALUE` : `escapedString` is `'\'` alone.
+     * - `INVALID_DIGIT` : `escapedString` starts with \[x|X] and 
      *  contains non hex digits, or starts with \[o|O] and 
      *  contains non octal digits, or starts with \ and 
      *  contains non decimal digits.
      * 
      * @param[in] escapedString escaped string to convert.
-     * @return char ascii character.
+     * @return ParseResult<char> ascii character or error.
      */
-    [[nodiscard]] constexpr inline char convertEscapedString(std::string_view escapedString)
+    [[nodiscard]] constexpr inline ParseResult<char> tryConvertEscapedString(std::string_view escapedString) noexcept
     {
+        if(escapedString.empty())
+            return ParseError{ParseErrorCode::EMPTY_STRING, 0};
+
         if(escapedString[0] != '\\')
-            throw std::invalid_argument("Expected escaped string starting with \\");
-        
-        auto iterator = escapedString.begin() + 1;
-        char ch = *iterator;
+            return ParseError{ParseErrorCode::NOT_ESCAPED, 0};
+
+        if(escapedString.size() == 1)
+            return ParseError{ParseErrorCode::MISSING_ESCAPE_VALUE, 1};
+
+        char ch = escapedString[1];
 
         switch (ch)
         {
@@ -508,7 +1324,7 @@ namespace easyParse
             {
                 escapedString = escapedString.substr(2);
                 if(!validateHexString(escapedString))
-                    throw std::invalid_argument("Escaped [x|X] is not followed by hex number string.");
+                    return ParseError{ParseErrorCode::INVALID_DIGIT, 2 + impl_detail_::firstInvalidDigit_<16>(escapedString)};
 
                 return static_cast<char>(convertHexString<std::uint8_t>(escapedString));
             }
@@ -518,7 +1334,7 @@ namespace easyParse
                 escapedString = escapedString.substr(2);
                 
                 if(!validateOctString(escapedString))
-                    throw std::invalid_argument("Escaped [o|O] is not followed by oct number string.");
+                    return ParseError{ParseErrorCode::INVALID_DIGIT, 2 + impl_detail_::firstInvalidDigit_<8>(escapedString)};
 
                 return static_cast<char>(convertOctString<std::uint8_t>(escapedString));
             }
@@ -527,12 +1343,100 @@ namespace easyParse
                 escapedString = escapedString.substr(1);
                 
                 if(!validateDecString(escapedString))
-                    throw std::invalid_argument("Escaped string is not decimal number string.");
+                    return ParseError{ParseErrorCode::INVALID_DIGIT, 1 + impl_detail_::firstInvalidDigit_<10>(escapedString)};
+
                 return static_cast<char>(convertDecimalString<std::uint8_t>(escapedString));
             }            
         }
     }
 
+    /**
+     * @brief Convert escaped string to ascii characters.
+     * 
+     * @throw (1) `std::invalid_argument`: If `escapedString` is empty, is `'\'` alone or not begining with `'\'`.
+     * @throw (2) `std::invalid_argument`: If `escapedString` starts with \[x|X] and 
+     *  contains non hex digits, or starts with \[o|O] and 
+     *  contains non octal digits, or starts with \ and 
+     *  contains non decimal digits.
+     * 
+     * @param[in] escapedString escaped string to convert.
+     * @return char ascii character.
+     */
+    [[nodiscard]] constexpr inline char convertEscapedString(std::string_view escapedString)
+    {
+        return tryConvertEscapedString(escapedString).value();
+    }
+
+    /**
+     * @brief Advance over text and convert escaped characters to characters, without throwing.
+     * 
+     * Same conversion as `advanceOverText`, `iterator` is left unchanged on error.
+     * 
+     * Errors (offset from `iterator`):
+     * - `EMPTY_STRING` : `iterator >= sentinel`.
+     * - `MISSING_ESCAPE_VALUE` : `"\x"` or `"\X"` at the end of the text.
+     * - see `tryConvertEscapedString`.
+     * 
+     * @param[inout] iterator iterator to start from.
+     * @param[in] sentinel iterator to one over last character.
+     * @return ParseResult<std::pair<char, bool>> character and whether it was escaped, or error.
+     */
+    [[nodiscard]] constexpr inline ParseResult<std::pair<char, bool>> tryAdvanceOverText(
+        std::string_view::const_iterator& iterator,
+        std::string_view::const_iterator sentinel
+    ) noexcept
+    {
+        if(iterator >= sentinel)
+            return ParseError{ParseErrorCode::EMPTY_STRING, 0};
+
+        auto begin = iterator;
+        auto current = iterator;
+        char ch = *current;
+        ++current;
+
+        if(ch != '\\')
+        {
+            iterator = current;
+            return std::pair<char, bool>{ch, false};
+        }
+
+        if(current >= sentinel)
+        {
+            iterator = current;
+            return std::pair<char, bool>{'\\', true};
+        }
+
+        ch = *current;
+        ++current;
+
+        switch (ch)
+        {
+        case 'x': [[fallthrough]];
+        case 'X':
+            if(current >= sentinel)
+                return ParseError{ParseErrorCode::MISSING_ESCAPE_VALUE, static_cast<std::size_t>(current - begin)};
+
+            while((current < sentinel) && isHexDigit(*current))
+                ++current;
+            break;
+        case 'o': [[fallthrough]];
+        case 'O':
+            while((current < sentinel) && isOctalDigit(*current))
+                ++current;
+            break;
+        default:
+            break;
+        }
+
+        auto converted = tryConvertEscapedString(std::string_view(begin, current));
+
+        if(!converted)
+            return converted.error();
+
+        iterator = current;
+        return std::pair<char, bool>{*converted, true};
+    }
+
     /**
      * @brief Advance over text and convert escaped characters to characters.
      * 
@@ -566,89 +1470,7 @@ namespace easyParse
         std::string_view::const_iterator sentinel
     )
     {
-        if(iterator >= sentinel)
-            throw std::invalid_argument("Empty String to advance over");
-
-        auto begin = iterator;
-        char ch = *iterator;
-        ++iterator;            
-
-        if(ch == '\\')
-        {
-            if(iterator < sentinel)
-            {
-                ch = *iterator;
-                ++iterator;
-                switch (ch)
-                {
-                case 'x': [[fallthrough]];
-                case 'X':
-                    {
-                        if(iterator >= sentinel)
-                            throw std::invalid_argument("Expected Value after \\[x,X]");
-
-                        auto hexBegin = iterator - 2;
-                        ch = *iterator;
-                        while (
-                            (iterator < sentinel)
-                            && (std::isxdigit(ch))
-                        )
-                        {
-                            ++iterator;
-                            if(iterator < sentinel)
-                                ch = *iterator;
-                            else 
-                                break;
-                        }
-
-                        return 
-                        {
-                            convertEscapedString(std::string_view(hexBegin, iterator)), 
-                            true
-                        };
-                    }
-                case 'o':  [[fallthrough]];
-                case 'O':
-                    {
-                        auto octBegin = iterator - 2;
-                        ch = *iterator;
-                        while (
-                            (iterator < sentinel)
-                            && (ch < '8') && (ch >= '0')
-                        )
-                        {
-                            ++iterator;
-                            if(iterator < sentinel)
-                                ch = *iterator;
-                            else 
-                                break;                          
-                        }
-
-                        return 
-                        {
-                            convertEscapedString(std::string_view(octBegin, iterator)), 
-                            true
-                        };
-                    }
-                default:
-                    auto singleBegin = iterator - 2;
-                    return 
-                    {
-                        convertEscapedString(std::string_view(singleBegin, iterator)),
-                        true
-                    };
-                }
-            }
-            else
-            {
-                return {'\\', true};
-            }
-            
-        }
-        else 
-        {
-            return {ch, false};
-        }
+        return tryAdvanceOverText(iterator, sentinel).value();
     }
 
     /**
@@ -767,72 +1589,72 @@ namespace easyParse
     [[nodiscard]] std::vector<std::string_view> extractNonText(std::string_view string);
 
     /**
-     * @brief Convert number string to integer.
+     * @brief Convert number string to integer, without throwing.
      * 
-     * Support for:
-     * - 0x or 0X prefix hex.
-     * - 0b or 0B prefix octal.
-     * - 0 prefix octal.
-     * - No prefix decimal
-     * - Negative numbers will produce 2's complement.
+     * Same conversion as `convertNumberString`.
      * 
-     * @throw (1) `std::invalid_argument` : Empty string or only '-' passed.
-     * @throw (2) `std::invalid_argument` : Invalid characters (non hex in a 0x string or non binary in 0b ...).
+     * Errors (offset in `numberString`):
+     * - `EMPTY_STRING` : Empty string.
+     * - `SIGN_ONLY` : Only '-' passed.
+     * - `INVALID_DIGIT` : Invalid characters (non hex in a 0x string or non binary in 0b ...).
      * 
      * @tparam UInteger Type of integer.
      * @param[in] numberString number string to convert.
-     * @return UInteger Converted integer.
-     * 
-     * <b>Example </b>
-     * 
-     * \snippet{lineno} stringConv.cpp numStringExample
-     * 
-     * Console Output:
-     * \include{lineno} numString.out.txt
+     * @return ParseResult<UInteger> Converted integer or error.
      */
     template<easyMath::UnsignedIntegral UInteger>
-    [[nodiscard]] constexpr inline UInteger convertNumberString(std::string_view numberString)
+    [[nodiscard]] constexpr inline ParseResult<UInteger> tryConvertNumberString(std::string_view numberString) noexcept
     {
         if(numberString.size() == 0)
-            throw std::invalid_argument("empty string");
+            return ParseError{ParseErrorCode::EMPTY_STRING, 0};
 
         bool isNegative = (numberString[0] == '-');
+        std::size_t offset = isNegative ? 1 : 0;
 
         if(isNegative)
             numberString = numberString.substr(1);
         
         if(numberString.size() == 0)
-            throw std::invalid_argument("string with - only");
+            return ParseError{ParseErrorCode::SIGN_ONLY, offset};
 
         UInteger ret = 0;
 
         if(numberString[0] == '0')
         {
             if(numberString.size() == 1)    
-                return 0;
+                return ret;
             else if((numberString[1] == 'x') || (numberString[1] == 'X'))
             {
-                if(validateHexString(numberString.substr(2)))
-                    ret = convertHexString<UInteger>(numberString.substr(2));
-                else
-                    throw std::invalid_argument("Invalid characters in hex number string");
+                auto digits = numberString.substr(2);
+
+                if(!validateHexString(digits))
+                    return ParseError{ParseErrorCode::INVALID_DIGIT, offset + 2 + impl_detail_::firstInvalidDigit_<16>(digits)};
+
+                ret = convertHexString<UInteger>(digits);
             }
             else if((numberString[1] == 'b') || (numberString[1] == 'B'))
             {
-                if(validateBinString(numberString.substr(2)))
-                    ret = convertBinaryString<UInteger>(numberString.substr(2));
-                else
-                    throw std::invalid_argument("Invalid characters in binary number string");
+                auto digits = numberString.substr(2);
+
+                if(!validateBinString(digits))
+                    return ParseError{ParseErrorCode::INVALID_DIGIT, offset + 2 + impl_detail_::firstInvalidDigit_<2>(digits)};
+
+                ret = convertBinaryString<UInteger>(digits);
             }
-            else if(validateOctString(numberString.substr(1)))
-                ret = convertOctString<UInteger>(numberString.substr(1));
             else
-                throw std::invalid_argument("Invalid characters in oct number string");
+            {
+                auto digits = numberString.substr(1);
+
+                if(!validateOctString(digits))
+                    return ParseError{ParseErrorCode::INVALID_DIGIT, offset + 1 + impl_detail_::firstInvalidDigit_<8>(digits)};
+
+                ret = convertOctString<UInteger>(digits);
+            }
         }
         else if(validateDecString(numberString))
             ret = convertDecimalString<UInteger>(numberString);
         else
-            throw std::invalid_argument("Invalid characters in decimal number string");
+            return ParseError{ParseErrorCode::INVALID_DIGIT, offset + impl_detail_::firstInvalidDigit_<10>(numberString)};
 
         if(isNegative)
             ret = ~ret + 1;
@@ -841,24 +1663,55 @@ namespace easyParse
     }
 
     /**
-     * @brief Validates number string, for decimal, 
-     * octal (if prefixed by 0), 
-     * hex (if prefixed by 0x), 
-     * binary (if prefixed by )
+     * @brief Convert number string to integer.
+     * 
+     * Support for:
+     * - 0x or 0X prefix hex.
+     * - 0b or 0B prefix octal.
+     * - 0 prefix octal.
+     * - No prefix decimal
+     * - Negative numbers will produce 2's complement.
+     * 
+     * @throw (1) `std::invalid_argument` : Empty string or only '-' passed.
+     * @throw (2) `std::invalid_argument` : Invalid characters (non hex in a 0x string or non binary in 0b ...).
+     * 
+     * @tparam UInteger Type of integer.
+     * @param[in] numberString number string to convert.
+     * @return UInteger Converted integer.
+     * 
+     * <b>Example </b>
+     * 
+     * \snippet{lineno} stringConv.cpp numStringExample
+     * 
+     * Console Output:
+     * \include{lineno} numString.out.txt
+     */
+    template<easyMath::UnsignedIntegral UInteger>
+    [[nodiscard]] constexpr inline UInteger convertNumberString(std::string_view numberString)
+    {
+        return tryConvertNumberString<UInteger>(numberString).value();
+    }
+
+    /**
+     * @brief Validates number string without throwing, see `validateNumberString`.
+     * 
+     * Errors (offset in `numberString`):
+     * - `EMPTY_STRING` : Empty string.
+     * - `SIGN_ONLY` : Only '-' passed.
      * 
      * @param[in] numberString string to validate.
-     * @return bool true if valid number string.
+     * @return ParseResult<bool> true if valid number string, or error.
      */
-    [[nodiscard]] constexpr inline bool validateNumberString(std::string_view numberString)
+    [[nodiscard]] constexpr inline ParseResult<bool> tryValidateNumberString(std::string_view numberString) noexcept
     {
         if(numberString.size() == 0)
-            throw std::invalid_argument("empty string");
+            return ParseError{ParseErrorCode::EMPTY_STRING, 0};
 
         if((numberString[0] == '-'))
             numberString = numberString.substr(1);
         
         if(numberString.size() == 0)
-            throw std::invalid_argument("string with - only");
+            return ParseError{ParseErrorCode::SIGN_ONLY, 1};
 
         if(numberString[0] == '0')
         {
@@ -875,6 +1728,305 @@ namespace easyParse
             return validateDecString(numberString);
     }
 
+    /**
+     * @brief Validates number string, for decimal, 
+     * octal (if prefixed by 0), 
+     * hex (if prefixed by 0x), 
+     * binary (if prefixed by )
+     * 
+     * @throw (1) `std::invalid_argument` : Empty string or only '-' passed.
+     * 
+     * @param[in] numberString string to validate.
+     * @return bool true if valid number string.
+     */
+    [[nodiscard]] constexpr inline bool validateNumberString(std::string_view numberString)
+    {
+        return tryValidateNumberString(numberString).value();
+    }
+
+    namespace impl_detail_
+    {
+        /**
+         * @brief Unsigned type holding the magnitude of a parsed `Integer`, `void` if unsupported.
+         *
+         * @tparam Integer target type.
+         */
+        template<class Integer>
+        struct ParseMagnitude_
+        {
+            using type = std::conditional_t<easyMath::UnsignedIntegral<Integer>, Integer, void>;
+        };
+
+        /// @brief Builtin signed integers parse their magnitude in the unsigned counterpart.
+        template<std::signed_integral Integer>
+        struct ParseMagnitude_<Integer>
+        {
+            using type = std::make_unsigned_t<Integer>;
+        };
+
+#if defined(__SIZEOF_INT128__)
+        /// @brief `__int128` parses its magnitude in `unsigned __int128`.
+        template<>
+        struct ParseMagnitude_<easyMath::BuiltinInt128>
+        {
+            using type = easyMath::BuiltinUInt128;
+        };
+#endif
+
+        /// @brief Unsigned type holding the magnitude of a parsed `Integer`.
+        template<class Integer>
+        using ParseMagnitude_t = typename ParseMagnitude_<Integer>::type;
+    }
+
+    /**
+     * @brief Integer types `parseNumberString` converts to, any `UnsignedIntegral` and builtin
+     * (or `__int128`) signed integers.
+     *
+     * @tparam Integer type to check.
+     */
+    template<class Integer>
+    concept ParsableInteger = easyMath::UnsignedIntegral<Integer>
+        || (easyMath::SignedIntegral<Integer> && easyMath::UnsignedIntegral<impl_detail_::ParseMagnitude_t<Integer>>);
+
+    namespace impl_detail_
+    {
+        /**
+         * @brief Number of leading digits of `base` always representable as positive `Integer`,
+         * these are converted in blocks without overflow checks.
+         *
+         * @tparam Integer target type.
+         * @tparam base 2, 8, 10 or 16.
+         */
+        template<ParsableInteger Integer, unsigned base>
+        inline constexpr std::size_t SAFE_DIGIT_COUNT_ = []()
+        {
+            using Magnitude = ParseMagnitude_t<Integer>;
+
+            const Magnitude max = static_cast<Magnitude>(easyMath::NumericTraits<Integer>::max());
+            const Magnitude radix = static_cast<Magnitude>(base);
+
+            Magnitude power = static_cast<Magnitude>(1u);
+            std::size_t count = 0;
+
+            for(; power <= max / radix; ++count)
+                power *= radix;
+
+            // `base^(count + 1) - 1 <= max`, eg: 16 hex digits of a 64 bit unsigned.
+            if((power - static_cast<Magnitude>(1u)) <= (max - (radix - static_cast<Magnitude>(1u))) / radix)
+                ++count;
+
+            return count;
+        }();
+
+        /**
+         * @brief Value of digit `ch` of `base`, `base` (or more) if `ch` is not a digit of `base`.
+         *
+         * @tparam base 2, 8, 10 or 16.
+         * @param[in] ch character.
+         * @return unsigned digit value.
+         */
+        template<unsigned base>
+        [[nodiscard]] constexpr inline unsigned digitValue_(char ch) noexcept
+        {
+            unsigned digit = static_cast<unsigned char>(ch - '0');
+
+            if constexpr (base == 16)
+            {
+                if(digit >= 10)
+                {
+                    unsigned letter = static_cast<unsigned char>((ch | 0x20) - 'a');
+                    digit = (letter < 6) ? letter + 10 : base;
+                }
+            }
+
+            return digit;
+        }
+
+        /**
+         * @brief Validate and convert digits of `base` in one pass, checking the magnitude against `limit`.
+         *
+         * Digits that cannot exceed the positive range are converted in blocks (`convertDecimalBlocks_`,
+         * `convertPowerOfTwoBlocks_`), the rest one digit at a time against the `limit / base`,
+         * `limit % base` cutoff. Invalid digits take precedence over overflow.
+         *
+         * @tparam Magnitude unsigned accumulator.
+         * @tparam Integer target type.
+         * @tparam base 2, 8, 10 or 16.
+         * @param[in] digits digit string, without sign or prefix, requires `!digits.empty()`.
+         * @param[in] limit largest magnitude allowed.
+         * @param[out] magnitude converted magnitude, if valid.
+         * @return std::optional<ParseError> error and offset of the offending digit in `digits`, if any.
+         */
+        template<class Magnitude, class Integer, unsigned base>
+        [[nodiscard]] constexpr inline std::optional<ParseError> parseDigits_(
+            std::string_view digits,
+            Magnitude limit,
+            Magnitude& magnitude
+        ) noexcept
+        {
+            magnitude = static_cast<Magnitude>(0u);
+
+            // blocks are only bounded by the positive range, a lower limit (eg: "-1" for unsigned targets)
+            // checks every digit so the offending one is reported.
+            bool isBlockSafe = limit >= static_cast<Magnitude>(easyMath::NumericTraits<Integer>::max());
+            auto safeDigits = digits.substr(0, isBlockSafe ? SAFE_DIGIT_COUNT_<Integer, base> : 0);
+            std::size_t i = 0;
+
+            if constexpr (base == 10)
+                i = convertDecimalBlocks_(safeDigits, magnitude);
+            else
+                i = convertPowerOfTwoBlocks_<Magnitude, std::bit_width(base - 1), true>(safeDigits, magnitude);
+
+            const Magnitude radix = static_cast<Magnitude>(base);
+
+            for(; i < safeDigits.size(); ++i)
+            {
+                unsigned digit = digitValue_<base>(digits[i]);
+
+                if(digit >= base)
+                    return ParseError{ParseErrorCode::INVALID_DIGIT, i};
+
+                magnitude = static_cast<Magnitude>(magnitude * radix + static_cast<Magnitude>(digit));
+            }
+
+            const Magnitude cutoff = limit / radix;
+            const unsigned cutoffDigit = static_cast<unsigned>(limit % radix);
+
+            for(; i < digits.size(); ++i)
+            {
+                unsigned digit = digitValue_<base>(digits[i]);
+
+                if(digit >= base)
+                    return ParseError{ParseErrorCode::INVALID_DIGIT, i};
+
+                if((magnitude > cutoff) || ((magnitude == cutoff) && (digit > cutoffDigit)))
+                {
+                    // a malformed string is reported as such, even if its digits overflow first.
+                    for(std::size_t j = i + 1; j < digits.size(); ++j)
+                        if(digitValue_<base>(digits[j]) >= base)
+                            return ParseError{ParseErrorCode::INVALID_DIGIT, j};
+
+                    return ParseError{ParseErrorCode::OUT_OF_RANGE, i};
+                }
+
+                magnitude = static_cast<Magnitude>(magnitude * radix + static_cast<Magnitude>(digit));
+            }
+
+            return std::nullopt;
+        }
+    }
+
+    /**
+     * @brief Validate and convert number string in a single pass, with range checking, without throwing.
+     *
+     * Same conversion as `parseNumberString`.
+     *
+     * Errors (offset in `numberString`):
+     * - `EMPTY_STRING` : Empty string.
+     * - `SIGN_ONLY` : Only '-' passed.
+     * - `INVALID_DIGIT` : Invalid characters (non hex in a 0x string or non binary in 0b ...),
+     *   or a prefix without digits.
+     * - `OUT_OF_RANGE` : Value not representable in `Integer`, offset of the first digit taking the
+     *   magnitude out of range (the first non zero digit of a negative unsigned value).
+     *
+     * @tparam Integer Type of integer, unsigned or signed.
+     * @param[in] numberString number string to convert.
+     * @return ParseResult<Integer> Converted integer or error.
+     */
+    template<ParsableInteger Integer>
+    [[nodiscard]] constexpr inline ParseResult<Integer> tryParseNumberString(std::string_view numberString) noexcept
+    {
+        using Magnitude = impl_detail_::ParseMagnitude_t<Integer>;
+
+        if(numberString.empty())
+            return ParseError{ParseErrorCode::EMPTY_STRING, 0};
+
+        bool isNegative = (numberString[0] == '-');
+        std::size_t offset = isNegative ? 1 : 0;
+
+        if(offset == numberString.size())
+            return ParseError{ParseErrorCode::SIGN_ONLY, offset};
+
+        unsigned base = 10;
+
+        if((numberString[offset] == '0') && (offset + 1 < numberString.size()))
+        {
+            char prefix = numberString[offset + 1];
+
+            if((prefix == 'x') || (prefix == 'X'))
+                base = 16;
+            else if((prefix == 'b') || (prefix == 'B'))
+                base = 2;
+            else
+                base = 8;
+
+            offset += (base == 8) ? 1 : 2;
+
+            if(offset == numberString.size())
+                return ParseError{ParseErrorCode::INVALID_DIGIT, offset};
+        }
+
+        // magnitude of lowest() is max() + 1 for 2's complement signed types.
+        Magnitude limit = static_cast<Magnitude>(easyMath::NumericTraits<Integer>::max());
+        if(isNegative)
+            limit = easyMath::NumericTraits<Integer>::is_signed ? static_cast<Magnitude>(limit + static_cast<Magnitude>(1u)) : static_cast<Magnitude>(0u);
+
+        Magnitude magnitude = static_cast<Magnitude>(0u);
+        std::optional<ParseError> error;
+        auto digits = numberString.substr(offset);
+
+        switch(base)
+        {
+        case 16:
+            error = impl_detail_::parseDigits_<Magnitude, Integer, 16>(digits, limit, magnitude);
+            break;
+        case 8:
+            error = impl_detail_::parseDigits_<Magnitude, Integer, 8>(digits, limit, magnitude);
+            break;
+        case 2:
+            error = impl_detail_::parseDigits_<Magnitude, Integer, 2>(digits, limit, magnitude);
+            break;
+        default:
+            error = impl_detail_::parseDigits_<Magnitude, Integer, 10>(digits, limit, magnitude);
+            break;
+        }
+
+        if(error)
+            return ParseError{error->code, offset + error->offset};
+
+        if(isNegative)
+            magnitude = static_cast<Magnitude>(static_cast<Magnitude>(0u) - magnitude);
+
+        return static_cast<Integer>(magnitude);
+    }
+
+    /**
+     * @brief Validate and convert number string in a single pass, with range checking.
+     *
+     * Support for the prefixes of `convertNumberString`:
+     * - 0x or 0X prefix hex.
+     * - 0b or 0B prefix binary.
+     * - 0 prefix octal.
+     * - No prefix decimal.
+     * - Leading '-' negates, the result must be within `[lowest(), max()]` of `Integer`
+     *   (only "-0" for unsigned types).
+     *
+     * Unlike `convertNumberString` the value never wraps and a prefix must be followed by a digit.
+     *
+     * @throw (1) `std::invalid_argument` : Empty string or only '-' passed.
+     * @throw (2) `std::invalid_argument` : Invalid characters (non hex in a 0x string or non binary in 0b ...).
+     * @throw (3) `std::out_of_range` : Value not representable in `Integer`.
+     *
+     * @tparam Integer Type of integer, unsigned or signed.
+     * @param[in] numberString number string to convert.
+     * @return Integer Converted integer.
+     */
+    template<ParsableInteger Integer>
+    [[nodiscard]] constexpr inline Integer parseNumberString(std::string_view numberString)
+    {
+        return tryParseNumberString<Integer>(numberString).value();
+    }
+
     /**
      * @brief Check whether the root line at offset has a substring matching `check`.
      * 
@@ -27,18 +27,18 @@
 
 namespace easyParse
 {
-    void ArgParser::parse()
+    ParseResult<void> ArgParser::tryParse()
     {
         enum class ArgType {
             SHORT, LONG, POSITIONAL
         };
 
-        auto checkType = [](std::string_view arg)
+        auto checkType = [](std::string_view arg) -> std::optional<ArgType>
         {
-            if(arg[0] == '-')
+            if(!arg.empty() && (arg[0] == '-'))
             {
                 if(arg.size() == 1)
-                    throw std::invalid_argument("'-' is not a valid argument");
+                    return std::nullopt;
                 else if(arg[1] == '-')
                     return ArgType::LONG;
                 else
@@ -54,6 +54,9 @@ namespace easyParse
 
             auto argType = checkType(arg);
 
+            if(!argType)
+                return ParseError{ParseErrorCode::INVALID_SWITCH, static_cast<std::size_t>(i)};
+
             if(argType == ArgType::POSITIONAL)
             {
                 posArgList_.emplace_back(arg, i);
@@ -118,7 +121,7 @@ namespace easyParse
                 if(found)
                     continue;   
                 
-                throw std::invalid_argument("Unknown Switch");
+                return ParseError{ParseErrorCode::UNKNOWN_SWITCH, static_cast<std::size_t>(i)};
             }
             else if(argType == ArgType::LONG)
             {
@@ -133,7 +136,7 @@ namespace easyParse
                     {
                         ++i;
                         if(i >= argc_)
-                            throw std::invalid_argument("Long Boolean switch must have OFF / ON argument");
+                            return ParseError{ParseErrorCode::MISSING_SWITCH_ARGUMENT, static_cast<std::size_t>(i - 1)};
                         
                         std::string boolArg = toLower(argv_[i]);
 
@@ -168,7 +171,7 @@ namespace easyParse
                         if(found)
                             break;
                         
-                        throw std::invalid_argument("Invalid argument to boolean switch");
+                        return ParseError{ParseErrorCode::INVALID_SWITCH_ARGUMENT, static_cast<std::size_t>(i)};
 
                     }
                 }
@@ -186,6 +189,8 @@ namespace easyParse
                         while((++i) < argc_)
                         {
                             auto argType = checkType(argv_[i]);
+                            if(!argType)
+                                return ParseError{ParseErrorCode::INVALID_SWITCH, static_cast<std::size_t>(i)};
                             if(argType != ArgType::POSITIONAL)
                             {
                                 --i;
@@ -211,7 +216,7 @@ namespace easyParse
                         ++i;
 
                         if(i >= argc_)
-                            throw std::invalid_argument("Long opt switch must have an argument");
+                            return ParseError{ParseErrorCode::MISSING_SWITCH_ARGUMENT, static_cast<std::size_t>(i - 1)};
 
                         std::string opt = toLower(argv_[i]);
 
@@ -226,12 +231,19 @@ namespace easyParse
                             }
                         }
                         if(!found)
-                            throw std::invalid_argument("Invalid argument to opt switch");
+                            return ParseError{ParseErrorCode::INVALID_SWITCH_ARGUMENT, static_cast<std::size_t>(i)};
 
                         break;
                     }
                 }
             }
         }
+
+        return {};
+    }
+
+    void ArgParser::parse()
+    {
+        tryParse().value();
     }
 }
@@ -0,0 +1,122 @@
+/**
+ * @file bitPacking.cpp
+ * @author Harith Manoj
+ * @brief bit packing codec test.
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (C) Harith Manoj
+ *
+ *
+ *                      APACHE LICENSE 2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <easyMathLib/bitPacking.h>
+
+#include "testSupport.h"
+
+constexpr bool checkConstexprRoundTrip()
+{
+    std::uint32_t values[11] = {1, 2, 3, 4, 5, 6, 7, 0, 7, 3, 5};
+    std::uint8_t bytes[easyMath::packedByteSize<3>(11)] = {};
+    std::uint32_t decoded[11] = {};
+
+    auto written = easyMath::pack<3>(values, bytes);
+    auto read = easyMath::unpack<3>(bytes, decoded);
+
+    bool same = (written == 5) && (read == 5);
+    for(std::size_t i = 0; i < 11; ++i)
+        same = same && (decoded[i] == values[i]);
+
+    // value 0 in bits 0-2, value 1 in bits 3-5 ...
+    return same && (bytes[0] == (1 | (2 << 3) | (3 << 6)));
+}
+
+static_assert(checkConstexprRoundTrip());
+static_assert(easyMath::packedByteSize<13>(8) == 13);
+static_assert(easyMath::packedByteSize<13>(9) == 15);
+
+/// @brief Reference bit at position from a packed stream.
+bool bitAt(const std::vector<std::uint8_t>& bytes, std::size_t position)
+{
+    return (bytes[position / 8] >> (position % 8)) & 1;
+}
+
+template<std::size_t Bits>
+bool checkWidth(std::mt19937_64& rng)
+{
+    using UInt = std::conditional_t<(Bits <= 32), std::uint32_t, std::uint64_t>;
+
+    bool pass = true;
+
+    for(std::size_t size : {std::size_t{0}, std::size_t{1}, std::size_t{7}, std::size_t{8}, std::size_t{9}, std::size_t{63}, std::size_t{1000}, std::size_t{1003}})
+    {
+        std::vector<UInt> values(size);
+        for(auto& value : values)
+            value = static_cast<UInt>(rng());
+
+        auto bytes = easyMath::pack<Bits>(values);
+        pass = pass && (bytes.size() == easyMath::packedByteSize<Bits>(size));
+
+        // compare layout with bit by bit reference for a prefix.
+        for(std::size_t i = 0; i < std::min<std::size_t>(size, 16); ++i)
+            for(std::size_t b = 0; b < Bits; ++b)
+                pass = pass && (bitAt(bytes, i * Bits + b) == (((values[i] >> b) & 1) != 0));
+
+        // padding bits in the last byte are zero.
+        if(((size * Bits) % 8) != 0)
+            pass = pass && ((bytes.back() >> ((size * Bits) % 8)) == 0);
+
+        auto decoded = easyMath::unpack<Bits>(bytes, size);
+        for(std::size_t i = 0; i < size; ++i)
+            pass = pass && (decoded[i] == (values[i] & easyMath::impl_detail_::PACK_VALUE_MASK_<Bits>));
+    }
+
+    // narrower value type than default.
+    if constexpr (Bits <= 16)
+    {
+        std::vector<std::uint16_t> values(77);
+        for(auto& value : values)
+            value = static_cast<std::uint16_t>(rng());
+
+        std::vector<std::uint8_t> bytes(easyMath::packedByteSize<Bits>(values.size()));
+        easyMath::pack<Bits, std::uint16_t>(values, bytes);
+
+        std::vector<std::uint16_t> decoded(values.size());
+        easyMath::unpack<Bits, std::uint16_t>(bytes, decoded);
+
+        for(std::size_t i = 0; i < values.size(); ++i)
+            pass = pass && (decoded[i] == (values[i] & easyMath::impl_detail_::PACK_VALUE_MASK_<Bits>));
+    }
+
+    return pass;
+}
+
+int main()
+{
+    auto rng = easyTest::seededEngine();
+
+    bool pass = [&]<std::size_t... I>(std::index_sequence<I...>)
+    {
+        return (checkWidth<I + 1>(rng) && ...);
+    }(std::make_index_sequence<64>{});
+
+    std::cout << (pass ? "PASS " : "FAIL ") << "pack / unpack round trip for widths 1 to 64\n";
+}
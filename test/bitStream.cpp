@@ -0,0 +1,132 @@
+/**
+ * @file bitStream.cpp
+ * @author Harith Manoj
+ * @brief BitReader / BitWriter test.
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (C) Harith Manoj
+ *
+ *
+ *                      APACHE LICENSE 2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <easyMathLib/BitStream.h>
+
+#include "testSupport.h"
+
+constexpr bool checkConstexpr()
+{
+    std::uint8_t bytes[4] = {};
+    easyMath::BitWriter writer(bytes);
+    writer.write<3>(5);
+    writer.write(0x1ff, 9);
+    writer.writeBit(true);
+    auto size = writer.flush();
+
+    easyMath::BitReader reader(bytes);
+    return (size == 2) && (bytes[0] == (5 | (0x1f << 3))) && (reader.read<3>() == 5) && (reader.peek<9>() == 0x1ff)
+        && (reader.read(9) == 0x1ff) && reader.readBit() && !reader.hasOverrun();
+}
+
+static_assert(checkConstexpr());
+
+int main()
+{
+    auto rng = easyTest::seededEngine();
+
+    // random width fields, interleaved with alignment, round trip.
+    bool roundTrip = true;
+    for(std::size_t trial = 0; trial < 100; ++trial)
+    {
+        std::vector<std::pair<std::uint64_t, std::size_t>> fields(1 + rng() % 500);
+        for(auto& [value, size] : fields)
+        {
+            size = rng() % 65;
+            value = rng();
+        }
+
+        std::vector<std::uint8_t> bytes(fields.size() * 8 + 1);
+        easyMath::BitWriter writer(bytes);
+        for(auto [value, size] : fields)
+            writer.write(value, size);
+        auto used = writer.flush();
+
+        roundTrip = roundTrip && (used == writer.byteSize()) && !writer.hasOverrun();
+
+        easyMath::BitReader reader(std::span<const std::uint8_t>(bytes.data(), used));
+        for(auto [value, size] : fields)
+        {
+            auto expected = (size == 64) ? value : (value & ((std::uint64_t{1} << size) - 1));
+            roundTrip = roundTrip && (reader.read(size) == expected);
+        }
+
+        roundTrip = roundTrip && !reader.hasOverrun() && (reader.bitsRemaining() < 8);
+    }
+    CHECK("BitWriter / BitReader round trip of 0 to 64 bit fields", roundTrip);
+
+    // layout matches pack<Bits>.
+    std::vector<std::uint32_t> values(101);
+    for(auto& value : values)
+        value = static_cast<std::uint32_t>(rng() & 0x7ff);
+
+    auto packed = easyMath::pack<11>(values);
+    easyMath::BitReader packedReader(packed);
+    bool layout = true;
+    for(auto value : values)
+        layout = layout && (packedReader.read<11>() == value);
+
+    std::vector<std::uint8_t> written(packed.size());
+    easyMath::BitWriter packedWriter(written);
+    for(auto value : values)
+        packedWriter.write<11>(value);
+    packedWriter.flush();
+    CHECK("BitStream layout matches pack", layout && (written == packed));
+
+    // skip over whole bytes and alignment.
+    std::vector<std::uint8_t> sequence(1000);
+    for(std::size_t i = 0; i < sequence.size(); ++i)
+        sequence[i] = static_cast<std::uint8_t>(i);
+
+    easyMath::BitReader skipper(sequence);
+    skipper.skip(3);
+    skipper.alignToByte();
+    bool skip = (skipper.read<8>() == 1);
+    skipper.skip(8 * 100 + 4);
+    skip = skip && (skipper.read<4>() == (102 >> 4)) && (skipper.bitPosition() == 8 * 103);
+    skipper.skip(8 * 800);
+    skip = skip && (skipper.read<16>() == ((903 & 0xff) | ((904 & 0xff) << 8))) && !skipper.hasOverrun();
+    CHECK("BitReader skip / alignToByte", skip);
+
+    // overrun is sticky and reads zeros.
+    std::uint8_t small[3] = {0xff, 0xff, 0xff};
+    easyMath::BitReader overReader(small);
+    bool overrun = (overReader.read(20) == 0xfffff) && !overReader.hasOverrun() && (overReader.read(8) == 0xf)
+        && overReader.hasOverrun();
+
+    std::uint8_t smallOut[2] = {};
+    easyMath::BitWriter overWriter(smallOut);
+    overWriter.write(0xffff, 16);
+    overrun = overrun && !overWriter.hasOverrun();
+    overWriter.write(1, 1);
+    overWriter.flush();
+    overrun = overrun && overWriter.hasOverrun() && (smallOut[0] == 0xff) && (smallOut[1] == 0xff);
+    CHECK("BitReader / BitWriter overrun", overrun);
+}
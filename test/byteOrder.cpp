@@ -0,0 +1,155 @@
+/**
+ * @file byteOrder.cpp
+ * @author Harith Manoj
+ * @brief Byte swap, bit reversal and endian conversion test, span kernels at every CPU tier against scalar.
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (C) Harith Manoj
+ *
+ *
+ *                      APACHE LICENSE 2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <easyMathLib/byteOrder.h>
+#include <easyMathLib/WideUInt.h>
+
+#include "testSupport.h"
+
+static_assert(easyMath::byteSwap<std::uint32_t>(0x01020304u) == 0x04030201u);
+static_assert(easyMath::byteSwap<std::uint16_t>(0xabcd) == 0xcdab);
+static_assert(easyMath::byteSwap<std::uint8_t>(0x12) == 0x12);
+static_assert(easyMath::bitReverse<std::uint8_t>(0x01) == 0x80 && easyMath::bitReverse<std::uint8_t>(0x36) == 0x6c);
+static_assert(easyMath::bitReverse<std::uint64_t>(1) == (std::uint64_t{1} << 63));
+static_assert(easyMath::bitReverse<std::uint32_t>(0x0000f00du) == 0xb00f0000u);
+static_assert(easyMath::fromBigEndian(easyMath::toBigEndian<std::uint64_t>(0x0102030405060708ull)) == 0x0102030405060708ull);
+static_assert(easyMath::toLittleEndian<std::uint32_t>(0x01020304u) == ((std::endian::native == std::endian::little) ? 0x01020304u : 0x04030201u));
+
+#if defined(__SIZEOF_INT128__)
+static_assert(easyMath::byteSwap<easyMath::BuiltinUInt128>(0xff) == (static_cast<easyMath::BuiltinUInt128>(0xff) << 120));
+static_assert(easyMath::bitReverse<easyMath::BuiltinUInt128>(1) == (static_cast<easyMath::BuiltinUInt128>(1) << 127));
+#endif
+
+static_assert(easyMath::byteSwap(easyMath::UInt128(0xab)) == (easyMath::UInt128(0xab) << 120));
+static_assert(easyMath::bitReverse(easyMath::UInt128(3)) == (easyMath::UInt128(3) << 126));
+
+constexpr bool checkConstexprSpan()
+{
+    std::uint16_t values[] = {0x0102, 0x0304, 0x8001};
+    easyMath::byteSwap<std::uint16_t>(values);
+    easyMath::bitReverse<std::uint16_t>(values);
+
+    return (values[0] == 0x8040) && (values[1] == 0xc020) && (values[2] == 0x0180);
+}
+
+static_assert(checkConstexprSpan());
+
+/// @brief Reference bit reversal, one bit at a time.
+template<class UInt>
+UInt referenceBitReverse(UInt value)
+{
+    UInt result = 0;
+    for(std::size_t bit = 0; bit < sizeof(UInt) * 8; ++bit)
+        result = static_cast<UInt>((result << 1) | ((value >> bit) & 1));
+    return result;
+}
+
+/// @brief Reference byte swap through memory.
+template<class UInt>
+UInt referenceByteSwap(UInt value)
+{
+    unsigned char bytes[sizeof(UInt)];
+    std::memcpy(bytes, &value, sizeof(UInt));
+    std::reverse(bytes, bytes + sizeof(UInt));
+    std::memcpy(&value, bytes, sizeof(UInt));
+    return value;
+}
+
+template<class UInt>
+bool checkSpans(std::mt19937_64& rng)
+{
+    bool pass = true;
+
+    for(std::size_t size : {0, 1, 7, 16, 33, 64, 129, 1000})
+    {
+        std::vector<UInt> values(size), swapped(size), reversed(size), big(size);
+        for(auto& value : values)
+            value = static_cast<UInt>((static_cast<easyMath::BuiltinUInt128>(rng()) << 64) | rng());
+
+        easyMath::byteSwap<UInt>(values, swapped);
+        easyMath::bitReverse<UInt>(values, reversed);
+        easyMath::toBigEndian<UInt>(values, big);
+
+        for(std::size_t i = 0; i < size; ++i)
+        {
+            pass = pass && (swapped[i] == referenceByteSwap(values[i])) && (reversed[i] == referenceBitReverse(values[i]));
+            pass = pass && (easyMath::byteSwap(values[i]) == swapped[i]) && (easyMath::bitReverse(values[i]) == reversed[i]);
+            pass = pass && (big[i] == easyMath::toBigEndian(values[i]));
+        }
+
+        // in place round trips.
+        easyMath::fromBigEndian<UInt>(big);
+        easyMath::bitReverse<UInt>(reversed);
+        easyMath::toLittleEndian<UInt>(swapped);
+        easyMath::fromLittleEndian<UInt>(swapped);
+        easyMath::byteSwap<UInt>(swapped);
+        pass = pass && (big == values) && (reversed == values) && (swapped == values);
+    }
+
+    return pass;
+}
+
+bool checkWide(std::mt19937_64& rng)
+{
+    bool pass = true;
+
+    std::vector<easyMath::UInt256> values(37), swapped(37), reversed(37);
+    for(auto& value : values)
+        value = (easyMath::UInt256(rng()) << 192) | (easyMath::UInt256(rng()) << 64) | easyMath::UInt256(rng());
+
+    easyMath::byteSwap<easyMath::UInt256>(values, swapped);
+    easyMath::bitReverse<easyMath::UInt256>(values, reversed);
+
+    for(std::size_t i = 0; i < values.size(); ++i)
+    {
+        pass = pass && (easyMath::byteSwap(swapped[i]) == values[i]) && (easyMath::bitReverse(reversed[i]) == values[i]);
+
+        // bit reversal is byte swap with bits reversed inside bytes.
+        auto low = static_cast<std::uint8_t>(static_cast<std::uint64_t>(reversed[i] & easyMath::UInt256(0xffu)));
+        pass = pass && (low == easyMath::bitReverse(static_cast<std::uint8_t>(static_cast<std::uint64_t>(values[i] >> 248))));
+    }
+
+    return pass;
+}
+
+int main()
+{
+    auto rng = easyTest::seededEngine();
+
+    CHECK("8 bit spans at every tier", easyTest::atEveryCpuTier([&]() { return checkSpans<std::uint8_t>(rng); }));
+    CHECK("16 bit spans at every tier", easyTest::atEveryCpuTier([&]() { return checkSpans<std::uint16_t>(rng); }));
+    CHECK("32 bit spans at every tier", easyTest::atEveryCpuTier([&]() { return checkSpans<std::uint32_t>(rng); }));
+    CHECK("64 bit spans at every tier", easyTest::atEveryCpuTier([&]() { return checkSpans<std::uint64_t>(rng); }));
+    CHECK("128 bit spans at every tier", easyTest::atEveryCpuTier([&]() { return checkSpans<easyMath::BuiltinUInt128>(rng); }));
+    CHECK("WideUInt byte swap / bit reverse at every tier", easyTest::atEveryCpuTier([&]() { return checkWide(rng); }));
+
+    return 0;
+}
@@ -0,0 +1,150 @@
+/**
+ * @file carryChain.cpp
+ * @author Harith Manoj
+ * @brief carry chain add / subtract test.
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (C) Harith Manoj
+ *
+ *
+ *                      APACHE LICENSE 2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <easyMathLib/carryChain.h>
+
+#include "testSupport.h"
+
+constexpr bool checkConstexprChain()
+{
+    std::uint64_t lhs[3] = {~0ull, ~0ull, 1};
+    std::uint64_t rhs[3] = {1, 0, 0};
+    std::uint64_t sum[3] = {};
+
+    bool carry = easyMath::addWithCarry<std::uint64_t>(sum, lhs, rhs);
+    bool borrow = easyMath::subWithBorrow<std::uint64_t>(sum, sum, lhs);
+
+    return !carry && !borrow && (sum[0] == 1) && (sum[1] == 0) && (sum[2] == 0);
+}
+
+static_assert(checkConstexprChain());
+
+constexpr bool checkConstexprOverflow()
+{
+    std::uint8_t value = 250;
+    bool first = easyMath::addAndCheckOverflow<std::uint8_t>(value, 5, true);
+    bool second = easyMath::subtractAndCheckUnderflow<std::uint8_t>(value, 1, true);
+    return first && second && (value == 254);
+}
+
+static_assert(checkConstexprOverflow());
+
+constexpr std::size_t COUNT = 10000;
+
+template<class UInt>
+void checkScalar(std::mt19937_64& rng)
+{
+    bool pass = true;
+
+    for(std::size_t i = 0; i < COUNT; ++i)
+    {
+        auto lhs = static_cast<UInt>(rng()), rhs = static_cast<UInt>(rng());
+        bool carryIn = rng() & 1;
+
+        auto max = static_cast<UInt>(easyMath::NumericTraits<UInt>::max() - 1);
+        auto expected = static_cast<UInt>(lhs + rhs + carryIn);
+        bool expectedCarry = (static_cast<easyMath::BuiltinUInt128>(lhs) + rhs + carryIn) > easyMath::NumericTraits<UInt>::max();
+        bool expectedBorrow = (static_cast<easyMath::BuiltinInt128>(lhs) - rhs - carryIn) < 0;
+
+        auto sum = lhs;
+        pass = pass && (easyMath::addAndCheckOverflow<UInt>(sum, rhs, carryIn) == expectedCarry) && (sum == expected);
+
+        auto difference = lhs;
+        pass = pass && (easyMath::subtractAndCheckUnderflow<UInt>(difference, rhs, carryIn) == expectedBorrow)
+            && (difference == static_cast<UInt>(lhs - rhs - carryIn));
+
+        // non default max takes the generic two compare form.
+        auto limited = lhs;
+        bool expectedLimited = (static_cast<easyMath::BuiltinUInt128>(lhs) + rhs + carryIn) > max;
+        pass = pass && (easyMath::addAndCheckOverflow<UInt>(limited, rhs, carryIn, max) == expectedLimited);
+    }
+
+    std::cout << (pass ? "PASS " : "FAIL ") << sizeof(UInt) << " byte addAndCheckOverflow / subtractAndCheckUnderflow\n";
+}
+
+template<class Limb>
+void checkChain(std::mt19937_64& rng)
+{
+    bool pass = true;
+
+    for(std::size_t i = 0; i < 1000; ++i)
+    {
+        std::size_t size = rng() % 40;
+        std::vector<Limb> lhs(size), rhs(size), sum(size), difference(size);
+
+        for(std::size_t j = 0; j < size; ++j)
+        {
+            // bias towards all ones limbs to exercise long carry runs.
+            lhs[j] = (rng() % 4 == 0) ? static_cast<Limb>(~Limb{0}) : static_cast<Limb>(rng());
+            rhs[j] = (rng() % 4 == 0) ? Limb{0} : static_cast<Limb>(rng());
+        }
+
+        bool carryIn = rng() & 1;
+
+        bool carry = easyMath::addWithCarry<Limb>(sum, lhs, rhs, carryIn);
+        bool borrow = easyMath::subWithBorrow<Limb>(difference, lhs, rhs, carryIn);
+
+        bool expectedCarry = carryIn, expectedBorrow = carryIn;
+        for(std::size_t j = 0; j < size; ++j)
+        {
+            auto wideSum = static_cast<easyMath::BuiltinUInt128>(lhs[j]) + rhs[j] + expectedCarry;
+            auto wideDifference = static_cast<easyMath::BuiltinInt128>(lhs[j]) - rhs[j] - expectedBorrow;
+
+            pass = pass && (sum[j] == static_cast<Limb>(wideSum)) && (difference[j] == static_cast<Limb>(wideDifference));
+
+            expectedCarry = wideSum > static_cast<Limb>(~Limb{0});
+            expectedBorrow = wideDifference < 0;
+        }
+
+        pass = pass && (carry == expectedCarry) && (borrow == expectedBorrow);
+
+        // in place accumulation then removal restores lhs.
+        auto accumulate = lhs;
+        easyMath::addWithCarry<Limb>(accumulate, accumulate, rhs);
+        easyMath::subWithBorrow<Limb>(accumulate, accumulate, rhs);
+        pass = pass && (accumulate == lhs);
+    }
+
+    std::cout << (pass ? "PASS " : "FAIL ") << sizeof(Limb) << " byte limb addWithCarry / subWithBorrow\n";
+}
+
+int main()
+{
+    auto rng = easyTest::seededEngine();
+
+    checkScalar<std::uint8_t>(rng);
+    checkScalar<std::uint16_t>(rng);
+    checkScalar<std::uint32_t>(rng);
+    checkScalar<std::uint64_t>(rng);
+
+    checkChain<std::uint16_t>(rng);
+    checkChain<std::uint32_t>(rng);
+    checkChain<std::uint64_t>(rng);
+}
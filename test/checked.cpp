@@ -0,0 +1,216 @@
+/**
+ * @file checked.cpp
+ * @author Harith Manoj
+ * @brief Checked and checked / saturating span kernel test.
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (C) Harith Manoj
+ *
+ *
+ *                      APACHE LICENSE 2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <easyMathLib/Checked.h>
+
+#include "testSupport.h"
+
+static_assert(easyMath::NumericType<easyMath::Checked<std::int32_t>>);
+static_assert(easyMath::SignedIntegral<easyMath::Checked<std::int64_t>>);
+static_assert(easyMath::Integral<easyMath::Checked<std::uint8_t>>);
+
+constexpr bool checkConstexpr()
+{
+    easyMath::Checked<std::uint8_t> sum = 0;
+    for(int i = 0; i < 15; ++i)
+        sum += 20;
+
+    easyMath::Checked<std::int32_t> product = 1;
+    for(int i = 0; i < 20; ++i)
+        product = product * 3;
+
+    easyMath::Checked<std::int32_t> small = 7;
+    small = small * 6 - 2;
+
+    easyMath::Checked<std::int16_t> quotient = std::int16_t{-32768};
+    quotient /= -1;
+
+    return sum.hasOverflowed() && (sum == 300 % 256) && !easyMath::Checked<std::uint8_t>(255).hasOverflowed()
+        && product.hasOverflowed() && !small.hasOverflowed() && (small == 40)
+        && quotient.hasOverflowed() && (quotient == -32768)
+        && easyMath::Checked<std::uint8_t>(256).hasOverflowed() && easyMath::Checked<std::uint8_t>(-1).hasOverflowed()
+        && easyMath::Checked<std::int8_t>(127.9).value() == 127 && easyMath::Checked<std::int8_t>(128.0).hasOverflowed()
+        && (-easyMath::Checked<std::int8_t>(-128)).hasOverflowed() && (easyMath::Checked<std::uint32_t>(5) < 6);
+}
+
+static_assert(checkConstexpr());
+
+/// @brief Floating point bounds, including `lowest()` where `lowest() - 1` is not representable.
+constexpr bool checkFloatBounds()
+{
+    return !easyMath::Checked<std::int64_t>(-0x1p63).hasOverflowed() && (easyMath::Checked<std::int64_t>(-0x1p63) == std::numeric_limits<std::int64_t>::lowest())
+        && !easyMath::Checked<std::int32_t>(-0x1p31f).hasOverflowed() && (easyMath::Checked<std::int32_t>(-0x1p31f) == std::numeric_limits<std::int32_t>::lowest())
+        && easyMath::Checked<std::int64_t>(-0x1.0000000000001p63).hasOverflowed() && easyMath::Checked<std::int64_t>(0x1p63).hasOverflowed()
+        && easyMath::Checked<std::int32_t>(-0x1.000002p31f).hasOverflowed() && easyMath::Checked<std::int32_t>(0x1p31f).hasOverflowed()
+        && (easyMath::Checked<std::int32_t>(-2147483648.5) == std::numeric_limits<std::int32_t>::lowest())
+        && easyMath::Checked<std::int32_t>(-2147483649.0).hasOverflowed()
+        && (easyMath::Checked<std::uint64_t>(-0.5) == 0u) && easyMath::Checked<std::uint64_t>(-1.0).hasOverflowed();
+}
+
+static_assert(checkFloatBounds());
+
+/**
+ * @brief Exact reference through 128 bit arithmetic.
+ */
+template<class Integer>
+bool referenceOperation(int operation, Integer lhs, Integer rhs, bool isSaturating, Integer& result)
+{
+    easyMath::BuiltinInt128 max = std::numeric_limits<Integer>::max(), lowest = std::numeric_limits<Integer>::lowest();
+
+    if constexpr (std::is_same_v<Integer, std::uint64_t>)
+    {
+        // 64 bit unsigned products exceed the signed 128 bit range.
+        if(operation == 2)
+        {
+            easyMath::BuiltinUInt128 product = static_cast<easyMath::BuiltinUInt128>(lhs) * rhs;
+            bool overflow = (product >> 64) != 0;
+            result = (isSaturating && overflow) ? std::numeric_limits<Integer>::max() : static_cast<Integer>(product);
+            return overflow;
+        }
+    }
+
+    easyMath::BuiltinInt128 exact = (operation == 0) ? (easyMath::BuiltinInt128)lhs + rhs : (operation == 1) ? (easyMath::BuiltinInt128)lhs - rhs : (easyMath::BuiltinInt128)lhs * rhs;
+
+    if(exact > max)
+        result = isSaturating ? std::numeric_limits<Integer>::max() : static_cast<Integer>(exact);
+    else if(exact < lowest)
+        result = isSaturating ? std::numeric_limits<Integer>::lowest() : static_cast<Integer>(exact);
+    else
+        result = static_cast<Integer>(exact);
+
+    return (exact > max) || (exact < lowest);
+}
+
+template<class Integer>
+Integer randomValue(std::mt19937_64& rng)
+{
+    // bias towards the edges of the range.
+    switch(rng() % 4)
+    {
+    case 0: return std::numeric_limits<Integer>::max() - static_cast<Integer>(rng() % 3);
+    case 1: return std::numeric_limits<Integer>::lowest() + static_cast<Integer>(rng() % 3);
+    case 2: return static_cast<Integer>(rng() % 100);
+    default: return static_cast<Integer>(rng());
+    }
+}
+
+template<class Integer>
+bool checkKernels(std::mt19937_64& rng)
+{
+    using Kernel = bool (*)(std::span<const Integer>, std::span<const Integer>, std::span<Integer>) noexcept;
+    const Kernel kernels[2][3] = {
+        {&easyMath::checkedAdd<Integer>, &easyMath::checkedSubtract<Integer>, &easyMath::checkedMultiply<Integer>},
+        {&easyMath::saturatingAdd<Integer>, &easyMath::saturatingSubtract<Integer>, &easyMath::saturatingMultiply<Integer>}
+    };
+
+    bool pass = true;
+
+    for(std::size_t size : {std::size_t{0}, std::size_t{3}, std::size_t{37}, std::size_t{1000}})
+        for(int isSaturating = 0; isSaturating < 2; ++isSaturating)
+            for(int operation = 0; operation < 3; ++operation)
+            {
+                std::vector<Integer> lhs(size), rhs(size), result(size), expected(size);
+                bool expectedOverflow = false;
+
+                // small values only, then one edge pair may or may not overflow.
+                for(std::size_t i = 0; i < size; ++i)
+                {
+                    lhs[i] = static_cast<Integer>(rng() % 10);
+                    rhs[i] = static_cast<Integer>(rng() % 10);
+                }
+
+                if((size != 0) && (rng() % 2 == 0))
+                {
+                    lhs[rng() % size] = randomValue<Integer>(rng);
+                    rhs[rng() % size] = randomValue<Integer>(rng);
+                }
+
+                for(std::size_t i = 0; i < size; ++i)
+                    expectedOverflow |= referenceOperation(operation, lhs[i], rhs[i], isSaturating, expected[i]);
+
+                bool overflow = kernels[isSaturating][operation](lhs, rhs, result);
+                pass = pass && (overflow == expectedOverflow) && (result == expected);
+
+                // fully random operands.
+                for(std::size_t i = 0; i < size; ++i)
+                {
+                    lhs[i] = randomValue<Integer>(rng);
+                    rhs[i] = randomValue<Integer>(rng);
+                }
+
+                expectedOverflow = false;
+                for(std::size_t i = 0; i < size; ++i)
+                    expectedOverflow |= referenceOperation(operation, lhs[i], rhs[i], isSaturating, expected[i]);
+
+                overflow = kernels[isSaturating][operation](lhs, rhs, result);
+                pass = pass && (overflow == expectedOverflow) && (result == expected);
+            }
+
+    return pass;
+}
+
+template<class Integer>
+bool checkAccumulate(std::mt19937_64& rng)
+{
+    bool pass = true;
+
+    for(std::size_t trial = 0; trial < 200; ++trial)
+    {
+        easyMath::Checked<Integer> sum = 0;
+        easyMath::BuiltinInt128 exact = 0;
+        bool expected = false;
+
+        for(std::size_t i = 0; i < 50; ++i)
+        {
+            auto value = (trial % 2 == 0) ? static_cast<Integer>(rng() % 8) : randomValue<Integer>(rng);
+            sum += value;
+            exact += value;
+            expected = expected || (exact > std::numeric_limits<Integer>::max()) || (exact < std::numeric_limits<Integer>::lowest());
+            exact = static_cast<Integer>(exact);
+        }
+
+        pass = pass && (sum.hasOverflowed() == expected) && (sum.value() == static_cast<Integer>(exact));
+    }
+
+    return pass;
+}
+
+int main()
+{
+    auto rng = easyTest::seededEngine();
+
+    CHECK("Checked sticky overflow accumulate", checkAccumulate<std::uint8_t>(rng) && checkAccumulate<std::int16_t>(rng)
+        && checkAccumulate<std::uint32_t>(rng) && checkAccumulate<std::int32_t>(rng) && checkAccumulate<std::int64_t>(rng) && checkAccumulate<std::uint64_t>(rng));
+
+    CHECK("checked / saturating kernels 8 bit", checkKernels<std::uint8_t>(rng) && checkKernels<std::int8_t>(rng));
+    CHECK("checked / saturating kernels 16 bit", checkKernels<std::uint16_t>(rng) && checkKernels<std::int16_t>(rng));
+    CHECK("checked / saturating kernels 32 bit", checkKernels<std::uint32_t>(rng) && checkKernels<std::int32_t>(rng));
+    CHECK("checked / saturating kernels 64 bit", checkKernels<std::uint64_t>(rng) && checkKernels<std::int64_t>(rng));
+}
@@ -0,0 +1,149 @@
+/**
+ * @file convertDecimalString.cpp
+ * @author Harith Manoj
+ * @brief convertDecimalString test, 8 / 16 digit block conversion at every CPU tier against the digit loop.
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (C) Harith Manoj
+ *
+ *
+ *                      APACHE LICENSE 2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+
+#include <easyParseLib/easyParse.h>
+#include <easyMathLib/WideUInt.h>
+
+#include "testSupport.h"
+
+static_assert(easyParse::convertDecimalString<std::uint64_t>("18446744073709551615") == 18446744073709551615ull);
+static_assert(easyParse::convertDecimalString<std::uint64_t>("18446744073709551616") == 0);
+static_assert(easyParse::convertDecimalString<std::uint32_t>("1234567890123") == static_cast<std::uint32_t>(1234567890123ull));
+static_assert(easyParse::convertDecimalString<std::uint8_t>("12345678") == static_cast<std::uint8_t>(12345678));
+
+/// @brief Digit loop the block conversion replaces, wraps modulo `2^bitSize` and takes any character.
+template<class Integer>
+constexpr Integer referenceDecimal(std::string_view digits)
+{
+    Integer ret = 0u;
+
+    for(auto digit : digits)
+    {
+        ret *= 10u;
+        ret += easyParse::digitConverter(digit);
+    }
+
+    return ret;
+}
+
+/// @brief Random decimal string of `size` digits.
+std::string randomDecimal(std::mt19937_64& rng, std::size_t size)
+{
+    std::string digits(size, '0');
+    for(auto& ch : digits)
+        ch = static_cast<char>('0' + rng() % 10);
+    return digits;
+}
+
+/**
+ * @brief Lengths 0 to 80 cover every tail after whole 8 / 16 digit blocks and wrap every type below 256 bits,
+ * strings with a non digit inside a block take the digit loop from that block on.
+ */
+template<class Integer>
+bool checkType(std::mt19937_64& rng)
+{
+    bool pass = true;
+
+    for(std::size_t size = 0; size <= 80; ++size)
+    {
+        for(std::size_t trial = 0; trial < 20; ++trial)
+        {
+            auto digits = randomDecimal(rng, size);
+            pass = pass && (easyParse::convertDecimalString<Integer>(digits) == referenceDecimal<Integer>(digits));
+
+            if(size != 0)
+            {
+                digits[rng() % size] = static_cast<char>(rng());
+                pass = pass && (easyParse::convertDecimalString<Integer>(digits) == referenceDecimal<Integer>(digits));
+            }
+        }
+
+        auto nines = std::string(size, '9');
+        pass = pass && (easyParse::convertDecimalString<Integer>(nines) == referenceDecimal<Integer>(nines));
+    }
+
+    return pass;
+}
+
+/**
+ * @brief Every byte value at every position of a 32 digit string (two 16 digit or four 8 digit blocks).
+ */
+bool checkEveryByte(std::mt19937_64& rng)
+{
+    auto digits = randomDecimal(rng, 32);
+    bool pass = true;
+
+    for(std::size_t position = 0; position < digits.size(); ++position)
+    {
+        auto modified = digits;
+
+        for(int byte = 0; byte < 256; ++byte)
+        {
+            modified[position] = static_cast<char>(byte);
+            pass = pass && (easyParse::convertDecimalString<std::uint64_t>(modified) == referenceDecimal<std::uint64_t>(modified))
+                && (easyParse::convertDecimalString<easyMath::UInt128>(modified) == referenceDecimal<easyMath::UInt128>(modified));
+        }
+    }
+
+    return pass;
+}
+
+int main()
+{
+    auto rng = easyTest::seededEngine();
+
+    CHECK("convertDecimalString 8 and 16 bit wrap, every tier", easyTest::atEveryCpuTier([&]()
+    {
+        return checkType<std::uint8_t>(rng) && checkType<std::uint16_t>(rng);
+    }));
+
+    CHECK("convertDecimalString 32 and 64 bit, every tier", easyTest::atEveryCpuTier([&]()
+    {
+        return checkType<std::uint32_t>(rng) && checkType<std::uint64_t>(rng);
+    }));
+
+#if defined(__SIZEOF_INT128__)
+    CHECK("convertDecimalString unsigned __int128, every tier", easyTest::atEveryCpuTier([&]()
+    {
+        return checkType<easyMath::BuiltinUInt128>(rng);
+    }));
+#endif
+
+    CHECK("convertDecimalString WideUInt<128> and WideUInt<256>, every tier", easyTest::atEveryCpuTier([&]()
+    {
+        return checkType<easyMath::UInt128>(rng) && checkType<easyMath::UInt256>(rng);
+    }));
+
+    CHECK("convertDecimalString invalid byte inside a block, every tier", easyTest::atEveryCpuTier([&]()
+    {
+        return checkEveryByte(rng);
+    }));
+}
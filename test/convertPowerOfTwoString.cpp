@@ -0,0 +1,188 @@
+/**
+ * @file convertPowerOfTwoString.cpp
+ * @author Harith Manoj
+ * @brief convertBinaryString / convertOctString / convertHexString test, block conversion at every CPU tier
+ * against the digit loop.
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (C) Harith Manoj
+ *
+ *
+ *                      APACHE LICENSE 2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+
+#include <easyParseLib/easyParse.h>
+#include <easyMathLib/WideUInt.h>
+
+#include "testSupport.h"
+
+static_assert(easyParse::convertHexString<std::uint64_t>("0123456789abcdef") == 0x0123456789abcdefull);
+static_assert(easyParse::convertHexString<std::uint8_t>("0123456789ABCDEF") == 0xef);
+static_assert(easyParse::convertOctString<std::uint64_t>("0123456701234567") == 00123456701234567ull);
+static_assert(easyParse::convertBinaryString<std::uint16_t>("1x1x1x1x1x1x1x1x1") == 0b0101010101010101);
+
+/// @brief Binary digit loop the block conversion replaces, last `bitSize` characters, '1' is one.
+template<class Integer>
+constexpr Integer referenceBinary(std::string_view digits)
+{
+    Integer ret = 0u;
+
+    auto size = std::min(easyMath::bitSize<Integer>(), digits.size());
+    for(auto digit : digits.substr(digits.size() - size))
+    {
+        ret = ret << 1;
+        ret |= (digit == '1' ? 1 : 0);
+    }
+
+    return ret;
+}
+
+/// @brief Octal / hex digit loop the block conversion replaces, wraps modulo `2^bitSize` and takes any character.
+template<class Integer, std::size_t perBitSize>
+constexpr Integer referencePowerOfTwo(std::string_view digits)
+{
+    Integer ret = 0u;
+
+    for(auto digit : digits)
+    {
+        ret = ret << perBitSize;
+        ret += (perBitSize == 4) ? easyParse::hexDigitConverter(digit) : easyParse::digitConverter(digit);
+    }
+
+    return ret;
+}
+
+/// @brief Random string of `size` characters from `alphabet`.
+std::string randomString(std::mt19937_64& rng, std::size_t size, std::string_view alphabet)
+{
+    std::string digits(size, '0');
+    for(auto& ch : digits)
+        ch = alphabet[rng() % alphabet.size()];
+    return digits;
+}
+
+/// @brief All three conversions match their digit loop on `digits`.
+template<class Integer>
+bool sameAsReference(std::string_view digits)
+{
+    return (easyParse::convertBinaryString<Integer>(digits) == referenceBinary<Integer>(digits))
+        && (easyParse::convertOctString<Integer>(digits) == referencePowerOfTwo<Integer, 3>(digits))
+        && (easyParse::convertHexString<Integer>(digits) == referencePowerOfTwo<Integer, 4>(digits));
+}
+
+/**
+ * @brief Lengths 0 to 140 (around the 8, 16, 32 and 64 character blocks and their tails), plus lengths
+ * around 256 for the widest types.
+ *
+ * Binary strings carry characters other than '0' / '1' inside blocks, octal / hex strings are valid
+ * or carry one non digit.
+ */
+template<class Integer>
+bool checkType(std::mt19937_64& rng)
+{
+    bool pass = true;
+
+    auto checkSize = [&](std::size_t size)
+    {
+        for(std::size_t trial = 0; trial < 4; ++trial)
+        {
+            auto binary = randomString(rng, size, "0101010101x1 ");
+            auto octal = randomString(rng, size, "01234567");
+            auto hex = randomString(rng, size, "0123456789abcdefABCDEF");
+
+            pass = pass && (easyParse::convertBinaryString<Integer>(binary) == referenceBinary<Integer>(binary))
+                && (easyParse::convertOctString<Integer>(octal) == referencePowerOfTwo<Integer, 3>(octal))
+                && (easyParse::convertHexString<Integer>(hex) == referencePowerOfTwo<Integer, 4>(hex));
+
+            if(size != 0)
+            {
+                octal[rng() % size] = static_cast<char>(rng());
+                hex[rng() % size] = static_cast<char>(rng());
+
+                pass = pass && (easyParse::convertOctString<Integer>(octal) == referencePowerOfTwo<Integer, 3>(octal))
+                    && (easyParse::convertHexString<Integer>(hex) == referencePowerOfTwo<Integer, 4>(hex));
+            }
+        }
+    };
+
+    for(std::size_t size = 0; size <= 140; ++size)
+        checkSize(size);
+
+    for(std::size_t size = 250; size <= 262; ++size)
+        checkSize(size);
+
+    return pass;
+}
+
+/**
+ * @brief Every byte value at every position of a 64 character string (every block width).
+ */
+bool checkEveryByte(std::mt19937_64& rng)
+{
+    auto digits = randomString(rng, 64, "01234567");
+    bool pass = true;
+
+    for(std::size_t position = 0; position < digits.size(); ++position)
+    {
+        auto modified = digits;
+
+        for(int byte = 0; byte < 256; ++byte)
+        {
+            modified[position] = static_cast<char>(byte);
+            pass = pass && sameAsReference<std::uint64_t>(modified) && sameAsReference<easyMath::UInt128>(modified);
+        }
+    }
+
+    return pass;
+}
+
+int main()
+{
+    auto rng = easyTest::seededEngine();
+
+    CHECK("power of two strings, types narrower than a block, every tier", easyTest::atEveryCpuTier([&]()
+    {
+        return checkType<std::uint8_t>(rng) && checkType<std::uint16_t>(rng) && checkType<std::uint32_t>(rng);
+    }));
+
+    CHECK("power of two strings, 64 bit, every tier", easyTest::atEveryCpuTier([&]()
+    {
+        return checkType<std::uint64_t>(rng);
+    }));
+
+#if defined(__SIZEOF_INT128__)
+    CHECK("power of two strings, unsigned __int128, every tier", easyTest::atEveryCpuTier([&]()
+    {
+        return checkType<easyMath::BuiltinUInt128>(rng);
+    }));
+#endif
+
+    CHECK("power of two strings, WideUInt<128> and WideUInt<256>, every tier", easyTest::atEveryCpuTier([&]()
+    {
+        return checkType<easyMath::UInt128>(rng) && checkType<easyMath::UInt256>(rng);
+    }));
+
+    CHECK("power of two strings, every byte at every position, every tier", easyTest::atEveryCpuTier([&]()
+    {
+        return checkEveryByte(rng);
+    }));
+}
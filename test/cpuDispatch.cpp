@@ -0,0 +1,201 @@
+/**
+ * @file cpuDispatch.cpp
+ * @author Harith Manoj
+ * @brief Runtime instruction set tier selection test, every dispatched kernel at every available tier.
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (C) Harith Manoj
+ *
+ *
+ *                      APACHE LICENSE 2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <easyLib/cpuDispatch.h>
+#include <easyMathLib/rangeFilter.h>
+#include <easyMathLib/varint.h>
+#include <easyMathLib/Checked.h>
+#include <easyMathLib/Fixed.h>
+#include <easyMathLib/InvariantDivider.h>
+#include <easyMathLib/parallelReduce.h>
+#include <easyMathLib/morton.h>
+#include <easyMathLib/bitPacking.h>
+
+#include "testSupport.h"
+
+using easyLib::CpuTier;
+
+static_assert(easyLib::parseCpuTier("avx2") == CpuTier::AVX2 && easyLib::parseCpuTier("sse4.2") == CpuTier::SSE4_2);
+static_assert(!easyLib::parseCpuTier("neon").has_value());
+static_assert(easyLib::parseCpuTier(easyLib::cpuTierName(CpuTier::AVX512)) == CpuTier::AVX512);
+static_assert(easyLib::parseCpuTier(easyLib::cpuTierName(CpuTier::SCALAR)) == CpuTier::SCALAR);
+
+/**
+ * @brief Run `kernel` at the scalar tier and at every tier up to the detected one, results must match.
+ *
+ * @tparam Kernel callable returning an equality comparable result.
+ */
+template<class Kernel>
+bool sameAtEveryTier(Kernel&& kernel)
+{
+    easyLib::overrideCpuTier(CpuTier::SCALAR);
+    auto reference = kernel();
+
+    return easyTest::atEveryCpuTier([&]() { return kernel() == reference; });
+}
+
+template<class T>
+std::vector<T> randomValues(std::mt19937_64& rng, std::size_t size)
+{
+    std::vector<T> values(size);
+    for(auto& value : values)
+        value = static_cast<T>(rng() % 2000) - static_cast<T>(rng() % 1000);
+    return values;
+}
+
+template<class T>
+bool checkRangeFilter(std::mt19937_64& rng)
+{
+    auto values = randomValues<T>(rng, 1000);
+
+    return sameAtEveryTier([&]()
+    {
+        std::vector<std::uint64_t> mask(16);
+        std::vector<std::size_t> indices(values.size());
+        std::vector<T> compact(values.size());
+
+        auto count = easyMath::valueBetweenMask<T>(values, T(10), T(200), mask);
+        count += easyMath::valueBetweenInclusiveSelect<T>(values, T(10), T(200), indices);
+        count += easyMath::valueBetweenCompact<T>(values, T(10), T(200), compact);
+        return std::make_tuple(count, mask, indices, compact);
+    });
+}
+
+template<class Integer>
+bool checkSpanKernels(std::mt19937_64& rng)
+{
+    std::vector<Integer> lhs(999), rhs(999);
+    for(std::size_t i = 0; i < lhs.size(); ++i)
+    {
+        lhs[i] = static_cast<Integer>(rng());
+        rhs[i] = static_cast<Integer>((i % 3 == 0) ? rng() : rng() % 100);
+    }
+
+    return sameAtEveryTier([&]()
+    {
+        std::vector<Integer> sum(lhs.size()), difference(lhs.size()), quotient(lhs.size()), remainder(lhs.size()), inclusive(lhs.size());
+        std::vector<std::uint8_t> bytes(lhs.size() * 8);
+
+        bool overflow = easyMath::checkedAdd<Integer>(lhs, rhs, sum);
+        bool saturated = easyMath::saturatingSubtract<Integer>(lhs, rhs, difference);
+
+        easyMath::InvariantDivider<Integer> divider(static_cast<Integer>(7));
+        divider.divide(lhs, quotient);
+        divider.modulo(rhs, remainder);
+
+        auto reduced = easyMath::reduceChecked<Integer>(rhs);
+        bool scanOverflow = easyMath::inclusiveScanChecked<Integer>(rhs, inclusive);
+
+        auto encoded = easyMath::varintEncode<Integer>(rhs, bytes);
+        std::vector<Integer> decoded(rhs.size());
+        auto decodedCount = easyMath::varintDecode<Integer>(std::span<const std::uint8_t>(bytes.data(), encoded.byteCount), decoded).valueCount;
+
+        return std::make_tuple(
+            overflow, saturated, sum, difference, quotient, remainder, reduced.value(), reduced.hasOverflowed(), scanOverflow, inclusive,
+            decodedCount, decoded
+        );
+    });
+}
+
+bool checkEncoders(std::mt19937_64& rng)
+{
+    std::vector<std::uint32_t> xs(101), ys(101), unpacked(101);
+    std::vector<std::uint16_t> xs16(101), ys16(101), zs16(101);
+
+    for(std::size_t i = 0; i < xs.size(); ++i)
+    {
+        xs[i] = static_cast<std::uint32_t>(rng());
+        ys[i] = static_cast<std::uint32_t>(rng());
+        xs16[i] = static_cast<std::uint16_t>(rng());
+        ys16[i] = static_cast<std::uint16_t>(rng());
+        zs16[i] = static_cast<std::uint16_t>(rng());
+        unpacked[i] = static_cast<std::uint32_t>(rng() % (1u << 13));
+    }
+
+    auto packed = easyMath::pack<13>(std::span<const std::uint32_t>(unpacked));
+
+    using Q16 = easyMath::Fixed<16, 16>;
+    std::vector<Q16> fixedLhs(101), fixedRhs(101);
+    for(std::size_t i = 0; i < fixedLhs.size(); ++i)
+    {
+        fixedLhs[i] = Q16::fromRaw(static_cast<std::int32_t>(rng()));
+        fixedRhs[i] = Q16::fromRaw(static_cast<std::int32_t>(rng() % 0x40000));
+    }
+
+    return sameAtEveryTier([&]()
+    {
+        std::vector<easyMath::MortonCode<std::uint32_t, 2>> codes2(xs.size());
+        std::vector<easyMath::MortonCode<std::uint16_t, 3>> codes3(xs.size());
+        std::vector<std::uint32_t> values(xs.size());
+        std::vector<Q16> products(xs.size());
+
+        easyMath::mortonEncode2<std::uint32_t>(xs, ys, codes2);
+        easyMath::mortonEncode3<std::uint16_t>(xs16, ys16, zs16, codes3);
+        easyMath::unpack<13>(packed, values);
+        easyMath::fixedMultiply<Q16>(fixedLhs, fixedRhs, products);
+
+        return std::make_tuple(codes2, codes3, values, products);
+    });
+}
+
+bool checkEnvironmentOverride()
+{
+    // read once, on first use of the active tier.
+#if defined(_WIN32)
+    _putenv_s(easyLib::CPU_TIER_ENVIRONMENT.data(), "scalar");
+#else
+    setenv(easyLib::CPU_TIER_ENVIRONMENT.data(), "scalar", 1);
+#endif
+
+    bool pass = (easyLib::cpuTier() == CpuTier::SCALAR) && !easyLib::isCpuTierActive(CpuTier::SSE2);
+
+    CpuTier detected = easyLib::detectCpuTier();
+    pass = pass && (easyLib::overrideCpuTier(CpuTier::AVX512) == detected) && (easyLib::cpuTier() == detected);
+
+    return pass;
+}
+
+int main()
+{
+    auto rng = easyTest::seededEngine();
+
+    CHECK("environment override and clamping", checkEnvironmentOverride());
+    std::cout << "detected tier: " << easyLib::cpuTierName(easyLib::detectCpuTier()) << "\n";
+
+    CHECK("range filter matches at every tier", checkRangeFilter<std::uint8_t>(rng) && checkRangeFilter<std::int16_t>(rng)
+        && checkRangeFilter<std::int32_t>(rng) && checkRangeFilter<std::uint64_t>(rng) && checkRangeFilter<float>(rng)
+        && checkRangeFilter<double>(rng));
+    CHECK("span kernels match at every tier", checkSpanKernels<std::int32_t>(rng) && checkSpanKernels<std::uint32_t>(rng)
+        && checkSpanKernels<std::int64_t>(rng) && checkSpanKernels<std::uint64_t>(rng));
+    CHECK("encoders match at every tier", checkEncoders(rng));
+
+    return 0;
+}
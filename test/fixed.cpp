@@ -0,0 +1,213 @@
+/**
+ * @file fixed.cpp
+ * @author Harith Manoj
+ * @brief Fixed point number and span kernel test.
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (C) Harith Manoj
+ *
+ *
+ *                      APACHE LICENSE 2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <easyMathLib/Fixed.h>
+
+#include "testSupport.h"
+
+using easyMath::Fixed;
+using easyMath::FixedRounding;
+
+static_assert(easyMath::NumericType<Fixed<16, 16>>);
+static_assert(easyMath::NumericTraits<Fixed<16, 16>>::isOverflowCheckable && easyMath::NumericTraits<Fixed<16, 16>>::isCustomSized);
+static_assert(Fixed<10, 6>::bitSize() == 16);
+static_assert(sizeof(Fixed<10, 6>) == 2 && sizeof(Fixed<12, 12>) == 4 && sizeof(Fixed<20, 40>) == 8);
+
+/// @brief Multiply and divide results for one rounding mode of `Fixed<8, 1>` and `Fixed<8, 0>`.
+template<FixedRounding Rounding>
+constexpr bool checkRounding(double product, double negativeProduct, int quotient, int negativeQuotient, double quarter, double negativeQuarter)
+{
+    using Half = Fixed<8, 1, Rounding>;
+    using Whole = Fixed<8, 0, Rounding>;
+
+    return (Half(1.5) * Half(1.5) == product) && (Half(-1.5) * Half(1.5) == negativeProduct)
+        && (Whole(7) / Whole(2) == quotient) && (Whole(-7) / Whole(2) == negativeQuotient)
+        && (Half(0.25) == quarter) && (Half(-0.25) == negativeQuarter);
+}
+
+static_assert(checkRounding<FixedRounding::TRUNCATE>(2.0, -2.0, 3, -3, 0.0, 0.0));
+static_assert(checkRounding<FixedRounding::FLOOR>(2.0, -2.5, 3, -4, 0.0, -0.5));
+static_assert(checkRounding<FixedRounding::NEAREST>(2.5, -2.5, 4, -4, 0.5, -0.5));
+static_assert(checkRounding<FixedRounding::NEAREST_EVEN>(2.0, -2.0, 4, -4, 0.0, 0.0));
+
+constexpr bool checkConstexpr()
+{
+    using Q16 = Fixed<16, 16>;
+    using Q32 = Fixed<32, 32>;
+
+    Q16 price = 12.25;
+    price *= 4;
+    price -= 0.5;
+    price /= 2;
+
+    Q32 wide = 3;
+    wide = wide / 7 * 7;
+
+    return (price == 24.25) && (static_cast<int>(Q16(-1.75)) == -1) && (Q16(1.5) > 1) && (Q16(1.5) < 2) && (Q16(2) == 2)
+        && easyMath::willAddOverflow<Q16>(Q16::max(), Q16::epsilon()) && !easyMath::willAddOverflow<Q16>(Q16::max(), -Q16::epsilon())
+        && easyMath::willSubtractUnderflow<Q16>(Q16::lowest(), Q16::epsilon())
+        && (Q16::max() + Q16::epsilon() == Q16::lowest()) && (Fixed<12, 12>::max() + Fixed<12, 12>::epsilon() == Fixed<12, 12>::lowest())
+        && (Q16(40000.0) == Q16::max()) && (wide > 2.999999999) && (wide < 3.000000001)
+        && (std::numeric_limits<Q16>::epsilon().raw() == 1) && (std::numeric_limits<Q16>::round_error().raw() == 0x8000);
+}
+
+static_assert(checkConstexpr());
+
+/**
+ * @brief Exact `numerator / denominator` rounded by `Rounding`.
+ */
+template<FixedRounding Rounding>
+easyMath::BuiltinInt128 referenceDivide(easyMath::BuiltinInt128 numerator, easyMath::BuiltinInt128 denominator)
+{
+    if(denominator < 0)
+    {
+        numerator = -numerator;
+        denominator = -denominator;
+    }
+
+    easyMath::BuiltinInt128 quotient = numerator / denominator, remainder = numerator % denominator;
+    easyMath::BuiltinInt128 floor = quotient - (remainder < 0), floorRemainder = (remainder < 0) ? remainder + denominator : remainder;
+
+    switch(Rounding)
+    {
+    case FixedRounding::TRUNCATE: return quotient;
+    case FixedRounding::FLOOR: return floor;
+    case FixedRounding::NEAREST: return floor + ((2 * floorRemainder > denominator) || ((2 * floorRemainder == denominator) && (numerator >= 0)));
+    default: return floor + ((2 * floorRemainder > denominator) || ((2 * floorRemainder == denominator) && (floor & 1)));
+    }
+}
+
+/// @brief Wrap reference result to the fixed point bits.
+template<class FixedType>
+typename FixedType::RawType referenceWrap(easyMath::BuiltinInt128 value)
+{
+    constexpr int UNUSED = 64 - static_cast<int>(FixedType::bitSize());
+    auto low = static_cast<std::int64_t>(static_cast<std::uint64_t>(value) << UNUSED) >> UNUSED;
+    return static_cast<typename FixedType::RawType>(low);
+}
+
+template<class FixedType>
+FixedType randomFixed(std::mt19937_64& rng)
+{
+    using RawType = typename FixedType::RawType;
+
+    // edges, small values, powers of two (exact rounding ties) and full range.
+    switch(rng() % 5)
+    {
+    case 0: return (rng() % 2) ? FixedType::max() : FixedType::lowest();
+    case 1: return FixedType::fromRaw(static_cast<RawType>(static_cast<std::int64_t>(rng() % 2001) - 1000));
+    case 2: return FixedType::fromRaw(static_cast<RawType>(std::int64_t{1} << (rng() % (FixedType::bitSize() - 1))));
+    default: return FixedType::fromRaw(static_cast<RawType>(rng()));
+    }
+}
+
+template<class FixedType>
+bool checkOperations(std::mt19937_64& rng)
+{
+    constexpr auto FRAC_BITS = FixedType::FRAC_BITS;
+    bool pass = true;
+
+    for(std::size_t trial = 0; trial < 20000; ++trial)
+    {
+        auto lhs = randomFixed<FixedType>(rng), rhs = randomFixed<FixedType>(rng);
+
+        easyMath::BuiltinInt128 product = static_cast<easyMath::BuiltinInt128>(lhs.raw()) * rhs.raw();
+        pass = pass && ((lhs * rhs).raw() == referenceWrap<FixedType>(referenceDivide<FixedType::ROUNDING>(product, easyMath::BuiltinInt128{1} << FRAC_BITS)));
+
+        if(rhs.raw() != 0)
+        {
+            easyMath::BuiltinInt128 dividend = static_cast<easyMath::BuiltinInt128>(lhs.raw()) * (easyMath::BuiltinInt128{1} << FRAC_BITS);
+            pass = pass && ((lhs / rhs).raw() == referenceWrap<FixedType>(referenceDivide<FixedType::ROUNDING>(dividend, rhs.raw())));
+        }
+
+        easyMath::BuiltinInt128 sum = static_cast<easyMath::BuiltinInt128>(lhs.raw()) + rhs.raw();
+        pass = pass && ((lhs + rhs).raw() == referenceWrap<FixedType>(sum));
+        pass = pass && (easyMath::willAddOverflow<FixedType>(lhs, rhs) == (sum > FixedType::max().raw()));
+    }
+
+    return pass;
+}
+
+template<class FixedType>
+bool checkKernels(std::mt19937_64& rng)
+{
+    bool pass = true;
+
+    for(std::size_t size : {std::size_t{0}, std::size_t{7}, std::size_t{37}, std::size_t{1000}})
+    {
+        std::vector<FixedType> lhs(size), rhs(size), result(size);
+        for(std::size_t i = 0; i < size; ++i)
+        {
+            lhs[i] = randomFixed<FixedType>(rng);
+            do
+                rhs[i] = randomFixed<FixedType>(rng);
+            while(rhs[i].raw() == 0);
+        }
+
+        easyMath::fixedMultiply<FixedType>(lhs, rhs, result);
+        for(std::size_t i = 0; i < size; ++i)
+            pass = pass && (result[i] == lhs[i] * rhs[i]);
+
+        easyMath::fixedDivide<FixedType>(lhs, rhs, result);
+        for(std::size_t i = 0; i < size; ++i)
+            pass = pass && (result[i] == lhs[i] / rhs[i]);
+
+        easyMath::fixedAdd<FixedType>(lhs, rhs, result);
+        for(std::size_t i = 0; i < size; ++i)
+            pass = pass && (result[i] == lhs[i] + rhs[i]);
+
+        easyMath::fixedSubtract<FixedType>(lhs, rhs, result);
+        for(std::size_t i = 0; i < size; ++i)
+            pass = pass && (result[i] == lhs[i] - rhs[i]);
+    }
+
+    return pass;
+}
+
+template<std::size_t IntBits, std::size_t FracBits>
+bool checkAllRoundings(std::mt19937_64& rng)
+{
+    return checkOperations<Fixed<IntBits, FracBits, FixedRounding::TRUNCATE>>(rng) && checkKernels<Fixed<IntBits, FracBits, FixedRounding::TRUNCATE>>(rng)
+        && checkOperations<Fixed<IntBits, FracBits, FixedRounding::FLOOR>>(rng) && checkKernels<Fixed<IntBits, FracBits, FixedRounding::FLOOR>>(rng)
+        && checkOperations<Fixed<IntBits, FracBits, FixedRounding::NEAREST>>(rng) && checkKernels<Fixed<IntBits, FracBits, FixedRounding::NEAREST>>(rng)
+        && checkOperations<Fixed<IntBits, FracBits, FixedRounding::NEAREST_EVEN>>(rng) && checkKernels<Fixed<IntBits, FracBits, FixedRounding::NEAREST_EVEN>>(rng);
+}
+
+int main()
+{
+    auto rng = easyTest::seededEngine();
+
+    CHECK("Fixed 8 bit storage", (checkAllRoundings<4, 4>(rng)));
+    CHECK("Fixed 16 bit storage", (checkAllRoundings<8, 8>(rng) && checkAllRoundings<3, 10>(rng)));
+    CHECK("Fixed 32 bit storage", (checkAllRoundings<16, 16>(rng) && checkAllRoundings<12, 12>(rng) && checkAllRoundings<32, 0>(rng)));
+    CHECK("Fixed 64 bit storage", (checkAllRoundings<32, 32>(rng) && checkAllRoundings<20, 40>(rng) && checkAllRoundings<1, 63>(rng)));
+
+    return 0;
+}
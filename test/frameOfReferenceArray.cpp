@@ -0,0 +1,136 @@
+/**
+ * @file frameOfReferenceArray.cpp
+ * @author Harith Manoj
+ * @brief FrameOfReferenceArray test.
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (C) Harith Manoj
+ *
+ *
+ *                      APACHE LICENSE 2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <easyMathLib/FrameOfReferenceArray.h>
+
+#include "testSupport.h"
+
+/**
+ * @brief Mostly increasing sequence with occasional steps back, like a timestamp column.
+ */
+template<class UInt>
+std::vector<UInt> makeTimestamps(std::mt19937_64& rng, std::size_t size, std::uint64_t maxStep)
+{
+    std::vector<UInt> values(size);
+    UInt current = static_cast<UInt>(rng());
+
+    for(auto& value : values)
+    {
+        current = static_cast<UInt>(current + rng() % (maxStep + 1));
+        if(rng() % 500 == 0)
+            current = static_cast<UInt>(current - rng() % 1000);
+        value = current;
+    }
+
+    return values;
+}
+
+template<class UInt>
+bool checkRoundTrip(const std::vector<UInt>& values)
+{
+    easyMath::FrameOfReferenceArray<UInt> array(values);
+
+    bool pass = (array.size() == values.size()) && (array.decode() == values);
+
+    for(std::size_t i = 0; i < values.size(); i += 1 + values.size() / 50)
+        pass = pass && (array[i] == values[i]);
+
+    // random access to a single block, the last one may be partial.
+    std::vector<UInt> block(array.BLOCK_SIZE);
+    for(std::size_t b = 0; b < array.blockCount(); b += 1 + array.blockCount() / 7)
+    {
+        std::size_t count = array.decodeBlock(b, block);
+        pass = pass && std::equal(block.begin(), block.begin() + static_cast<std::ptrdiff_t>(count), values.begin() + static_cast<std::ptrdiff_t>(b * array.BLOCK_SIZE));
+    }
+
+    return pass;
+}
+
+template<class UInt>
+bool checkType(std::mt19937_64& rng)
+{
+    bool pass = true;
+
+    for(std::size_t size : {std::size_t{0}, std::size_t{1}, std::size_t{2}, std::size_t{127}, std::size_t{128}, std::size_t{129}, std::size_t{5000}})
+    {
+        std::vector<UInt> random(size), constant(size, static_cast<UInt>(rng())), decreasing(size);
+        for(std::size_t i = 0; i < size; ++i)
+        {
+            random[i] = static_cast<UInt>(rng());
+            decreasing[i] = static_cast<UInt>(~i);
+        }
+
+        pass = pass && checkRoundTrip(random) && checkRoundTrip(constant) && checkRoundTrip(decreasing)
+            && checkRoundTrip(makeTimestamps<UInt>(rng, size, 3)) && checkRoundTrip(makeTimestamps<UInt>(rng, size, 100000));
+    }
+
+    return pass;
+}
+
+int main()
+{
+    auto rng = easyTest::seededEngine();
+
+    CHECK("FrameOfReferenceArray 8 bit round trip", checkType<std::uint8_t>(rng));
+    CHECK("FrameOfReferenceArray 16 bit round trip", checkType<std::uint16_t>(rng));
+    CHECK("FrameOfReferenceArray 32 bit round trip", checkType<std::uint32_t>(rng));
+    CHECK("FrameOfReferenceArray 64 bit round trip", checkType<std::uint64_t>(rng));
+
+    // differences lie in [-999, 1000], so every block is at most 11 bits per value against 64 for any seed.
+    auto timestamps = makeTimestamps<std::uint64_t>(rng, 100000, 1000);
+    easyMath::FrameOfReferenceArray<std::uint64_t> compressed(timestamps);
+
+    bool isNarrow = true;
+    for(std::size_t b = 0; b < compressed.blockCount(); ++b)
+        isNarrow = isNarrow && (compressed.blockWidth(b) <= 11);
+
+    CHECK("FrameOfReferenceArray timestamps with steps back stay delta coded", isNarrow && (compressed.decode() == timestamps));
+    CHECK("FrameOfReferenceArray timestamps compress over 5x", compressed.byteSize() * 5 < timestamps.size() * sizeof(std::uint64_t));
+
+    // a single step back in every block costs one bit, not a fall back to frame of reference.
+    std::vector<std::uint32_t> sawtooth(4096);
+    std::uint32_t current = 1000000;
+    for(std::size_t i = 0; i < sawtooth.size(); ++i)
+    {
+        current = (i % 128 == 64) ? current - 2 : current + 3;
+        sawtooth[i] = current;
+    }
+
+    easyMath::FrameOfReferenceArray<std::uint32_t> stepBack(sawtooth);
+    CHECK("FrameOfReferenceArray step back keeps delta width", (stepBack.blockWidth(1) <= 3) && (stepBack.decode() == sawtooth));
+
+    // ids with constant stride need no residual bits.
+    std::vector<std::uint32_t> ids(1000);
+    for(std::size_t i = 0; i < ids.size(); ++i)
+        ids[i] = static_cast<std::uint32_t>(7 * i + 11);
+
+    easyMath::FrameOfReferenceArray<std::uint32_t> strided(ids);
+    CHECK("FrameOfReferenceArray constant stride has zero width", (strided.blockWidth(0) == 0) && (strided.decode() == ids));
+}
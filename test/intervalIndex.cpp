@@ -0,0 +1,126 @@
+/**
+ * @file intervalIndex.cpp
+ * @author Harith Manoj
+ * @brief Eytzinger interval lookup and bucketization test against a linear valueBetweenInclusive scan.
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (C) Harith Manoj
+ *
+ *
+ *                      APACHE LICENSE 2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <easyMathLib/IntervalIndex.h>
+
+#include "testSupport.h"
+
+constexpr bool checkConstexprIndex()
+{
+    int lowers[] = {0, 10, 20, 35};
+    int uppers[] = {5, 19, 30, 35};
+    easyMath::IntervalIndex<int> index(lowers, uppers);
+
+    return (index.find(-1) == index.NO_BUCKET) && (index.find(3) == 0) && (index.find(7) == index.NO_BUCKET) && (index.find(10) == 1)
+        && (index.find(19) == 1) && (index.find(20) == 2) && (index.find(35) == 3) && (index.find(36) == index.NO_BUCKET)
+        && (index.lower(2) == 20) && (index.upper(2) == 30);
+}
+
+static_assert(checkConstexprIndex());
+static_assert(easyMath::IntervalIndex<int>().find(0) == easyMath::IntervalIndex<int>::NO_BUCKET);
+
+/// @brief Reference linear scan.
+template<class T>
+std::uint32_t linearFind(const std::vector<T>& lowers, const std::vector<T>& uppers, T value)
+{
+    for(std::size_t i = 0; i < lowers.size(); ++i)
+        if(easyMath::valueBetweenInclusive(value, lowers[i], uppers[i]))
+            return static_cast<std::uint32_t>(i);
+    return easyMath::IntervalIndex<T>::NO_BUCKET;
+}
+
+template<class T>
+bool checkIndex(std::mt19937_64& rng, std::size_t intervals)
+{
+    bool pass = true;
+
+    // random widths and gaps (including adjacent intervals and single points).
+    std::vector<T> lowers, uppers;
+    T bound = static_cast<T>(rng() % 5);
+    for(std::size_t i = 0; i < intervals; ++i)
+    {
+        lowers.push_back(bound);
+        uppers.push_back(static_cast<T>(bound + static_cast<T>(rng() % 4)));
+        bound = static_cast<T>(uppers.back() + 1 + static_cast<T>(rng() % 3));
+    }
+
+    easyMath::IntervalIndex<T> index(lowers, uppers);
+    pass = pass && (index.bucketCount() == intervals);
+
+    for(std::size_t i = 0; i < intervals; ++i)
+        pass = pass && (index.lower(static_cast<std::uint32_t>(i)) == lowers[i]) && (index.upper(static_cast<std::uint32_t>(i)) == uppers[i]);
+
+    std::vector<T> values(1000 + intervals % 17);
+    for(auto& value : values)
+        value = static_cast<T>(static_cast<T>(rng() % static_cast<std::uint64_t>(bound + 4)) - 2);
+
+    std::vector<std::uint32_t> buckets(values.size()), histogramBuckets(values.size());
+    std::vector<std::size_t> histogram(intervals + 1), countsOnly(intervals + 1), reference(intervals + 1);
+
+    auto count = index.bucketize(values, buckets);
+    pass = pass && (index.bucketize(values, histogramBuckets, histogram) == count) && (histogramBuckets == buckets);
+    index.histogram(values, countsOnly);
+
+    std::size_t referenceCount = 0;
+    for(std::size_t i = 0; i < values.size(); ++i)
+    {
+        auto expected = linearFind(lowers, uppers, values[i]);
+        pass = pass && (index.find(values[i]) == expected) && (buckets[i] == expected) && (index.contains(values[i]) == (expected != index.NO_BUCKET));
+
+        referenceCount += (expected != index.NO_BUCKET);
+        ++reference[std::min<std::size_t>(expected, intervals)];
+    }
+
+    return pass && (count == referenceCount) && (histogram == reference) && (countsOnly == reference);
+}
+
+bool checkFloatingPoint()
+{
+    std::vector<double> lowers = {-1.5, 0.0, 2.25}, uppers = {-0.5, 1.0, 1e9};
+    easyMath::IntervalIndex<double> index(lowers, uppers);
+
+    return (index.find(-1.0) == 0) && (index.find(-0.25) == index.NO_BUCKET) && (index.find(1.0) == 1) && (index.find(3.0) == 2)
+        && (index.find(std::numeric_limits<double>::quiet_NaN()) == index.NO_BUCKET);
+}
+
+int main()
+{
+    auto rng = easyTest::seededEngine();
+
+    bool pass = true;
+    for(std::size_t intervals : {0, 1, 2, 3, 7, 8, 15, 16, 17, 100, 1000, 4095, 4096, 5000})
+        pass = pass && checkIndex<std::int32_t>(rng, intervals) && checkIndex<std::uint64_t>(rng, intervals);
+
+    CHECK("find / bucketize / histogram match linear scan", pass);
+    CHECK("16 bit bounds", checkIndex<std::int16_t>(rng, 3000));
+    CHECK("floating point bounds", checkFloatingPoint());
+
+    return 0;
+}
@@ -0,0 +1,157 @@
+/**
+ * @file invariantDivider.cpp
+ * @author Harith Manoj
+ * @brief InvariantDivider test.
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (C) Harith Manoj
+ *
+ *
+ *                      APACHE LICENSE 2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#include <iostream>
+#include <random>
+#include <limits>
+#include <vector>
+#include <type_traits>
+
+#include <easyMathLib/InvariantDivider.h>
+
+#include "testSupport.h"
+
+static_assert(easyMath::InvariantDivider<std::uint32_t>(7).divide(100) == 14);
+static_assert(easyMath::InvariantDivider<std::int32_t>(-7).divide(100) == -14);
+static_assert(easyMath::InvariantDivider<std::int64_t>(7).modulo(-100) == -2);
+static_assert(easyMath::divideRoundUp<std::uint64_t>(4097, easyMath::InvariantDivider<std::uint64_t>(4096)) == 2);
+
+template<class Integer>
+bool checkOne(const easyMath::InvariantDivider<Integer>& divider, Integer numerator)
+{
+    Integer divisor = divider.divisor();
+
+    // lowest / -1 is undefined for builtin division.
+    if constexpr (std::is_signed_v<Integer>)
+        if((divisor == -1) && (numerator == std::numeric_limits<Integer>::lowest()))
+            return true;
+
+    return (divider.divide(numerator) == static_cast<Integer>(numerator / divisor))
+        && (divider.modulo(numerator) == static_cast<Integer>(numerator % divisor))
+        && (divider.divideRoundUp(numerator) == easyMath::divideRoundUp<Integer>(numerator, divisor));
+}
+
+template<class Integer>
+Integer randomValue(std::mt19937_64& rng)
+{
+    // random magnitude so small values are exercised as often as large ones.
+    auto value = static_cast<Integer>(rng() >> (rng() % 64));
+    return (rng() & 1) ? value : static_cast<Integer>(~value);
+}
+
+template<class Integer>
+void checkExhaustive()
+{
+    bool pass = true;
+
+    for(int d = std::numeric_limits<Integer>::lowest(); d <= std::numeric_limits<Integer>::max(); ++d)
+    {
+        if(d == 0)
+            continue;
+
+        easyMath::InvariantDivider<Integer> divider(static_cast<Integer>(d));
+        for(int n = std::numeric_limits<Integer>::lowest(); n <= std::numeric_limits<Integer>::max(); ++n)
+            pass = pass && checkOne<Integer>(divider, static_cast<Integer>(n));
+    }
+
+    std::cout << (pass ? "PASS " : "FAIL ") << sizeof(Integer) << " byte " << (std::is_signed_v<Integer> ? "signed" : "unsigned")
+        << " exhaustive\n";
+}
+
+template<class Integer>
+void checkRandom(std::mt19937_64& rng)
+{
+    bool pass = true;
+    constexpr auto lowest = std::numeric_limits<Integer>::lowest(), max = std::numeric_limits<Integer>::max();
+
+    std::vector<Integer> divisors = {1, 2, 3, 7, max, static_cast<Integer>(max - 1), static_cast<Integer>(max / 2 + 1)};
+    if constexpr (std::is_signed_v<Integer>)
+        divisors.insert(divisors.end(), {-1, -2, -3, -7, lowest, static_cast<Integer>(lowest + 1)});
+
+    for(std::size_t i = 0; i < 1000; ++i)
+        if(auto d = randomValue<Integer>(rng); d != 0)
+            divisors.push_back(d);
+
+    std::vector<Integer> numerators(1000), quotients(1000), remainders(1000), roundUps(1000);
+
+    for(auto d : divisors)
+    {
+        easyMath::InvariantDivider<Integer> divider(d);
+
+        for(auto& n : numerators)
+            n = randomValue<Integer>(rng);
+        numerators[0] = 0;
+        numerators[1] = lowest;
+        numerators[2] = max;
+        numerators[3] = d;
+        numerators[4] = static_cast<Integer>(static_cast<std::make_unsigned_t<Integer>>(d) - 1u);
+
+        for(auto n : numerators)
+            pass = pass && checkOne<Integer>(divider, n);
+
+        if constexpr (std::is_signed_v<Integer>)
+            if(d == -1)
+                numerators[1] = 0;
+
+        // odd length leaves a scalar tail after the vector blocks, every tier runs its own kernel.
+        std::span<const Integer> input(numerators.data(), numerators.size() - 3);
+
+        pass = easyTest::atEveryCpuTier([&]()
+        {
+            divider.divide(input, quotients);
+            divider.modulo(input, remainders);
+            divider.divideRoundUp(input, roundUps);
+
+            bool isSame = true;
+            for(std::size_t j = 0; j < input.size(); ++j)
+                isSame = isSame && (quotients[j] == divider.divide(input[j]))
+                    && (remainders[j] == divider.modulo(input[j]))
+                    && (roundUps[j] == divider.divideRoundUp(input[j]));
+
+            return isSame;
+        }) && pass;
+    }
+
+    std::cout << (pass ? "PASS " : "FAIL ") << sizeof(Integer) << " byte " << (std::is_signed_v<Integer> ? "signed" : "unsigned")
+        << " random and span\n";
+}
+
+int main()
+{
+    auto rng = easyTest::seededEngine();
+
+    checkExhaustive<std::int8_t>();
+    checkExhaustive<std::uint8_t>();
+
+    checkRandom<std::int8_t>(rng);
+    checkRandom<std::uint8_t>(rng);
+    checkRandom<std::int16_t>(rng);
+    checkRandom<std::uint16_t>(rng);
+    checkRandom<std::int32_t>(rng);
+    checkRandom<std::uint32_t>(rng);
+    checkRandom<std::int64_t>(rng);
+    checkRandom<std::uint64_t>(rng);
+}
@@ -0,0 +1,154 @@
+/**
+ * @file montgomeryContext.cpp
+ * @author Harith Manoj
+ * @brief 128 bit multiply / divide primitives, __int128 traits and Montgomery modular arithmetic test.
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (C) Harith Manoj
+ *
+ *
+ *                      APACHE LICENSE 2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#include <iostream>
+#include <random>
+
+#include <easyMathLib/MontgomeryContext.h>
+
+#include "testSupport.h"
+
+static_assert(easyMath::multiplyHigh64(~std::uint64_t{0}, ~std::uint64_t{0}) == ~std::uint64_t{0} - 1);
+static_assert(easyMath::multiplyHighSigned64(-1, 1) == -1 && easyMath::multiplyHighSigned64(-1, -1) == 0);
+static_assert(easyMath::multiplyHighSigned64(INT64_MIN, INT64_MIN) == (std::int64_t{1} << 62));
+
+constexpr bool checkConstexprDivide()
+{
+    std::uint64_t remainder = 0;
+    auto quotient = easyMath::divideFull64(6, 7, 10, remainder);
+
+    // (6 * 2^64 + 7) = 10 * 11068046444225730970 + 3.
+    return (quotient == 11068046444225730970ull) && (remainder == 3);
+}
+
+static_assert(checkConstexprDivide());
+
+#if defined(__SIZEOF_INT128__)
+static_assert(easyMath::SignedIntegral<easyMath::BuiltinInt128> && easyMath::UnsignedIntegral<easyMath::BuiltinUInt128>);
+static_assert(easyMath::bitSize<easyMath::BuiltinInt128>() == 128 && easyMath::bitSize<easyMath::BuiltinUInt128>() == 128);
+static_assert(easyMath::NumericTraits<easyMath::BuiltinUInt128>::max() == ~static_cast<easyMath::BuiltinUInt128>(0));
+static_assert(easyMath::NumericTraits<easyMath::BuiltinInt128>::lowest() < 0 && easyMath::NumericTraits<easyMath::BuiltinInt128>::digits == 127);
+static_assert(easyMath::willAddOverflow<easyMath::BuiltinUInt128>(easyMath::NumericTraits<easyMath::BuiltinUInt128>::max(), 1));
+static_assert(easyMath::willAddOverflow<easyMath::BuiltinInt128>(easyMath::NumericTraits<easyMath::BuiltinInt128>::max(), 1));
+static_assert(!easyMath::willAddOverflow<easyMath::BuiltinInt128>(easyMath::NumericTraits<easyMath::BuiltinInt128>::max(), -1));
+static_assert(easyMath::nBitMask<easyMath::BuiltinUInt128>(100) == (static_cast<easyMath::BuiltinUInt128>(1) << 100) - 1);
+#endif
+
+static_assert(easyMath::MontgomeryContext<std::uint32_t>(1000000007u).powerModulo(3, 1000000006) == 1);
+static_assert(easyMath::MontgomeryContext<std::uint64_t>(0xffffffffffffffc5ull).powerModulo(5, 0xffffffffffffffc4ull) == 1);
+static_assert(easyMath::MontgomeryContext<std::uint64_t>(1).multiplyModulo(5, 7) == 0);
+
+/// @brief Random value, biased towards edges.
+std::uint64_t randomValue(std::mt19937_64& rng)
+{
+    switch(rng() % 4)
+    {
+    case 0: return ~std::uint64_t{0} - rng() % 4;
+    case 1: return rng() % 8;
+    default: return rng() >> (rng() % 64);
+    }
+}
+
+bool checkPrimitives(std::mt19937_64& rng)
+{
+    bool pass = true;
+
+    for(std::size_t trial = 0; trial < 100000; ++trial)
+    {
+        std::uint64_t lhs = randomValue(rng), rhs = randomValue(rng);
+        auto product = static_cast<easyMath::BuiltinUInt128>(lhs) * rhs;
+
+        std::uint64_t high = 0;
+        pass = pass && (easyMath::multiplyFull64(lhs, rhs, high) == static_cast<std::uint64_t>(product)) && (high == static_cast<std::uint64_t>(product >> 64));
+        pass = pass && (easyMath::multiplyHigh64(lhs, rhs) == high);
+
+        auto signedProduct = static_cast<easyMath::BuiltinInt128>(static_cast<std::int64_t>(lhs)) * static_cast<std::int64_t>(rhs);
+        pass = pass && (easyMath::multiplyHighSigned64(static_cast<std::int64_t>(lhs), static_cast<std::int64_t>(rhs)) == static_cast<std::int64_t>(signedProduct >> 64));
+
+        std::uint64_t divisor = randomValue(rng) | 1, dividendHigh = randomValue(rng) % divisor, remainder = 0;
+        auto dividend = (static_cast<easyMath::BuiltinUInt128>(dividendHigh) << 64) | lhs;
+        pass = pass && (easyMath::divideFull64(dividendHigh, lhs, divisor, remainder) == static_cast<std::uint64_t>(dividend / divisor));
+        pass = pass && (remainder == static_cast<std::uint64_t>(dividend % divisor));
+    }
+
+    return pass;
+}
+
+/// @brief Reference `base ^ exponent mod modulus`.
+std::uint64_t referencePower(std::uint64_t base, std::uint64_t exponent, std::uint64_t modulus)
+{
+    easyMath::BuiltinUInt128 result = 1 % modulus, square = base % modulus;
+
+    for(; exponent != 0; exponent >>= 1)
+    {
+        if(exponent & 1)
+            result = result * square % modulus;
+        square = square * square % modulus;
+    }
+
+    return static_cast<std::uint64_t>(result);
+}
+
+template<class UInt>
+bool checkMontgomery(std::mt19937_64& rng)
+{
+    bool pass = true;
+
+    for(std::size_t moduli = 0; moduli < 200; ++moduli)
+    {
+        auto modulus = static_cast<UInt>(randomValue(rng) | 1);
+        easyMath::MontgomeryContext<UInt> context(modulus);
+
+        for(std::size_t trial = 0; trial < 200; ++trial)
+        {
+            auto lhs = static_cast<UInt>(randomValue(rng)), rhs = static_cast<UInt>(randomValue(rng));
+            std::uint64_t exponent = randomValue(rng);
+
+            auto product = static_cast<UInt>(static_cast<easyMath::BuiltinUInt128>(lhs) * rhs % modulus);
+            pass = pass && (context.multiplyModulo(lhs, rhs) == product);
+            pass = pass && (context.powerModulo(lhs, exponent) == referencePower(lhs, exponent, modulus));
+
+            auto montgomeryLhs = context.toMontgomery(lhs), montgomeryRhs = context.toMontgomery(rhs);
+            pass = pass && (context.fromMontgomery(montgomeryLhs) == lhs % modulus);
+            pass = pass && (context.fromMontgomery(context.multiply(montgomeryLhs, montgomeryRhs)) == product);
+            pass = pass && (context.fromMontgomery(context.add(montgomeryLhs, montgomeryRhs)) == static_cast<UInt>((static_cast<easyMath::BuiltinUInt128>(lhs % modulus) + rhs % modulus) % modulus));
+            pass = pass && (context.subtract(lhs % modulus, rhs % modulus) == static_cast<UInt>((static_cast<easyMath::BuiltinUInt128>(lhs % modulus) + modulus - rhs % modulus) % modulus));
+        }
+    }
+
+    return pass;
+}
+
+int main()
+{
+    auto rng = easyTest::seededEngine();
+
+    CHECK("multiply high / full / divide 128 bit", checkPrimitives(rng));
+    CHECK("Montgomery 32 bit matches reference", checkMontgomery<std::uint32_t>(rng));
+    CHECK("Montgomery 64 bit matches reference", checkMontgomery<std::uint64_t>(rng));
+
+    return 0;
+}
@@ -0,0 +1,141 @@
+/**
+ * @file morton.cpp
+ * @author Harith Manoj
+ * @brief Morton encode / decode test.
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (C) Harith Manoj
+ *
+ *
+ *                      APACHE LICENSE 2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <easyMathLib/morton.h>
+
+#include "testSupport.h"
+
+static_assert(std::is_same_v<easyMath::MortonCode<std::uint8_t, 2>, std::uint16_t>);
+static_assert(std::is_same_v<easyMath::MortonCode<std::uint16_t, 3>, std::uint64_t>);
+static_assert(std::is_same_v<easyMath::MortonCode<std::uint32_t, 3>, easyMath::UInt128>);
+static_assert(std::is_same_v<easyMath::MortonCode<std::uint64_t, 3>, easyMath::WideUInt<192>>);
+
+static_assert(easyMath::mortonEncode2<std::uint8_t>(0b11, 0b01) == 0b0111);
+static_assert(easyMath::mortonEncode3<std::uint8_t>(0b10, 0b01, 0b11) == 0b101110);
+static_assert(easyMath::mortonDecode3<std::uint16_t>(easyMath::mortonEncode3<std::uint16_t>(0xffff, 0x1234, 0x8001))
+    == std::array<std::uint16_t, 3>{0xffff, 0x1234, 0x8001});
+static_assert(easyMath::mortonDecode2<std::uint64_t>(easyMath::mortonEncode2<std::uint64_t>(~0ull, 0x0123456789abcdefull))
+    == std::array<std::uint64_t, 2>{~0ull, 0x0123456789abcdefull});
+
+/**
+ * @brief Bit by bit reference interleave into limbs.
+ */
+template<class Coordinate, std::size_t Dimensions>
+std::vector<std::uint64_t> referenceEncode(const std::array<Coordinate, Dimensions>& coordinates)
+{
+    std::vector<std::uint64_t> limbs((easyMath::bitSize<Coordinate>() * Dimensions + 63) / 64, 0);
+
+    for(std::size_t bit = 0; bit < easyMath::bitSize<Coordinate>(); ++bit)
+        for(std::size_t d = 0; d < Dimensions; ++d)
+        {
+            std::size_t position = bit * Dimensions + d;
+            limbs[position / 64] |= static_cast<std::uint64_t>(easyMath::extractBits<Coordinate>(coordinates[d], bit, 1)) << (position % 64);
+        }
+
+    return limbs;
+}
+
+/**
+ * @brief Code as limbs for comparison against reference.
+ */
+template<class Code>
+std::vector<std::uint64_t> toLimbs(const Code& code)
+{
+    if constexpr (std::is_integral_v<Code>)
+        return {static_cast<std::uint64_t>(code)};
+    else
+        return std::vector<std::uint64_t>(code.limbs().begin(), code.limbs().end());
+}
+
+template<class Coordinate>
+bool checkScalar(std::mt19937_64& rng)
+{
+    bool pass = true;
+
+    for(std::size_t i = 0; i < 2000; ++i)
+    {
+        auto x = static_cast<Coordinate>(rng()), y = static_cast<Coordinate>(rng()), z = static_cast<Coordinate>(rng());
+
+        auto code2 = easyMath::mortonEncode2(x, y);
+        auto code3 = easyMath::mortonEncode3(x, y, z);
+
+        pass = pass && (toLimbs(code2) == referenceEncode<Coordinate, 2>({x, y}))
+            && (toLimbs(code3) == referenceEncode<Coordinate, 3>({x, y, z}))
+            && (easyMath::mortonDecode2<Coordinate>(code2) == std::array<Coordinate, 2>{x, y})
+            && (easyMath::mortonDecode3<Coordinate>(code3) == std::array<Coordinate, 3>{x, y, z});
+    }
+
+    return pass;
+}
+
+template<class Coordinate>
+bool checkSpan(std::mt19937_64& rng)
+{
+    constexpr std::size_t size = 1003;
+
+    std::vector<Coordinate> xs(size), ys(size), zs(size), outX(size), outY(size), outZ(size);
+    for(std::size_t i = 0; i < size; ++i)
+    {
+        xs[i] = static_cast<Coordinate>(rng());
+        ys[i] = static_cast<Coordinate>(rng());
+        zs[i] = static_cast<Coordinate>(rng());
+    }
+
+    std::vector<easyMath::MortonCode<Coordinate, 2>> codes2(size);
+    std::vector<easyMath::MortonCode<Coordinate, 3>> codes3(size);
+
+    easyMath::mortonEncode2<Coordinate>(xs, ys, codes2);
+    easyMath::mortonEncode3<Coordinate>(xs, ys, zs, codes3);
+
+    bool pass = true;
+    for(std::size_t i = 0; i < size; ++i)
+        pass = pass && (codes2[i] == easyMath::mortonEncode2(xs[i], ys[i])) && (codes3[i] == easyMath::mortonEncode3(xs[i], ys[i], zs[i]));
+
+    easyMath::mortonDecode2<Coordinate>(codes2, outX, outY);
+    pass = pass && (outX == xs) && (outY == ys);
+
+    easyMath::mortonDecode3<Coordinate>(codes3, outX, outY, outZ);
+    return pass && (outX == xs) && (outY == ys) && (outZ == zs);
+}
+
+int main()
+{
+    auto rng = easyTest::seededEngine();
+
+    CHECK("morton 8 bit against reference", checkScalar<std::uint8_t>(rng));
+    CHECK("morton 16 bit against reference", checkScalar<std::uint16_t>(rng));
+    CHECK("morton 32 bit against reference", checkScalar<std::uint32_t>(rng));
+    CHECK("morton 64 bit against reference", checkScalar<std::uint64_t>(rng));
+
+    CHECK("morton span 8 bit", checkSpan<std::uint8_t>(rng));
+    CHECK("morton span 16 bit", checkSpan<std::uint16_t>(rng));
+    CHECK("morton span 32 bit", checkSpan<std::uint32_t>(rng));
+    CHECK("morton span 64 bit", checkSpan<std::uint64_t>(rng));
+}
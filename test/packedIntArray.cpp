@@ -0,0 +1,139 @@
+/**
+ * @file packedIntArray.cpp
+ * @author Harith Manoj
+ * @brief PackedIntArray test.
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (C) Harith Manoj
+ *
+ *
+ *                      APACHE LICENSE 2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#include <iostream>
+#include <random>
+#include <vector>
+#include <numeric>
+#include <algorithm>
+
+#include <easyMathLib/PackedIntArray.h>
+
+#include "testSupport.h"
+
+static_assert(std::random_access_iterator<easyMath::PackedIntArray<13>::ConstIterator>);
+static_assert(std::is_same_v<easyMath::MaxCapablePackedIntArray<4095>, easyMath::PackedIntArray<12>>);
+static_assert(std::is_same_v<easyMath::MaxCapablePackedIntArray<0>, easyMath::PackedIntArray<1>>);
+static_assert(std::is_same_v<easyMath::PackedIntArray<13>::value_type, std::uint16_t>);
+
+constexpr bool checkConstexpr()
+{
+    easyMath::PackedIntArray<13> array = {1, 8191, 4096, 7};
+    array[1] = 5;
+    array.pushBack(8190);
+    return (array.size() == 5) && (array[0] == 1) && (array[1] == 5) && (array.get(4) == 8190)
+        && (array.wordCount(5) == 3);
+}
+
+static_assert(checkConstexpr());
+
+template<std::size_t Bits>
+bool checkWidth(std::mt19937_64& rng)
+{
+    using Array = easyMath::PackedIntArray<Bits>;
+    using Value = typename Array::value_type;
+
+    constexpr auto mask = easyMath::impl_detail_::PACKED_ELEMENT_MASK_<Bits>;
+
+    bool pass = true;
+
+    std::vector<Value> reference(1000);
+    for(auto& value : reference)
+        value = static_cast<Value>(rng() & mask);
+
+    Array array(reference);
+    pass = pass && (array.size() == reference.size()) && std::equal(array.begin(), array.end(), reference.begin());
+
+    // random overwrites must not disturb neighbours.
+    for(std::size_t i = 0; i < 5000; ++i)
+    {
+        std::size_t index = rng() % reference.size();
+        auto value = static_cast<Value>(rng());
+        array.set(index, value);
+        reference[index] = static_cast<Value>(value & mask);
+    }
+
+    for(std::size_t i = 0; i < reference.size(); ++i)
+        pass = pass && (array.get(i) == reference[i]);
+
+    // piecewise append equals bulk construction.
+    Array pieces;
+    for(std::size_t i = 0; i < reference.size(); )
+    {
+        std::size_t count = std::min<std::size_t>(rng() % 17, reference.size() - i);
+        if(rng() & 1)
+            pieces.append(std::span<const Value>(reference.data() + i, count));
+        else
+            for(std::size_t j = 0; j < count; ++j)
+                pieces.pushBack(reference[i + j]);
+        i += count;
+    }
+    pass = pass && (pieces == array);
+
+    // shrink then grow leaves zeroed elements.
+    pieces.resize(333);
+    pieces.resize(500);
+    for(std::size_t i = 333; i < 500; ++i)
+        pass = pass && (pieces[i] == 0);
+
+    pieces.resize(333);
+    pieces.append(std::span<const Value>(reference.data() + 333, 667));
+    pass = pass && (pieces == array);
+
+    // mutable iteration through proxies.
+    std::reverse(reference.begin(), reference.end());
+    for(std::size_t i = 0; i < array.size() / 2; ++i)
+    {
+        Value tmp = array[i];
+        array[i] = array[array.size() - 1 - i];
+        array[array.size() - 1 - i] = tmp;
+    }
+    pass = pass && std::equal(array.cbegin(), array.cend(), reference.begin());
+
+    auto view = array.view();
+    pass = pass && (view.size() == array.size()) && std::equal(view.begin(), view.end(), reference.begin())
+        && (view.words().size() == Array::wordCount(array.size()));
+
+    auto it = array.cbegin() + 10;
+    pass = pass && (*it == reference[10]) && (it[5] == reference[15]) && ((array.cend() - it) == static_cast<std::ptrdiff_t>(array.size() - 10));
+
+    return pass;
+}
+
+int main()
+{
+    auto rng = easyTest::seededEngine();
+
+    bool pass = [&]<std::size_t... I>(std::index_sequence<I...>)
+    {
+        return (checkWidth<I + 1>(rng) && ...);
+    }(std::make_index_sequence<64>{});
+
+    CHECK("PackedIntArray get / set / append / resize / iterate for widths 1 to 64", pass);
+
+    easyMath::MaxCapablePackedIntArray<6000> table(10, 5999);
+    CHECK("MaxCapablePackedIntArray fill", (table.words().size() == 4) && (std::accumulate(table.begin(), table.end(), 0u) == 59990u));
+}
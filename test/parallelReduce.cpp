@@ -0,0 +1,130 @@
+/**
+ * @file parallelReduce.cpp
+ * @author Harith Manoj
+ * @brief Parallel checked reduce / scan test.
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (C) Harith Manoj
+ *
+ *
+ *                      APACHE LICENSE 2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#include <iostream>
+#include <random>
+#include <vector>
+#include <limits>
+
+#include <easyMathLib/parallelReduce.h>
+
+#include "testSupport.h"
+
+/**
+ * @brief Values of one of several shapes: small, random walk, alternating near the bounds (every chunk needs the
+ * precise pass without overflowing), or small with one spike that overflows and comes back.
+ */
+template<class Integer>
+std::vector<Integer> makeValues(std::mt19937_64& rng, std::size_t size, int shape)
+{
+    std::vector<Integer> values(size);
+    constexpr Integer max = std::numeric_limits<Integer>::max();
+
+    for(std::size_t i = 0; i < size; ++i)
+    {
+        switch(shape)
+        {
+        case 0: values[i] = static_cast<Integer>(rng() % 4); break;
+        case 1: values[i] = static_cast<Integer>(static_cast<Integer>(rng() % 7) - 3); break;
+        case 2: values[i] = std::is_signed_v<Integer> ? static_cast<Integer>((i % 2 == 0) ? max / 3 * 2 : -(max / 3 * 2)) : static_cast<Integer>(i % 2); break;
+        default: values[i] = static_cast<Integer>(rng());
+        }
+    }
+
+    if((shape == 2) && (size > 10))
+    {
+        values[size / 2] = max;
+        values[size / 2 + 1] = static_cast<Integer>(-max);
+    }
+
+    return values;
+}
+
+template<class Integer>
+bool checkType(std::mt19937_64& rng)
+{
+    bool pass = true;
+
+    for(std::size_t size : {std::size_t{0}, std::size_t{1}, std::size_t{7}, std::size_t{100}, std::size_t{3 * 65536 + 5}})
+        for(int shape = 0; shape < 4; ++shape)
+        {
+            auto values = makeValues<Integer>(rng, size, shape);
+
+            // sequential sticky overflow reference.
+            std::vector<Integer> inclusive(size), exclusive(size);
+            easyMath::Checked<Integer> sum = 0;
+            bool exclusiveOverflow = false;
+
+            for(std::size_t i = 0; i < size; ++i)
+            {
+                exclusive[i] = sum.value();
+                exclusiveOverflow = sum.hasOverflowed();
+                sum += values[i];
+                inclusive[i] = sum.value();
+            }
+
+            for(std::size_t threads : {std::size_t{1}, std::size_t{2}, std::size_t{3}, std::size_t{0}})
+            {
+                easyMath::ReduceOptions options{threads};
+
+                auto reduced = easyMath::reduceChecked<Integer>(values, options);
+                pass = pass && (reduced.value() == sum.value()) && (reduced.hasOverflowed() == sum.hasOverflowed());
+
+                std::vector<Integer> result(size);
+                pass = pass && (easyMath::inclusiveScanChecked<Integer>(values, result, options) == sum.hasOverflowed()) && (result == inclusive);
+                pass = pass && (easyMath::exclusiveScanChecked<Integer>(values, result, options) == exclusiveOverflow) && (result == exclusive);
+
+                // in place.
+                result = values;
+                pass = pass && (easyMath::exclusiveScanChecked<Integer>(result, result, options) == exclusiveOverflow) && (result == exclusive);
+            }
+        }
+
+    return pass;
+}
+
+constexpr bool checkConstexprPrefixSum()
+{
+    std::uint32_t values[] = {1, 2, 3, 4};
+    std::uint32_t result[4] = {};
+
+    auto total = easyMath::impl_detail_::prefixSum_<true, std::uint32_t>(values, result, 10, 1);
+    return (total == 24) && (result[0] == 10) && (result[1] == 12) && (result[2] == 15) && (result[3] == 19);
+}
+
+static_assert(checkConstexprPrefixSum());
+
+int main()
+{
+    auto rng = easyTest::seededEngine();
+
+    CHECK("reduce / scan 8 bit matches sequential, every tier", easyTest::atEveryCpuTier([&]() { return checkType<std::uint8_t>(rng) && checkType<std::int8_t>(rng); }));
+    CHECK("reduce / scan 16 bit matches sequential, every tier", easyTest::atEveryCpuTier([&]() { return checkType<std::uint16_t>(rng) && checkType<std::int16_t>(rng); }));
+    CHECK("reduce / scan 32 bit matches sequential, every tier", easyTest::atEveryCpuTier([&]() { return checkType<std::uint32_t>(rng) && checkType<std::int32_t>(rng); }));
+    CHECK("reduce / scan 64 bit matches sequential, every tier", easyTest::atEveryCpuTier([&]() { return checkType<std::uint64_t>(rng) && checkType<std::int64_t>(rng); }));
+
+    return 0;
+}
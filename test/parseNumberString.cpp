@@ -0,0 +1,252 @@
+/**
+ * @file parseNumberString.cpp
+ * @author Harith Manoj
+ * @brief parseNumberString / tryParseNumberString test, range limits, prefixes and error offsets at every CPU tier.
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (C) Harith Manoj
+ *
+ *
+ *                      APACHE LICENSE 2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <stdexcept>
+#include <algorithm>
+
+#include <easyParseLib/easyParse.h>
+#include <easyMathLib/WideUInt.h>
+
+#include "testSupport.h"
+
+using easyParse::ParseError;
+using easyParse::ParseErrorCode;
+
+static_assert(easyParse::parseNumberString<std::int8_t>("-128") == -128);
+static_assert(easyParse::parseNumberString<std::uint16_t>("0xffff") == 0xffff);
+static_assert(easyParse::tryParseNumberString<std::uint8_t>("256").error() == ParseError{ParseErrorCode::OUT_OF_RANGE, 2});
+static_assert(easyParse::tryParseNumberString<std::uint32_t>("-5").error() == ParseError{ParseErrorCode::OUT_OF_RANGE, 1});
+
+/// @brief Digit characters, index is the digit value.
+constexpr std::string_view DIGITS = "0123456789abcdef";
+
+/// @brief Digits of `value` in `base`, most significant first.
+template<class Magnitude>
+std::string toDigits(Magnitude value, unsigned base)
+{
+    std::string digits;
+
+    do
+    {
+        digits.push_back(DIGITS[static_cast<unsigned>(value % static_cast<Magnitude>(base))]);
+        value = value / static_cast<Magnitude>(base);
+    } while(value != static_cast<Magnitude>(0u));
+
+    std::reverse(digits.begin(), digits.end());
+    return digits;
+}
+
+/// @brief `digits + 1` in `base`, carries into a new leading digit.
+std::string incrementDigits(std::string digits, unsigned base)
+{
+    for(std::size_t i = digits.size(); i-- > 0;)
+    {
+        auto digit = DIGITS.find(digits[i]) + 1;
+
+        if(digit < base)
+        {
+            digits[i] = DIGITS[digit];
+            return digits;
+        }
+
+        digits[i] = '0';
+    }
+
+    return "1" + digits;
+}
+
+/// @brief `numberString` parses to `expected`, throwing and non throwing.
+template<class Integer>
+bool parsesTo(std::string_view numberString, Integer expected)
+{
+    auto result = easyParse::tryParseNumberString<Integer>(numberString);
+    return result.hasValue() && (*result == expected) && (easyParse::parseNumberString<Integer>(numberString) == expected);
+}
+
+/// @brief `numberString` fails with `expected`, the throwing form throws the exception type of its code.
+template<class Integer>
+bool failsWith(std::string_view numberString, ParseError expected)
+{
+    auto result = easyParse::tryParseNumberString<Integer>(numberString);
+    if(result.hasValue() || (result.error() != expected))
+        return false;
+
+    try
+    {
+        static_cast<void>(easyParse::parseNumberString<Integer>(numberString));
+    }
+    catch(const std::out_of_range&)
+    {
+        return expected.code == ParseErrorCode::OUT_OF_RANGE;
+    }
+    catch(const std::invalid_argument&)
+    {
+        return expected.code != ParseErrorCode::OUT_OF_RANGE;
+    }
+
+    return false;
+}
+
+/**
+ * @brief `lowest()` / `max()` parse, one past them is `OUT_OF_RANGE` at the last digit, in decimal, hex,
+ * octal and binary.
+ */
+template<class Integer>
+bool checkLimits()
+{
+    using Magnitude = easyParse::impl_detail_::ParseMagnitude_t<Integer>;
+
+    constexpr Integer max = easyMath::NumericTraits<Integer>::max();
+    constexpr Integer lowest = easyMath::NumericTraits<Integer>::lowest();
+
+    bool pass = true;
+
+    for(auto [base, prefix] : {std::pair<unsigned, std::string_view>{10, ""}, {16, "0x"}, {8, "0"}, {2, "0b"}})
+    {
+        auto maxString = std::string(prefix) + toDigits(static_cast<Magnitude>(max), base);
+        auto pastMax = std::string(prefix) + incrementDigits(toDigits(static_cast<Magnitude>(max), base), base);
+
+        pass = pass && parsesTo<Integer>(maxString, max)
+            && failsWith<Integer>(pastMax, {ParseErrorCode::OUT_OF_RANGE, pastMax.size() - 1});
+
+        if constexpr (easyMath::NumericTraits<Integer>::is_signed)
+        {
+            auto lowestDigits = toDigits(static_cast<Magnitude>(static_cast<Magnitude>(max) + 1u), base);
+            auto lowestString = "-" + std::string(prefix) + lowestDigits;
+            auto pastLowest = "-" + std::string(prefix) + incrementDigits(lowestDigits, base);
+
+            pass = pass && parsesTo<Integer>(lowestString, lowest)
+                && failsWith<Integer>(pastLowest, {ParseErrorCode::OUT_OF_RANGE, pastLowest.size() - 1})
+                && parsesTo<Integer>("-1", static_cast<Integer>(-1));
+        }
+        else
+        {
+            // only "-0" is in range, the first non zero digit is the offending one.
+            pass = pass && parsesTo<Integer>("-" + std::string(prefix) + "0", lowest)
+                && failsWith<Integer>("-" + std::string(prefix) + "1", {ParseErrorCode::OUT_OF_RANGE, 1 + prefix.size()})
+                && failsWith<Integer>("-" + std::string(prefix) + "0001", {ParseErrorCode::OUT_OF_RANGE, 4 + prefix.size()})
+                && failsWith<Integer>("-" + maxString, {ParseErrorCode::OUT_OF_RANGE, 1 + prefix.size()});
+        }
+    }
+
+    // leading zeros never count against the range.
+    auto padded = std::string(100, '0') + toDigits(static_cast<Magnitude>(max), 8);
+    pass = pass && parsesTo<Integer>(padded, max) && parsesTo<Integer>("-0", Integer{0}) && parsesTo<Integer>("0", Integer{0});
+
+    return pass;
+}
+
+/**
+ * @brief Empty strings, sign or prefix without digits, and the offset of invalid digits.
+ */
+template<class Integer>
+bool checkMalformed()
+{
+    return failsWith<Integer>("", {ParseErrorCode::EMPTY_STRING, 0})
+        && failsWith<Integer>("-", {ParseErrorCode::SIGN_ONLY, 1})
+        && failsWith<Integer>("0x", {ParseErrorCode::INVALID_DIGIT, 2})
+        && failsWith<Integer>("0X", {ParseErrorCode::INVALID_DIGIT, 2})
+        && failsWith<Integer>("0b", {ParseErrorCode::INVALID_DIGIT, 2})
+        && failsWith<Integer>("-0x", {ParseErrorCode::INVALID_DIGIT, 3})
+        && failsWith<Integer>("-0b", {ParseErrorCode::INVALID_DIGIT, 3})
+        && failsWith<Integer>("12a4", {ParseErrorCode::INVALID_DIGIT, 2})
+        && failsWith<Integer>("-12a4", {ParseErrorCode::INVALID_DIGIT, 3})
+        && failsWith<Integer>("0x1g", {ParseErrorCode::INVALID_DIGIT, 3})
+        && failsWith<Integer>("0b102", {ParseErrorCode::INVALID_DIGIT, 4})
+        && failsWith<Integer>("0128", {ParseErrorCode::INVALID_DIGIT, 3})
+        && failsWith<Integer>("1 ", {ParseErrorCode::INVALID_DIGIT, 1})
+        && failsWith<Integer>("--1", {ParseErrorCode::INVALID_DIGIT, 1})
+        && failsWith<Integer>("01234567012345670123456701234567z", {ParseErrorCode::INVALID_DIGIT, 32})
+        // a malformed string is reported as such even when its digits overflow first.
+        && failsWith<Integer>(std::string(200, '9') + "z", {ParseErrorCode::INVALID_DIGIT, 200})
+        && failsWith<Integer>("0x" + std::string(200, 'f') + "-", {ParseErrorCode::INVALID_DIGIT, 202});
+}
+
+/// @brief Range limits and malformed strings of `Integer`.
+template<class Integer>
+bool checkType()
+{
+    return checkLimits<Integer>() && checkMalformed<Integer>();
+}
+
+/**
+ * @brief Random values round trip through decimal and hex strings.
+ */
+template<class Integer>
+bool checkRandom(std::mt19937_64& rng)
+{
+    using Magnitude = easyParse::impl_detail_::ParseMagnitude_t<Integer>;
+
+    bool pass = true;
+
+    for(std::size_t i = 0; i < 2000; ++i)
+    {
+        auto value = static_cast<Integer>(rng() >> (rng() % 64));
+        bool isNegative = (value < Integer{0});
+        auto magnitude = isNegative ? static_cast<Magnitude>(Magnitude{0u} - static_cast<Magnitude>(value)) : static_cast<Magnitude>(value);
+        std::string sign = isNegative ? "-" : "";
+
+        pass = pass && parsesTo<Integer>(sign + toDigits(magnitude, 10), value) && parsesTo<Integer>(sign + "0x" + toDigits(magnitude, 16), value);
+    }
+
+    return pass;
+}
+
+int main()
+{
+    auto rng = easyTest::seededEngine();
+
+    CHECK("parseNumberString signed limits and malformed strings, every tier", easyTest::atEveryCpuTier([]()
+    {
+        return checkType<std::int8_t>() && checkType<std::int16_t>() && checkType<std::int32_t>() && checkType<std::int64_t>();
+    }));
+
+    CHECK("parseNumberString unsigned limits and malformed strings, every tier", easyTest::atEveryCpuTier([]()
+    {
+        return checkType<std::uint8_t>() && checkType<std::uint16_t>() && checkType<std::uint32_t>() && checkType<std::uint64_t>();
+    }));
+
+#if defined(__SIZEOF_INT128__)
+    CHECK("parseNumberString __int128 limits and malformed strings, every tier", easyTest::atEveryCpuTier([]()
+    {
+        return checkType<easyMath::BuiltinInt128>() && checkType<easyMath::BuiltinUInt128>();
+    }));
+#endif
+
+    CHECK("parseNumberString WideUInt<256> limits and malformed strings, every tier", easyTest::atEveryCpuTier([]()
+    {
+        return checkType<easyMath::UInt256>();
+    }));
+
+    CHECK("parseNumberString random values, every tier", easyTest::atEveryCpuTier([&]()
+    {
+        return checkRandom<std::int32_t>(rng) && checkRandom<std::uint32_t>(rng) && checkRandom<std::int64_t>(rng) && checkRandom<std::uint64_t>(rng);
+    }));
+}
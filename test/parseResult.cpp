@@ -0,0 +1,306 @@
+/**
+ * @file parseResult.cpp
+ * @author Harith Manoj
+ * @brief ParseResult / ParseError test, non throwing escape, text and argument parsing and the exceptions of their throwing forms.
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (C) Harith Manoj
+ *
+ *
+ *                      APACHE LICENSE 2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <stdexcept>
+#include <vector>
+#include <cstring>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include <easyParseLib/easyParse.h>
+#include <easyParseLib/ArgParser.h>
+
+#include "testSupport.h"
+
+using easyParse::ParseError;
+using easyParse::ParseErrorCode;
+using easyParse::ParseResult;
+
+static_assert(ParseResult<int>(5).hasValue() && (*ParseResult<int>(5) == 5) && (ParseResult<int>(5).valueOr(7) == 5));
+static_assert(!ParseResult<int>(ParseError{ParseErrorCode::INVALID_DIGIT, 3}).hasValue());
+static_assert(ParseResult<int>(ParseError{ParseErrorCode::INVALID_DIGIT, 3}).valueOr(7) == 7);
+static_assert(ParseResult<int>(ParseError{ParseErrorCode::INVALID_DIGIT, 3}).error() == ParseError{ParseErrorCode::INVALID_DIGIT, 3});
+static_assert(ParseError{ParseErrorCode::INVALID_DIGIT, 3} != ParseError{ParseErrorCode::INVALID_DIGIT, 4});
+static_assert(ParseError{ParseErrorCode::INVALID_DIGIT, 3} != ParseError{ParseErrorCode::OUT_OF_RANGE, 3});
+static_assert(ParseResult<void>().hasValue() && !ParseResult<void>(ParseError{ParseErrorCode::UNKNOWN_SWITCH, 1}).hasValue());
+static_assert(easyParse::tryConvertEscapedString("\\x41").value() == 'A');
+static_assert(easyParse::tryConvertEscapedString("\\").error() == ParseError{ParseErrorCode::MISSING_ESCAPE_VALUE, 1});
+
+/// @brief `parse` throws the exception type of `code`, `std::out_of_range` for `OUT_OF_RANGE` only.
+template<class Parse>
+bool throwsFor(Parse&& parse, ParseErrorCode code)
+{
+    try
+    {
+        parse();
+    }
+    catch(const std::out_of_range&)
+    {
+        return code == ParseErrorCode::OUT_OF_RANGE;
+    }
+    catch(const std::invalid_argument&)
+    {
+        return code != ParseErrorCode::OUT_OF_RANGE;
+    }
+
+    return false;
+}
+
+/**
+ * @brief Value / error access and the exception `ParseError::raise` throws for every code.
+ */
+bool checkResult()
+{
+    bool pass = true;
+
+    for(auto code = ParseErrorCode::EMPTY_STRING; code <= ParseErrorCode::INVALID_SWITCH_ARGUMENT; code = static_cast<ParseErrorCode>(static_cast<int>(code) + 1))
+    {
+        ParseResult<std::string> failed = ParseError{code, 3};
+        ParseResult<void> failedVoid = ParseError{code, 3};
+
+        pass = pass && !failed && !failed.hasValue() && (failed.error() == ParseError{code, 3})
+            && (failed.valueOr("fallback") == "fallback")
+            && !easyParse::parseErrorMessage(code).empty()
+            && throwsFor([&]() { static_cast<void>(failed.value()); }, code)
+            && !failedVoid && throwsFor([&]() { failedVoid.value(); }, code)
+            && throwsFor([&]() { ParseError{code, 3}.raise(); }, code);
+    }
+
+    ParseResult<std::string> parsed = std::string("value");
+    ParseResult<void> parsedVoid;
+    parsedVoid.value();
+
+    return pass && parsed && (parsed.value() == "value") && (*parsed == "value") && (parsed->size() == 5) && parsedVoid;
+}
+
+/// @brief `tryConvertEscapedString(escaped)` is `expected` and the throwing form returns it too.
+bool convertsTo(std::string_view escaped, char expected)
+{
+    auto result = easyParse::tryConvertEscapedString(escaped);
+    return result && (*result == expected) && (easyParse::convertEscapedString(escaped) == expected);
+}
+
+/// @brief `tryConvertEscapedString(escaped)` fails with `expected` and the throwing form throws for it.
+bool convertFailsWith(std::string_view escaped, ParseError expected)
+{
+    auto result = easyParse::tryConvertEscapedString(escaped);
+    return !result && (result.error() == expected)
+        && throwsFor([&]() { static_cast<void>(easyParse::convertEscapedString(escaped)); }, expected.code);
+}
+
+/**
+ * @brief Escape sequences, malformed ones fail at the offending character.
+ */
+bool checkEscapedString()
+{
+    return convertsTo("\\n", '\n') && convertsTo("\\\\", '\\') && convertsTo("\\'", '\'') && convertsTo("\\\"", '\"')
+        && convertsTo("\\x41", 'A') && convertsTo("\\X7e", '~') && convertsTo("\\o101", 'A') && convertsTo("\\O0", '\0')
+        && convertsTo("\\o", '\0') && convertsTo("\\65", 'A') && convertsTo("\\0", '\0')
+        && convertFailsWith("", {ParseErrorCode::EMPTY_STRING, 0})
+        && convertFailsWith("\\", {ParseErrorCode::MISSING_ESCAPE_VALUE, 1})
+        && convertFailsWith("a", {ParseErrorCode::NOT_ESCAPED, 0})
+        && convertFailsWith("n\\", {ParseErrorCode::NOT_ESCAPED, 0})
+        && convertFailsWith("\\x4g", {ParseErrorCode::INVALID_DIGIT, 3})
+        && convertFailsWith("\\o18", {ParseErrorCode::INVALID_DIGIT, 3})
+        && convertFailsWith("\\6a", {ParseErrorCode::INVALID_DIGIT, 2})
+        && convertFailsWith("\\z", {ParseErrorCode::INVALID_DIGIT, 1});
+}
+
+/**
+ * @brief `tryAdvanceOverText` over the start of `text` gives `expected` and leaves the iterator `advance`
+ * characters on, the throwing form does the same.
+ */
+bool advancesTo(std::string_view text, std::pair<char, bool> expected, std::size_t advance)
+{
+    auto iterator = text.begin();
+    auto result = easyParse::tryAdvanceOverText(iterator, text.end());
+
+    if(!result || (*result != expected) || (iterator != text.begin() + advance))
+        return false;
+
+    iterator = text.begin();
+    return (easyParse::advanceOverText(iterator, text.end()) == expected) && (iterator == text.begin() + advance);
+}
+
+/**
+ * @brief `tryAdvanceOverText` over the start of `text` fails with `expected` and leaves the iterator where it was,
+ * the throwing form throws and leaves it too.
+ */
+bool advanceFailsWith(std::string_view text, ParseError expected)
+{
+    auto iterator = text.begin();
+    auto result = easyParse::tryAdvanceOverText(iterator, text.end());
+
+    if(result || (result.error() != expected) || (iterator != text.begin()))
+        return false;
+
+    return throwsFor([&]() { static_cast<void>(easyParse::advanceOverText(iterator, text.end())); }, expected.code)
+        && (iterator == text.begin());
+}
+
+/**
+ * @brief Plain and escaped characters, escapes cut short by the end of the text.
+ */
+bool checkAdvanceOverText()
+{
+    return advancesTo("ab", {'a', false}, 1) && advancesTo("\\nq", {'\n', true}, 2)
+        && advancesTo("\\x41g", {'A', true}, 4) && advancesTo("\\o101x", {'A', true}, 5)
+        // a decimal escape takes one digit.
+        && advancesTo("\\65", {'\6', true}, 2)
+        // a trailing '\' is itself, a trailing "\o" has an empty (zero) value.
+        && advancesTo("\\", {'\\', true}, 1) && advancesTo("\\o", {'\0', true}, 2)
+        && advanceFailsWith("", {ParseErrorCode::EMPTY_STRING, 0})
+        && advanceFailsWith("\\x", {ParseErrorCode::MISSING_ESCAPE_VALUE, 2})
+        && advanceFailsWith("\\z", {ParseErrorCode::INVALID_DIGIT, 1});
+}
+
+/**
+ * @brief "", "\" and escapes cut short ending at the last byte before a PROT_NONE page, a read past the end faults.
+ *
+ * Passes without checking where guard pages are not available.
+ */
+bool checkPageEnd()
+{
+#if defined(__unix__) || defined(__APPLE__)
+    auto pageSize = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+
+    void* mapping = mmap(nullptr, 2 * pageSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(mapping == MAP_FAILED)
+        return true;
+
+    auto page = static_cast<char*>(mapping);
+    bool pass = mprotect(page + pageSize, pageSize, PROT_NONE) == 0;
+    char* end = page + pageSize;
+
+    auto atPageEnd = [&](std::string_view text)
+    {
+        std::memcpy(end - text.size(), text.data(), text.size());
+        return std::string_view(end - text.size(), text.size());
+    };
+
+    pass = pass && convertFailsWith(atPageEnd(""), {ParseErrorCode::EMPTY_STRING, 0})
+        && convertFailsWith(atPageEnd("\\"), {ParseErrorCode::MISSING_ESCAPE_VALUE, 1})
+        && convertsTo(atPageEnd("\\o"), '\0') && convertsTo(atPageEnd("\\x"), '\0')
+        && advanceFailsWith(atPageEnd(""), {ParseErrorCode::EMPTY_STRING, 0})
+        && advancesTo(atPageEnd("\\"), {'\\', true}, 1)
+        && advanceFailsWith(atPageEnd("\\x"), {ParseErrorCode::MISSING_ESCAPE_VALUE, 2})
+        && advancesTo(atPageEnd("\\o"), {'\0', true}, 2)
+        && advancesTo(atPageEnd("\\o101"), {'A', true}, 5)
+        && advancesTo(atPageEnd("\\x41"), {'A', true}, 4);
+
+    munmap(mapping, 2 * pageSize);
+    return pass;
+#else
+    return true;
+#endif
+}
+
+/// @brief Parser over `args` with a bool, an arg and an opt switch.
+easyParse::ArgParser configuredParser(std::vector<const char*>& args)
+{
+    easyParse::ArgParser parser(static_cast<int>(args.size()), args.data());
+
+    parser.addBoolSwitch("verbose", "v", false)
+        .addArgSwitch("input", "i", {"in.txt"}, {"default.txt"})
+        .addOptSwitch("mode", {"fast", "slow"}, 0);
+
+    return parser;
+}
+
+/// @brief `tryParse` over `args` fails with `expected`, `parse` throws for it.
+bool argsFailWith(std::vector<const char*> args, ParseError expected)
+{
+    auto result = configuredParser(args).tryParse();
+    auto parser = configuredParser(args);
+
+    return !result && (result.error() == expected) && throwsFor([&]() { parser.parse(); }, expected.code);
+}
+
+/**
+ * @brief Error codes and argument index of malformed argument lists, empty arguments are positional.
+ */
+bool checkArgParser()
+{
+    bool pass = argsFailWith({"prgrm", "-"}, {ParseErrorCode::INVALID_SWITCH, 1})
+        && argsFailWith({"prgrm", "--input", "a", "-"}, {ParseErrorCode::INVALID_SWITCH, 3})
+        && argsFailWith({"prgrm", "pos", "-q"}, {ParseErrorCode::UNKNOWN_SWITCH, 2})
+        && argsFailWith({"prgrm", "--verbose"}, {ParseErrorCode::MISSING_SWITCH_ARGUMENT, 1})
+        && argsFailWith({"prgrm", "pos", "--mode"}, {ParseErrorCode::MISSING_SWITCH_ARGUMENT, 2})
+        && argsFailWith({"prgrm", "--verbose", "maybe"}, {ParseErrorCode::INVALID_SWITCH_ARGUMENT, 2})
+        && argsFailWith({"prgrm", "--mode", "medium"}, {ParseErrorCode::INVALID_SWITCH_ARGUMENT, 2})
+        && argsFailWith({"prgrm", "--verbose", ""}, {ParseErrorCode::INVALID_SWITCH_ARGUMENT, 2});
+
+    std::vector<const char*> args = {"prgrm", "", "--VERBOSE", "Yes", "-slow", ""};
+    auto parser = configuredParser(args);
+    auto result = parser.tryParse();
+
+    std::vector<std::pair<std::string_view, std::size_t>> positional;
+    for(auto it = parser.posIterator(); it < parser.posSentinal(); ++it)
+        positional.emplace_back(it->arg, it->pos);
+
+    pass = pass && result && (positional == std::vector<std::pair<std::string_view, std::size_t>>{{"", 1}, {"", 5}})
+        && parser.boolIterator()->setValue && (parser.optIterator()->setValue == 1);
+
+    std::vector<const char*> programOnly = {"prgrm"};
+    return pass && configuredParser(programOnly).tryParse();
+}
+
+/**
+ * @brief The throwing number string forms throw `std::invalid_argument` for malformed strings
+ * and `std::out_of_range` for range errors only.
+ */
+bool checkNumberStringExceptions()
+{
+    auto invalid = ParseErrorCode::INVALID_DIGIT;
+
+    return throwsFor([]() { static_cast<void>(easyParse::convertNumberString<std::uint32_t>("")); }, invalid)
+        && throwsFor([]() { static_cast<void>(easyParse::convertNumberString<std::uint32_t>("-")); }, invalid)
+        && throwsFor([]() { static_cast<void>(easyParse::convertNumberString<std::uint32_t>("0x1g")); }, invalid)
+        && throwsFor([]() { static_cast<void>(easyParse::validateNumberString("")); }, invalid)
+        && throwsFor([]() { static_cast<void>(easyParse::validateNumberString("-")); }, invalid)
+        && !easyParse::validateNumberString("0b12") && easyParse::validateNumberString("-0x1f")
+        && (easyParse::convertNumberString<std::uint8_t>("-1") == 0xff)
+        && throwsFor([]() { static_cast<void>(easyParse::parseNumberString<std::int32_t>("12a")); }, invalid)
+        && throwsFor([]() { static_cast<void>(easyParse::parseNumberString<std::uint8_t>("256")); }, ParseErrorCode::OUT_OF_RANGE)
+        && throwsFor([]() { static_cast<void>(easyParse::parseNumberString<std::uint8_t>("-1")); }, ParseErrorCode::OUT_OF_RANGE);
+}
+
+int main()
+{
+    CHECK("ParseResult value / error access and exception of every code", checkResult());
+    CHECK("tryConvertEscapedString escape sequences and error offsets", checkEscapedString());
+    CHECK("tryAdvanceOverText characters, error offsets, iterator unchanged on error", checkAdvanceOverText());
+    CHECK("escape parsing reads nothing past the string end", checkPageEnd());
+    CHECK("ArgParser::tryParse error codes and argument index, empty arguments", checkArgParser());
+    CHECK("number string throwing forms keep their exception types", checkNumberStringExceptions());
+}
@@ -0,0 +1,138 @@
+/**
+ * @file radixSort.cpp
+ * @author Harith Manoj
+ * @brief radix sort test.
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (C) Harith Manoj
+ *
+ *
+ *                      APACHE LICENSE 2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include <easyMathLib/radixSort.h>
+#include <easyMathLib/WideUInt.h>
+
+#include "testSupport.h"
+
+static_assert(easyMath::RadixSortable<std::int16_t>);
+static_assert(easyMath::RadixSortable<easyMath::UInt128>);
+static_assert(!easyMath::RadixSortable<bool>);
+static_assert(!easyMath::RadixSortable<double>);
+
+template<class Key>
+Key randomKey(std::mt19937_64& rng)
+{
+    if constexpr (std::is_integral_v<Key>)
+    {
+        // narrow ranges produce duplicates and digits shared by every key.
+        auto value = rng() >> (rng() % 64);
+        return static_cast<Key>((rng() & 1) ? value : ~value);
+    }
+    else
+        return Key(std::array<std::uint64_t, 2>{rng(), rng() >> (rng() % 64)});
+}
+
+template<class Key, std::size_t DigitBits = 8>
+bool checkKeys(std::mt19937_64& rng, std::size_t size, easyMath::RadixSortOptions options)
+{
+    std::vector<Key> keys(size);
+    for(auto& key : keys)
+        key = randomKey<Key>(rng);
+
+    auto expected = keys;
+    std::sort(expected.begin(), expected.end());
+
+    easyMath::radixSort<Key, DigitBits>(keys, options);
+    return keys == expected;
+}
+
+template<class Key>
+bool checkPairs(std::mt19937_64& rng, std::size_t size, easyMath::RadixSortOptions options)
+{
+    std::vector<std::pair<Key, std::uint32_t>> pairs(size);
+    for(std::size_t i = 0; i < size; ++i)
+        pairs[i] = {static_cast<Key>(randomKey<Key>(rng) % 1000), static_cast<std::uint32_t>(i)};
+
+    std::vector<Key> keys(size);
+    std::vector<std::uint32_t> values(size);
+    for(std::size_t i = 0; i < size; ++i)
+        std::tie(keys[i], values[i]) = pairs[i];
+
+    // stable sort by key is the reference, equal keys keep insertion order.
+    std::stable_sort(pairs.begin(), pairs.end(), [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+    easyMath::radixSort<Key, std::uint32_t>(keys, values, options);
+
+    bool pass = true;
+    for(std::size_t i = 0; i < size; ++i)
+        pass = pass && (keys[i] == pairs[i].first) && (values[i] == pairs[i].second);
+
+    return pass;
+}
+
+template<class Key>
+bool checkType(std::mt19937_64& rng)
+{
+    bool pass = true;
+
+    for(auto order : {easyMath::RadixSortOrder::LSD, easyMath::RadixSortOrder::MSD})
+    {
+        for(std::size_t size : {std::size_t{0}, std::size_t{1}, std::size_t{31}, std::size_t{1000}, std::size_t{5000}})
+        {
+            pass = pass && checkKeys<Key>(rng, size, {1, order});
+            pass = pass && checkKeys<Key, 11>(rng, size, {1, order});
+            pass = pass && checkKeys<Key, 3>(rng, size, {1, order});
+
+            if constexpr (std::is_integral_v<Key>)
+                pass = pass && checkPairs<Key>(rng, size, {1, order});
+        }
+
+        // large enough for the threaded path.
+        pass = pass && checkKeys<Key>(rng, 140000, {4, order});
+        if constexpr (std::is_integral_v<Key>)
+            pass = pass && checkPairs<Key>(rng, 140000, {4, order});
+    }
+
+    return pass;
+}
+
+int main()
+{
+    auto rng = easyTest::seededEngine();
+
+    CHECK("radixSort uint8", checkType<std::uint8_t>(rng));
+    CHECK("radixSort uint16", checkType<std::uint16_t>(rng));
+    CHECK("radixSort uint32", checkType<std::uint32_t>(rng));
+    CHECK("radixSort uint64", checkType<std::uint64_t>(rng));
+    CHECK("radixSort int8", checkType<std::int8_t>(rng));
+    CHECK("radixSort int32", checkType<std::int32_t>(rng));
+    CHECK("radixSort int64", checkType<std::int64_t>(rng));
+    CHECK("radixSort UInt128", checkType<easyMath::UInt128>(rng));
+
+    // non trivially copyable values are moved.
+    std::vector<std::uint16_t> keys = {3, 1, 2, 1};
+    std::vector<std::string> names = {"three", "one", "two", "uno"};
+    easyMath::radixSort<std::uint16_t, std::string>(keys, names);
+    CHECK("radixSort string values", names == (std::vector<std::string>{"one", "uno", "two", "three"}));
+}
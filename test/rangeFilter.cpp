@@ -0,0 +1,129 @@
+/**
+ * @file rangeFilter.cpp
+ * @author Harith Manoj
+ * @brief batch range filter test.
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (C) Harith Manoj
+ *
+ *
+ *                      APACHE LICENSE 2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#include <iostream>
+#include <string>
+#include <random>
+#include <vector>
+#include <typeinfo>
+
+#include <easyMathLib/rangeFilter.h>
+
+#include "testSupport.h"
+
+constexpr std::size_t COUNT = 1000;
+
+template<class T>
+bool validate(const std::vector<T>& values, T low, T high)
+{
+    std::vector<std::uint64_t> mask(easyMath::divideRoundUp<std::size_t>(values.size(), 64) + 1, ~0ull);
+    std::vector<std::uint64_t> maskInclusive(mask.size(), ~0ull);
+    std::vector<std::size_t> indices(values.size());
+    std::vector<std::size_t> indicesInclusive(values.size());
+    std::vector<T> compact(values.size());
+    std::vector<T> compactInclusive(values.size());
+
+    auto count = easyMath::valueBetweenMask<T>(values, low, high, mask);
+    auto countInclusive = easyMath::valueBetweenInclusiveMask<T>(values, low, high, maskInclusive);
+
+    bool pass = (count == easyMath::valueBetweenSelect<T>(values, low, high, indices))
+        && (count == easyMath::valueBetweenCompact<T>(values, low, high, compact))
+        && (countInclusive == easyMath::valueBetweenInclusiveSelect<T>(values, low, high, indicesInclusive))
+        && (countInclusive == easyMath::valueBetweenInclusiveCompact<T>(values, low, high, compactInclusive));
+
+    std::size_t expected = 0;
+    std::size_t expectedInclusive = 0;
+
+    for(std::size_t i = 0; (i < values.size()) && pass; ++i)
+    {
+        bool isIn = easyMath::valueBetween(values[i], low, high);
+        bool isInInclusive = easyMath::valueBetweenInclusive(values[i], low, high);
+
+        pass = pass && (((mask[i / 64] >> (i % 64)) & 1) == isIn);
+        pass = pass && (((maskInclusive[i / 64] >> (i % 64)) & 1) == isInInclusive);
+
+        if(isIn)
+        {
+            pass = pass && (indices[expected] == i) && (compact[expected] == values[i]);
+            ++expected;
+        }
+
+        if(isInInclusive)
+        {
+            pass = pass && (indicesInclusive[expectedInclusive] == i) && (compactInclusive[expectedInclusive] == values[i]);
+            ++expectedInclusive;
+        }
+    }
+
+    if(values.size() % 64 != 0)
+        pass = pass && ((mask[values.size() / 64] >> (values.size() % 64)) == 0);
+
+    return pass && (expected == count) && (expectedInclusive == countInclusive);
+}
+
+template<class T, class Distribution>
+void check(std::mt19937_64& rng, Distribution gen)
+{
+    bool pass = easyTest::atEveryCpuTier([&]()
+    {
+        bool isValid = true;
+
+        for(std::size_t i = 0; i < COUNT; ++i)
+        {
+            std::vector<T> values(rng() % 300);
+
+            for(auto& value : values)
+                value = static_cast<T>(gen(rng));
+
+            auto low = static_cast<T>(gen(rng));
+            auto high = static_cast<T>(gen(rng));
+
+            isValid = isValid && validate<T>(values, low, high) && validate<T>(values, high, low);
+        }
+
+        return isValid;
+    });
+
+    std::cout << (pass ? "PASS " : "FAIL ") << typeid(T).name() << " " << sizeof(T) << " byte range filter, every tier\n";
+}
+
+int main()
+{
+    auto rng = easyTest::seededEngine();
+
+    check<std::int8_t>(rng, std::uniform_int_distribution<int>(-128, 127));
+    check<std::uint8_t>(rng, std::uniform_int_distribution<int>(0, 255));
+    check<char>(rng, std::uniform_int_distribution<int>(0, 127));
+    check<std::int16_t>(rng, std::uniform_int_distribution<int>(-40000 / 2, 40000 / 2));
+    check<std::uint16_t>(rng, std::uniform_int_distribution<int>(32700, 32800));
+    check<std::int32_t>(rng, std::uniform_int_distribution<std::int32_t>(-100, 100));
+    check<std::uint32_t>(rng, std::uniform_int_distribution<std::uint32_t>(0x7fffff00u, 0x800000ffu));
+    check<std::int64_t>(rng, std::uniform_int_distribution<std::int64_t>(-100, 100));
+    check<std::uint64_t>(rng, std::uniform_int_distribution<std::uint64_t>(0x7fffffffffffff00ull, 0x80000000000000ffull));
+    check<float>(rng, std::uniform_int_distribution<int>(-50, 50));
+    check<double>(rng, std::uniform_real_distribution<double>(-1.0, 1.0));
+    check<long double>(rng, std::uniform_int_distribution<int>(-50, 50));
+}
@@ -0,0 +1,102 @@
+/**
+ * @file rankSelectBitmap.cpp
+ * @author Harith Manoj
+ * @brief RankSelectBitmap test.
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (C) Harith Manoj
+ *
+ *
+ *                      APACHE LICENSE 2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <easyMathLib/RankSelectBitmap.h>
+
+#include "testSupport.h"
+
+constexpr bool checkConstexpr()
+{
+    std::uint64_t words[2] = {0b1011, 0x8000000000000001ull};
+    easyMath::RankSelectBitmap bitmap(words, 100);
+
+    return (bitmap.count() == 4) && (bitmap.rank(2) == 2) && (bitmap.rank(64) == 3) && (bitmap.rank(65) == 4)
+        && (bitmap.select(2) == 3) && (bitmap.select(3) == 64) && (bitmap.rankZero(4) == 1) && !bitmap[2];
+}
+
+static_assert(checkConstexpr());
+static_assert(easyMath::impl_detail_::selectInWord_(0xf0f0, 5) == 13);
+
+bool checkBitmap(std::mt19937_64& rng, std::size_t size, std::uint64_t density)
+{
+    // density: probability of a set bit is density / 1024.
+    std::vector<std::uint64_t> words((size + 63) / 64 + 1, 0);
+    std::vector<std::size_t> ones, prefix(size + 1, 0);
+
+    for(std::size_t i = 0; i < words.size() * 64; ++i)
+    {
+        bool bit = (rng() % 1024) < density;
+        if(bit)
+            words[i / 64] |= std::uint64_t{1} << (i % 64);
+
+        // bits past size must be ignored.
+        if(i < size)
+        {
+            prefix[i + 1] = prefix[i] + bit;
+            if(bit)
+                ones.push_back(i);
+        }
+    }
+
+    easyMath::RankSelectBitmap bitmap(words, size);
+
+    bool pass = (bitmap.size() == size) && (bitmap.count() == ones.size());
+
+    for(std::size_t i = 0; i <= size; i += 1 + (rng() % 7))
+        pass = pass && (bitmap.rank(i) == prefix[i]) && (bitmap.rankZero(i) == i - prefix[i]);
+
+    pass = pass && (bitmap.rank(size) == ones.size());
+
+    for(std::size_t k = 0; k < ones.size(); k += 1 + (rng() % 3))
+        pass = pass && (bitmap.select(k) == ones[k]);
+
+    if(!ones.empty())
+        pass = pass && (bitmap.select(ones.size() - 1) == ones.back());
+
+    return pass;
+}
+
+int main()
+{
+    auto rng = easyTest::seededEngine();
+
+    bool pass = true;
+    for(std::size_t size : {std::size_t{0}, std::size_t{1}, std::size_t{64}, std::size_t{4095}, std::size_t{4096}, std::size_t{100003}})
+        for(std::uint64_t density : {0, 1, 30, 512, 1000, 1024})
+            pass = pass && checkBitmap(rng, size, density);
+
+    CHECK("RankSelectBitmap rank / select against reference", pass);
+
+    CHECK("RankSelectBitmap large sparse and dense", checkBitmap(rng, 3000000, 2) && checkBitmap(rng, 1000000, 900));
+
+    easyMath::RankSelectBitmap big(std::vector<std::uint64_t>(1 << 20, 0x5555555555555555ull), 64u << 20);
+    double overhead = static_cast<double>(big.indexBytes()) / static_cast<double>(big.words().size_bytes());
+    CHECK("RankSelectBitmap index overhead below 6%", (overhead < 0.06) && (big.select(big.count() - 1) == (64u << 20) - 2));
+}
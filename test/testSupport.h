@@ -0,0 +1,105 @@
+/**
+ * @file testSupport.h
+ * @author Harith Manoj
+ * @brief Shared check macro and random engine seeding for unit tests.
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (C) Harith Manoj
+ *
+ *
+ *                      APACHE LICENSE 2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef TEST_TESTSUPPORT_H_INCLUDED
+
+/// @brief test\testSupport.h Header Guard
+#define TEST_TESTSUPPORT_H_INCLUDED
+
+#include <iostream>
+#include <random>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+
+#include <easyLib/cpuDispatch.h>
+
+/// @brief Print PASS / FAIL followed by name of check, ctest fails the test on FAIL.
+#define CHECK(name, cond)         std::cout << ((cond) ? "PASS " : "FAIL ") << name << "\n"
+
+namespace easyTest
+{
+    /**
+     * @brief Seed for the random engine of a test run.
+     *
+     * Taken from environment variable `EASY_LIBRARY_TEST_SEED` when set, else from `std::random_device`.
+     * The seed is always printed so a failing run can be reproduced by exporting it.
+     *
+     * @return std::uint64_t seed.
+     */
+    inline std::uint64_t testSeed()
+    {
+        std::uint64_t seed = 0;
+
+        if(const char* fixed = std::getenv("EASY_LIBRARY_TEST_SEED"); (fixed != nullptr) && (*fixed != '\0'))
+            seed = std::stoull(fixed, nullptr, 0);
+        else
+        {
+            std::random_device rd;
+            seed = (static_cast<std::uint64_t>(rd()) << 32) ^ rd();
+        }
+
+        std::cout << "SEED " << seed << " (set EASY_LIBRARY_TEST_SEED to reproduce)\n";
+        return seed;
+    }
+
+    /**
+     * @brief Random engine seeded by `testSeed()`.
+     *
+     * @return std::mt19937_64 engine.
+     */
+    inline std::mt19937_64 seededEngine()
+    {
+        return std::mt19937_64(testSeed());
+    }
+
+    /**
+     * @brief Run `check` at the scalar tier and at every tier up to the detected one, then restore the detected tier.
+     *
+     * @tparam Check callable returning bool.
+     * @param[in] check check to run, called once per tier.
+     * @return bool true if `check` passed at every tier.
+     */
+    template<class Check>
+    bool atEveryCpuTier(Check&& check)
+    {
+        easyLib::CpuTier detected = easyLib::detectCpuTier();
+        bool pass = true;
+
+        for(auto tier : {easyLib::CpuTier::SCALAR, easyLib::CpuTier::SSE2, easyLib::CpuTier::SSE4_2, easyLib::CpuTier::AVX2, easyLib::CpuTier::AVX512})
+        {
+            if(tier > detected)
+                continue;
+
+            easyLib::overrideCpuTier(tier);
+            pass = check() && pass;
+        }
+
+        easyLib::overrideCpuTier(detected);
+        return pass;
+    }
+}
+
+#endif // TEST_TESTSUPPORT_H_INCLUDED
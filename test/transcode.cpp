@@ -0,0 +1,173 @@
+/**
+ * @file transcode.cpp
+ * @author Harith Manoj
+ * @brief Range checked narrowing / widening test at every CPU tier against scalar conversion.
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (C) Harith Manoj
+ *
+ *
+ *                      APACHE LICENSE 2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#include <iostream>
+#include <random>
+#include <vector>
+#include <utility>
+
+#include <easyMathLib/transcode.h>
+
+#include "testSupport.h"
+
+constexpr bool checkConstexprTranscode()
+{
+    std::uint64_t wide[] = {1, 200, 65535, 65536};
+    std::uint16_t narrowed[4] = {};
+    std::int64_t widened[4] = {};
+    std::int8_t small[] = {-3, 0, 127, -128};
+
+    easyMath::widen<std::int64_t, std::int8_t>(small, widened);
+
+    return (easyMath::narrow<std::uint16_t, std::uint64_t>(wide, narrowed) == 3) && (narrowed[2] == 65535)
+        && (widened[0] == -3) && (widened[3] == -128) && (easyMath::requiredBitWidth<std::uint64_t>(wide) == 17);
+}
+
+static_assert(checkConstexprTranscode());
+static_assert(easyMath::narrowedSize(0) == 1 && easyMath::narrowedSize(9) == 2 && easyMath::narrowedSize(17) == 4 && easyMath::narrowedSize(33) == 8);
+static_assert(std::same_as<easyMath::SizeCapableUint<17>, std::uint32_t> && easyMath::narrowedSize(17) == sizeof(easyMath::SizeCapableUint<17>));
+
+/// @brief Random value fitting `Destination`, near its limits half the time.
+template<class Destination, class Source>
+Source randomFitting(std::mt19937_64& rng)
+{
+    Source value;
+    switch(rng() % 4)
+    {
+    case 0: value = static_cast<Source>(std::numeric_limits<Destination>::max() - static_cast<Destination>(rng() % 3)); break;
+    case 1: value = static_cast<Source>(std::numeric_limits<Destination>::min() + static_cast<Destination>(rng() % 3)); break;
+    default: value = static_cast<Source>(static_cast<Destination>(rng())); break;
+    }
+
+    // negative narrow values do not fit unsigned sources.
+    return std::in_range<Destination>(value) ? value : static_cast<Source>(rng() % 100);
+}
+
+/// @brief Random value just outside the range of `Destination`.
+template<class Destination, class Source>
+Source randomOutside(std::mt19937_64& rng)
+{
+    auto below = static_cast<Source>(static_cast<Source>(std::numeric_limits<Destination>::min()) - 1 - static_cast<Source>(rng() % 3));
+    auto above = static_cast<Source>(static_cast<Source>(std::numeric_limits<Destination>::max()) + 1 + static_cast<Source>(rng() % 3));
+
+    // unsigned sources have no value below an unsigned destination.
+    if constexpr (std::is_signed_v<Source>)
+        return (rng() % 2) ? below : above;
+    else
+        return above;
+}
+
+template<class Destination, class Source>
+bool checkPair(std::mt19937_64& rng)
+{
+    bool pass = true;
+
+    for(std::size_t size : {0, 1, 5, 31, 64, 100, 1000})
+    {
+        std::vector<Source> values(size);
+        for(auto& value : values)
+            value = randomFitting<Destination, Source>(rng);
+
+        // all fit, then one value out of range at a random position.
+        std::vector<Destination> narrowed(size);
+        pass = pass && (easyMath::narrow<Destination, Source>(values, narrowed) == size);
+        for(std::size_t i = 0; i < size; ++i)
+            pass = pass && (narrowed[i] == static_cast<Destination>(values[i]));
+
+        if(size != 0)
+        {
+            std::size_t bad = rng() % size;
+            values[bad] = randomOutside<Destination, Source>(rng);
+            pass = pass && (easyMath::narrow<Destination, Source>(values, narrowed) == bad);
+        }
+
+        // widening is only defined when every narrow value fits.
+        if constexpr (std::is_signed_v<Source> || !std::is_signed_v<Destination>)
+        {
+            std::vector<Destination> small(size);
+            std::vector<Source> widened(size);
+            for(auto& value : small)
+                value = static_cast<Destination>(rng());
+
+            easyMath::widen<Source, Destination>(small, widened);
+            for(std::size_t i = 0; i < size; ++i)
+                pass = pass && (widened[i] == static_cast<Source>(small[i]));
+        }
+    }
+
+    return pass;
+}
+
+template<class UInt>
+bool checkBitWidth(std::mt19937_64& rng)
+{
+    bool pass = true;
+
+    for(std::size_t size : {0, 3, 64, 333})
+    {
+        std::vector<UInt> values(size);
+        UInt maximum = 0;
+        for(auto& value : values)
+        {
+            value = static_cast<UInt>(rng() >> (rng() % 64));
+            maximum = std::max(maximum, value);
+        }
+
+        pass = pass && (easyMath::requiredBitWidth<UInt>(values) == static_cast<std::size_t>(std::bit_width(maximum)));
+    }
+
+    return pass;
+}
+
+int main()
+{
+    auto rng = easyTest::seededEngine();
+
+    CHECK("unsigned narrow / widen, every tier", easyTest::atEveryCpuTier([&]()
+    {
+        return checkPair<std::uint32_t, std::uint64_t>(rng) && checkPair<std::uint16_t, std::uint64_t>(rng)
+            && checkPair<std::uint8_t, std::uint64_t>(rng) && checkPair<std::uint16_t, std::uint32_t>(rng)
+            && checkPair<std::uint8_t, std::uint32_t>(rng) && checkPair<std::uint8_t, std::uint16_t>(rng);
+    }));
+    CHECK("signed narrow / widen, every tier", easyTest::atEveryCpuTier([&]()
+    {
+        return checkPair<std::int32_t, std::int64_t>(rng) && checkPair<std::int16_t, std::int64_t>(rng)
+            && checkPair<std::int8_t, std::int64_t>(rng) && checkPair<std::int16_t, std::int32_t>(rng)
+            && checkPair<std::int8_t, std::int32_t>(rng) && checkPair<std::int8_t, std::int16_t>(rng);
+    }));
+    CHECK("mixed signedness narrow / widen, every tier", easyTest::atEveryCpuTier([&]()
+    {
+        return checkPair<std::uint8_t, std::int32_t>(rng) && checkPair<std::int16_t, std::uint64_t>(rng)
+            && checkPair<std::uint32_t, std::int64_t>(rng) && checkPair<std::int8_t, std::uint16_t>(rng);
+    }));
+    CHECK("required bit width, every tier", easyTest::atEveryCpuTier([&]()
+    {
+        return checkBitWidth<std::uint8_t>(rng) && checkBitWidth<std::uint16_t>(rng)
+            && checkBitWidth<std::uint32_t>(rng) && checkBitWidth<std::uint64_t>(rng);
+    }));
+
+    return 0;
+}
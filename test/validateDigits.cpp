@@ -0,0 +1,197 @@
+/**
+ * @file validateDigits.cpp
+ * @author Harith Manoj
+ * @brief validate*String test, vector digit classification at every CPU tier against the scalar loop.
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (C) Harith Manoj
+ *
+ *
+ *                      APACHE LICENSE 2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <cstring>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include <easyParseLib/easyParse.h>
+
+#include "testSupport.h"
+
+static_assert(easyParse::validateHexString("0123456789abcdefABCDEF0123456789"));
+static_assert(!easyParse::validateHexString("0123456789abcdefABCDEF012345678g"));
+static_assert(easyParse::validateDecString("01234567890123456789") && !easyParse::validateDecString("0123456789012345678a"));
+static_assert(easyParse::validateOctString("01234567012345670") && !easyParse::validateOctString("01234567012345678"));
+static_assert(easyParse::validateBinString("01010101010101011") && !easyParse::validateBinString("01010101010101012"));
+
+/// @brief Digit characters of `base`, hex in both cases.
+template<unsigned base>
+constexpr std::string_view DIGITS = (base == 16) ? "0123456789abcdefABCDEF" : std::string_view("0123456789").substr(0, base);
+
+/// @brief Scalar reference, one character at a time.
+template<unsigned base>
+bool referenceValid(std::string_view digits)
+{
+    for(auto ch : digits)
+        if(DIGITS<base>.find(ch) == std::string_view::npos)
+            return false;
+
+    return true;
+}
+
+/// @brief `validate*String` of `base`.
+template<unsigned base>
+bool validate(std::string_view digits)
+{
+    if constexpr (base == 16)
+        return easyParse::validateHexString(digits);
+    else if constexpr (base == 10)
+        return easyParse::validateDecString(digits);
+    else if constexpr (base == 8)
+        return easyParse::validateOctString(digits);
+    else
+        return easyParse::validateBinString(digits);
+}
+
+/// @brief Random string of `size` digits of `base`.
+template<unsigned base>
+std::string randomDigits(std::mt19937_64& rng, std::size_t size)
+{
+    std::string digits(size, '0');
+    for(auto& ch : digits)
+        ch = DIGITS<base>[rng() % DIGITS<base>.size()];
+    return digits;
+}
+
+/**
+ * @brief Every byte value at every position of strings around the vector widths, same result as the scalar loop.
+ */
+template<unsigned base>
+bool checkEveryByte(std::mt19937_64& rng)
+{
+    bool pass = true;
+
+    for(std::size_t size : {1, 15, 16, 17, 31, 32, 33, 63, 64, 65, 100})
+    {
+        auto digits = randomDigits<base>(rng, size);
+        pass = pass && validate<base>(digits);
+
+        for(std::size_t position = 0; position < size; ++position)
+        {
+            auto modified = digits;
+
+            for(int byte = 0; byte < 256; ++byte)
+            {
+                modified[position] = static_cast<char>(byte);
+                pass = pass && (validate<base>(modified) == referenceValid<base>(modified));
+            }
+        }
+    }
+
+    return pass;
+}
+
+/**
+ * @brief Every length up to 150 with random digits and at most one random non digit.
+ */
+template<unsigned base>
+bool checkLengths(std::mt19937_64& rng)
+{
+    bool pass = true;
+
+    for(std::size_t size = 0; size <= 150; ++size)
+    {
+        for(std::size_t trial = 0; trial < 20; ++trial)
+        {
+            auto digits = randomDigits<base>(rng, size);
+            if((size != 0) && (trial % 2 == 1))
+                digits[rng() % size] = static_cast<char>(rng());
+
+            pass = pass && (validate<base>(digits) == referenceValid<base>(digits));
+        }
+    }
+
+    return pass;
+}
+
+/**
+ * @brief Strings ending at the last byte before a PROT_NONE page, a read past the end faults.
+ *
+ * Passes without checking where guard pages are not available.
+ */
+template<unsigned base>
+bool checkPageEnd(std::mt19937_64& rng)
+{
+#if defined(__unix__) || defined(__APPLE__)
+    auto pageSize = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+
+    void* mapping = mmap(nullptr, 2 * pageSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(mapping == MAP_FAILED)
+        return true;
+
+    auto page = static_cast<char*>(mapping);
+    bool pass = mprotect(page + pageSize, pageSize, PROT_NONE) == 0;
+
+    for(std::size_t size = 0; pass && (size <= 150); ++size)
+    {
+        auto digits = randomDigits<base>(rng, size);
+        char* end = page + pageSize;
+        std::memcpy(end - size, digits.data(), size);
+
+        pass = pass && validate<base>(std::string_view(end - size, size));
+
+        if(size != 0)
+        {
+            end[-1] = '!';
+            pass = pass && !validate<base>(std::string_view(end - size, size));
+        }
+    }
+
+    munmap(mapping, 2 * pageSize);
+    return pass;
+#else
+    static_cast<void>(rng);
+    return true;
+#endif
+}
+
+int main()
+{
+    auto rng = easyTest::seededEngine();
+
+    CHECK("validate*String every byte at every position, every tier", easyTest::atEveryCpuTier([&]()
+    {
+        return checkEveryByte<2>(rng) && checkEveryByte<8>(rng) && checkEveryByte<10>(rng) && checkEveryByte<16>(rng);
+    }));
+
+    CHECK("validate*String lengths 0 to 150, every tier", easyTest::atEveryCpuTier([&]()
+    {
+        return checkLengths<2>(rng) && checkLengths<8>(rng) && checkLengths<10>(rng) && checkLengths<16>(rng);
+    }));
+
+    CHECK("validate*String reads nothing past the string end, every tier", easyTest::atEveryCpuTier([&]()
+    {
+        return checkPageEnd<2>(rng) && checkPageEnd<8>(rng) && checkPageEnd<10>(rng) && checkPageEnd<16>(rng);
+    }));
+}
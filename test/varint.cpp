@@ -0,0 +1,193 @@
+/**
+ * @file varint.cpp
+ * @author Harith Manoj
+ * @brief varint codec test.
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (C) Harith Manoj
+ *
+ *
+ *                      APACHE LICENSE 2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <easyMathLib/varint.h>
+#include <easyMathLib/WideUInt.h>
+
+#include "testSupport.h"
+
+static_assert(easyMath::zigZagEncode(std::int32_t{0}) == 0u);
+static_assert(easyMath::zigZagEncode(std::int32_t{-1}) == 1u);
+static_assert(easyMath::zigZagEncode(std::int32_t{1}) == 2u);
+static_assert(easyMath::zigZagEncode(std::int64_t{INT64_MIN}) == UINT64_MAX);
+static_assert(easyMath::zigZagDecode(std::uint16_t{3}) == -2);
+
+static_assert(easyMath::varintMaxSize<std::uint32_t>() == 5);
+static_assert(easyMath::varintMaxSize<std::uint64_t>() == 10);
+static_assert(easyMath::varintSize(std::uint32_t{127}) == 1);
+static_assert(easyMath::varintSize(std::uint32_t{128}) == 2);
+static_assert(easyMath::varintSize(std::int8_t{-65}) == 2);
+
+constexpr bool checkConstexpr()
+{
+    std::array<std::uint8_t, 10> bytes{};
+    std::uint64_t value = 0;
+
+    bool pass = (easyMath::varintEncode(std::uint64_t{300}, bytes) == 2) && (bytes[0] == 0xac) && (bytes[1] == 0x02);
+    pass = pass && (easyMath::varintDecode(std::span<const std::uint8_t>(bytes), value) == 2) && (value == 300);
+
+    // 256 does not fit 8 bits, truncated input fails.
+    std::uint8_t small = 0;
+    pass = pass && (easyMath::varintDecode(std::span<const std::uint8_t>(bytes), small) == 0) && (small == 0);
+    pass = pass && (easyMath::varintDecode(std::span<const std::uint8_t>(bytes.data(), 1), value) == 0);
+
+    return pass;
+}
+
+static_assert(checkConstexpr());
+
+/**
+ * @brief Reference LEB128 encoder.
+ */
+void referenceEncode(std::uint64_t value, std::vector<std::uint8_t>& out)
+{
+    do
+    {
+        std::uint8_t byte = value & 0x7f;
+        value >>= 7;
+        out.push_back(static_cast<std::uint8_t>(byte | (value != 0 ? 0x80 : 0)));
+    } while(value != 0);
+}
+
+/**
+ * @brief Random value with uniformly distributed bit width.
+ */
+template<class Integer>
+Integer randomValue(std::mt19937_64& rng)
+{
+    auto width = rng() % (easyMath::bitSize<Integer>() + 1);
+    return static_cast<Integer>(width == 0 ? 0 : (rng() >> (64 - width)));
+}
+
+template<class Integer>
+bool checkBulk(std::mt19937_64& rng, std::size_t size)
+{
+    std::vector<Integer> values(size), decoded(size);
+    std::vector<std::uint8_t> reference;
+
+    for(auto& value : values)
+    {
+        // mix runs of small values with wide ones to hit every decode path.
+        value = (rng() % 4 == 0) ? randomValue<Integer>(rng) : static_cast<Integer>(rng() % 300);
+
+        if constexpr (std::is_signed_v<Integer>)
+            referenceEncode(easyMath::zigZagEncode(value), reference);
+        else
+            referenceEncode(value, reference);
+    }
+
+    auto bytes = easyMath::varintEncode<Integer>(values);
+    bool pass = (bytes == reference);
+
+    auto result = easyMath::varintDecode<Integer>(bytes, decoded);
+    pass = pass && (result.valueCount == size) && (result.byteCount == bytes.size()) && (decoded == values);
+
+    // decode must stop at truncated input, never reading past the end.
+    if(size != 0)
+    {
+        std::vector<std::uint8_t> truncated(bytes.begin(), bytes.end() - 1);
+        result = easyMath::varintDecode<Integer>(truncated, decoded);
+        pass = pass && (result.valueCount == size - 1);
+    }
+
+    return pass;
+}
+
+template<class Integer>
+bool checkSingle(std::mt19937_64& rng)
+{
+    bool pass = true;
+
+    for(std::size_t i = 0; i < 5000; ++i)
+    {
+        auto value = randomValue<Integer>(rng);
+        std::array<std::uint8_t, 16> bytes{};
+
+        auto length = easyMath::varintEncode(value, bytes);
+        Integer decoded{};
+
+        // decode from a tight span as well as from a padded one.
+        pass = pass && (length == easyMath::varintSize(value))
+            && (easyMath::varintDecode(std::span<const std::uint8_t>(bytes.data(), length), decoded) == length) && (decoded == value)
+            && (easyMath::varintDecode(std::span<const std::uint8_t>(bytes), decoded) == length) && (decoded == value);
+    }
+
+    return pass;
+}
+
+bool checkMalformed()
+{
+    std::uint32_t value32 = 0;
+    std::uint64_t value64 = 0;
+
+    // 2^32 needs 33 bits, overlong 64 bit varint has 11 bytes.
+    std::vector<std::uint8_t> tooWide = {0x80, 0x80, 0x80, 0x80, 0x10, 0, 0, 0, 0, 0};
+    std::vector<std::uint8_t> tooLong(10, 0xff);
+    tooLong.push_back(0x01);
+
+    std::vector<std::uint32_t> values(64);
+    std::vector<std::uint8_t> stream(100, 0x01);
+    stream.insert(stream.begin() + 40, tooWide.begin(), tooWide.begin() + 5);
+
+    auto result = easyMath::varintDecode<std::uint32_t>(stream, values);
+
+    return (easyMath::varintDecode(std::span<const std::uint8_t>(tooWide), value32) == 0)
+        && (easyMath::varintDecode(std::span<const std::uint8_t>(tooWide), value64) == 5) && (value64 == (1ull << 32))
+        && (easyMath::varintDecode(std::span<const std::uint8_t>(tooLong), value64) == 0)
+        && (result.valueCount == 40) && (result.byteCount == 40);
+}
+
+bool checkWide()
+{
+    easyMath::UInt128 value(std::array<std::uint64_t, 2>{0x0123456789abcdefull, 0x00fedcba98765432ull});
+    std::array<std::uint8_t, 19> bytes{};
+    easyMath::UInt128 decoded;
+
+    std::size_t length = easyMath::varintEncode(value, bytes);
+    return (length == 18) && (easyMath::varintDecode(std::span<const std::uint8_t>(bytes), decoded) == length) && (decoded == value);
+}
+
+int main()
+{
+    auto rng = easyTest::seededEngine();
+
+    CHECK("varint single round trip", checkSingle<std::uint8_t>(rng) && checkSingle<std::uint16_t>(rng) && checkSingle<std::uint32_t>(rng)
+        && checkSingle<std::uint64_t>(rng) && checkSingle<std::int8_t>(rng) && checkSingle<std::int32_t>(rng) && checkSingle<std::int64_t>(rng));
+
+    bool pass = true;
+    for(std::size_t size : {std::size_t{0}, std::size_t{1}, std::size_t{31}, std::size_t{100}, std::size_t{5000}})
+        pass = pass && checkBulk<std::uint16_t>(rng, size) && checkBulk<std::uint32_t>(rng, size) && checkBulk<std::int32_t>(rng, size)
+            && checkBulk<std::uint64_t>(rng, size) && checkBulk<std::int64_t>(rng, size);
+
+    CHECK("varint bulk against reference LEB128", pass);
+
+    CHECK("varint malformed input rejected", checkMalformed());
+    CHECK("varint WideUInt round trip", checkWide());
+}
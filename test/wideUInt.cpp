@@ -0,0 +1,165 @@
+/**
+ * @file wideUInt.cpp
+ * @author Harith Manoj
+ * @brief WideUInt test.
+ * @date 16 October 2026
+ *
+ * @copyright Copyright (C) Harith Manoj
+ *
+ *
+ *                      APACHE LICENSE 2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+
+#include <iostream>
+#include <string>
+#include <random>
+
+#include <easyMathLib/WideUInt.h>
+
+#include "testSupport.h"
+
+using easyMath::UInt128;
+using easyMath::UInt256;
+
+static_assert(easyMath::NumericType<UInt256>);
+static_assert(easyMath::UnsignedIntegral<UInt256>);
+static_assert(easyMath::NumericTraits<UInt256>::isOverflowCheckable);
+static_assert(easyMath::NumericTraits<UInt256>::isUnderflowCheckable);
+static_assert(easyMath::NumericTraits<UInt256>::isCustomSized);
+static_assert(easyMath::NumericTraits<UInt256>::hasBitMaskGenerator);
+static_assert(easyMath::bitSize<UInt256>() == 256);
+
+static_assert(easyMath::nBitMask<UInt256>(130) == ((UInt256(1) << 130) - 1));
+static_assert(easyMath::nBitMask<UInt256>(256) == easyMath::NumericTraits<UInt256>::max());
+static_assert(easyMath::willAddOverflow<UInt256>(easyMath::NumericTraits<UInt256>::max(), 1));
+static_assert(!easyMath::willAddOverflow<UInt256>(easyMath::NumericTraits<UInt256>::max() - 1, 1));
+static_assert(easyMath::willSubtractUnderflow<UInt256>(1, 2));
+static_assert(easyMath::divideRoundUp<UInt256>(UInt256(1) << 200, 3) == (((UInt256(1) << 200) / 3) + 1));
+static_assert(easyMath::extractBits<UInt256>(UInt256(0xabcull) << 190, 190, 12) == 0xabc);
+
+constexpr std::size_t COUNT = 10000;
+
+using Native = easyMath::BuiltinUInt128;
+
+UInt128 fromNative(Native value)
+{
+    return UInt128(std::array<std::uint64_t, 2>{static_cast<std::uint64_t>(value), static_cast<std::uint64_t>(value >> 64)});
+}
+
+/**
+ * @brief Builtin 128 bit integers convert through two limbs, signed values sign extend.
+ *
+ * Only viable where `__int128` satisfies `std::integral` (GNU extensions), passes otherwise.
+ */
+template<class Wide = Native>
+bool checkNative128(std::mt19937_64& rng)
+{
+    if constexpr (std::integral<Wide>)
+    {
+        using Signed = std::make_signed_t<Wide>;
+
+        bool pass = true;
+
+        for(std::size_t i = 0; i < COUNT; ++i)
+        {
+            Wide value = (static_cast<Wide>(rng()) << 64) | rng();
+            auto negative = static_cast<Signed>(value | (static_cast<Wide>(1) << 127));
+
+            UInt256 wide(value);
+            UInt256 extended(negative);
+
+            pass = pass && (wide.limb(0) == static_cast<std::uint64_t>(value)) && (wide.limb(1) == static_cast<std::uint64_t>(value >> 64))
+                && (wide.limb(2) == 0) && (wide.limb(3) == 0)
+                && (static_cast<Wide>(wide) == value) && (UInt128(value) == fromNative(value))
+                && (extended.limb(1) == static_cast<std::uint64_t>(static_cast<Wide>(negative) >> 64))
+                && (extended.limb(2) == ~std::uint64_t{0}) && (extended.limb(3) == ~std::uint64_t{0})
+                && (static_cast<Signed>(extended) == negative)
+                && (static_cast<Wide>(UInt256(value) << 64) == (value << 64));
+        }
+
+        return pass && (static_cast<Wide>(easyMath::WideUInt<64>(~Wide{0})) == ~std::uint64_t{0})
+            && (easyMath::WideUInt<64>(Signed{-1}).limb(0) == ~std::uint64_t{0});
+    }
+    else
+        return true;
+}
+
+int main()
+{
+    auto rng = easyTest::seededEngine();
+
+    bool arithmetic = true, division = true, shift = true, compare = true;
+
+    for(std::size_t i = 0; i < COUNT; ++i)
+    {
+        auto lhsShift = rng() % 128;
+        auto rhsShift = rng() % 128;
+        Native lhs = ((static_cast<Native>(rng()) << 64) | rng()) >> lhsShift;
+        Native rhs = ((static_cast<Native>(rng()) << 64) | rng()) >> rhsShift;
+        if(rhs == 0)
+            rhs = 1;
+
+        auto wideLhs = fromNative(lhs), wideRhs = fromNative(rhs);
+
+        arithmetic = arithmetic && (wideLhs + wideRhs == fromNative(lhs + rhs))
+            && (wideLhs - wideRhs == fromNative(lhs - rhs))
+            && (wideLhs * wideRhs == fromNative(lhs * rhs))
+            && ((wideLhs & wideRhs) == fromNative(lhs & rhs))
+            && ((wideLhs | wideRhs) == fromNative(lhs | rhs))
+            && ((wideLhs ^ wideRhs) == fromNative(lhs ^ rhs))
+            && (easyMath::willAddOverflow(wideLhs, wideRhs) == (lhs + rhs < lhs));
+
+        division = division && (wideLhs / wideRhs == fromNative(lhs / rhs))
+            && (wideLhs % wideRhs == fromNative(lhs % rhs))
+            && (easyMath::divideRoundUp(wideLhs, wideRhs) == fromNative(lhs / rhs + ((lhs % rhs) ? 1 : 0)));
+
+        shift = shift && ((wideLhs << lhsShift) == fromNative(lhs << lhsShift))
+            && ((wideLhs >> rhsShift) == fromNative(lhs >> rhsShift))
+            && ((wideLhs << 128) == 0u);
+
+        compare = compare && ((wideLhs < wideRhs) == (lhs < rhs))
+            && ((wideLhs >= wideRhs) == (lhs >= rhs))
+            && ((wideLhs == wideRhs) == (lhs == rhs));
+    }
+
+    CHECK("WideUInt<128> add, sub, mul, bitwise", arithmetic);
+    CHECK("WideUInt<128> div, mod, divideRoundUp", division);
+    CHECK("WideUInt<128> shift", shift);
+    CHECK("WideUInt<128> compare", compare);
+
+    CHECK("WideUInt from / to __int128 and unsigned __int128", checkNative128(rng));
+
+    UInt256 value = 0u;
+    for(auto limb : {0xf00dfacecafebabeull, 0x0123456789abcdefull, 0x0011223344556677ull, 0x8899aabbccddeeffull})
+        value = (value << 64) | limb;
+    CHECK("UInt256 limb order", (value.limb(3) == 0xf00dfacecafebabeull) && (value.limb(0) == 0x8899aabbccddeeffull));
+
+    auto parts = easyMath::splitInteger<UInt256, 64>(value);
+    CHECK("splitInteger<UInt256, 64>", (parts[0] == 0x8899aabbccddeeffull) && (parts[3] == 0xf00dfacecafebabeull));
+
+    CHECK("extractBits<UInt256>", easyMath::extractBits<UInt256>(value, 248, 8) == 0xf0);
+
+    UInt256 big = easyMath::NumericTraits<UInt256>::max();
+    CHECK("addAndCheckOverflow<UInt256>", easyMath::addAndCheckOverflow<UInt256>(big, 0u, true) && (big == 0u));
+
+    CHECK("UInt256 double conversion", static_cast<double>(UInt256(1) << 200) == 1.6069380442589903e60);
+    CHECK("UInt256 from double", UInt256(1.6069380442589903e60) == (UInt256(1) << 200));
+
+    UInt256 numerator = (UInt256(0x123456789ull) << 180) + 987654321u;
+    UInt256 denominator = (UInt256(0xfedcbaull) << 100) + 12345u;
+    CHECK("UInt256 div identity", (numerator / denominator) * denominator + (numerator % denominator) == numerator);
+}